@@ -0,0 +1,13 @@
+AC_DEFUN([RTEMS_ENABLE_SMP_MCS_LOCKS],
+[
+
+AC_ARG_ENABLE(smp-mcs-locks,
+[AS_HELP_STRING([--enable-smp-mcs-locks],[use Mellor-Crummey and Scott (MCS)
+locks instead of ticket locks for SMP locks and thread queues (default=no)])],
+
+[case "${enableval}" in 
+  yes) RTEMS_HAS_SMP_MCS_LOCKS=yes ;;
+  no) RTEMS_HAS_SMP_MCS_LOCKS=no ;;
+  *)  AC_MSG_ERROR(bad value ${enableval} for enable-smp-mcs-locks option) ;;
+esac],[RTEMS_HAS_SMP_MCS_LOCKS=no]) 
+])
@@ -19,6 +19,7 @@
 
 #include <bsp.h>
 #include <rtems/clockdrv.h>
+#include <rtems/timecounter.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/watchdogimpl.h>
@@ -39,6 +40,18 @@
 #error "clockdrv_shell.h: Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+    #error "clockdrv_shell.h: Tickless idle PLUS Fast Idle or n ISRs per tick is not supported"
+  #endif
+  #if defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER)
+    #error "clockdrv_shell.h: Tickless idle needs a timecounter"
+  #endif
+  #ifndef Clock_driver_support_set_next_tick
+    #error "clockdrv_shell.h: Tickless idle needs Clock_driver_support_set_next_tick()"
+  #endif
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -97,6 +110,141 @@ static void Clock_driver_timecounter_tick( void )
 }
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+/*
+ * In tickless mode the clock interrupt is a one-shot interrupt.  The BSP
+ * provides Clock_driver_support_set_next_tick( ns ) which programs the next
+ * clock interrupt to happen in ns nanoseconds from now.  The uptime of the
+ * timecounter is used to account the clock tick intervals elapsed since the
+ * last clock interrupt.  The timecounter must be installed by
+ * Clock_driver_support_initialize_hardware().
+ *
+ * The tickless mode is only used if one processor is present, since the clock
+ * interrupt of this shell serves all processors.  Otherwise, the clock
+ * interrupt is programmed for each clock tick.
+ */
+static struct {
+  uint64_t tick_uptime;
+  uint32_t nanoseconds_per_tick;
+  bool     enabled;
+} Clock_driver_tickless;
+
+static uint64_t Clock_driver_tickless_uptime( void )
+{
+  struct timespec ts;
+
+  _Timecounter_Nanouptime( &ts );
+
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint32_t) ts.tv_nsec;
+}
+
+static void Clock_driver_tickless_program( uint64_t deadline )
+{
+  uint64_t now;
+
+  now = Clock_driver_tickless_uptime();
+
+  if ( deadline > now ) {
+    Clock_driver_support_set_next_tick( deadline - now );
+  } else {
+    Clock_driver_support_set_next_tick( 0 );
+  }
+}
+
+static uint32_t Clock_driver_tickless_elapsed_ticks( Per_CPU_Control *cpu )
+{
+  uint64_t elapsed;
+
+  (void) cpu;
+
+  elapsed = ( Clock_driver_tickless_uptime()
+    - Clock_driver_tickless.tick_uptime )
+    / Clock_driver_tickless.nanoseconds_per_tick;
+
+  if ( elapsed > UINT32_MAX ) {
+    elapsed = UINT32_MAX;
+  }
+
+  Clock_driver_tickless.tick_uptime +=
+    elapsed * Clock_driver_tickless.nanoseconds_per_tick;
+
+  return (uint32_t) elapsed;
+}
+
+static void Clock_driver_tickless_set_next_tick(
+  Per_CPU_Control *cpu,
+  uint64_t         next_tick
+)
+{
+  Clock_driver_tickless_program(
+    Clock_driver_tickless.tick_uptime
+      + ( next_tick - cpu->Watchdog.ticks )
+        * Clock_driver_tickless.nanoseconds_per_tick
+  );
+}
+
+static Watchdog_Tickless_operations Clock_driver_tickless_operations = {
+  .elapsed_ticks = Clock_driver_tickless_elapsed_ticks,
+  .set_next_tick = Clock_driver_tickless_set_next_tick
+};
+
+static void Clock_driver_tickless_initialize( void )
+{
+  struct timecounter *tc = _Timecounter;
+  uint64_t max_ns;
+  uint64_t max_ticks;
+
+  Clock_driver_tickless.nanoseconds_per_tick =
+    rtems_configuration_get_nanoseconds_per_tick();
+  Clock_driver_tickless.tick_uptime = Clock_driver_tickless_uptime();
+
+  if ( _SMP_Get_processor_count() != 1 ) {
+    Clock_driver_tickless_program(
+      Clock_driver_tickless.tick_uptime
+        + Clock_driver_tickless.nanoseconds_per_tick
+    );
+    return;
+  }
+
+  /*
+   * The timecounter is updated only during clock interrupts, so the time
+   * between two clock interrupts must be less than the period of the
+   * timecounter.
+   */
+  max_ns = ( (uint64_t) tc->tc_counter_mask / 2 ) * 1000000000
+    / tc->tc_frequency;
+  max_ticks = max_ns / Clock_driver_tickless.nanoseconds_per_tick;
+
+  if ( max_ticks == 0 ) {
+    max_ticks = 1;
+  } else if ( max_ticks > UINT32_MAX ) {
+    max_ticks = UINT32_MAX;
+  }
+
+  Clock_driver_tickless_operations.max_ticks = (uint32_t) max_ticks;
+  Clock_driver_tickless.enabled = true;
+  _Watchdog_Tickless_enable(
+    _Per_CPU_Get_by_index( 0 ),
+    &Clock_driver_tickless_operations
+  );
+}
+
+static void Clock_driver_tickless_tick( void )
+{
+  if ( Clock_driver_tickless.enabled ) {
+    _Timecounter_Tick_tickless();
+  } else {
+    Clock_driver_timecounter_tick();
+    Clock_driver_tickless.tick_uptime +=
+      Clock_driver_tickless.nanoseconds_per_tick;
+    Clock_driver_tickless_program(
+      Clock_driver_tickless.tick_uptime
+        + Clock_driver_tickless.nanoseconds_per_tick
+    );
+  }
+}
+#endif
+
 /**
  * @brief ISRs until next clock tick
  */
@@ -137,7 +285,14 @@ rtems_isr Clock_isr(
    */
   Clock_driver_ticks += 1;
 
-  #if CLOCK_DRIVER_USE_FAST_IDLE
+  #if CLOCK_DRIVER_USE_TICKLESS_IDLE
+    /*
+     *  Do the hardware specific per-tick action and program the next clock
+     *  interrupt.
+     */
+    Clock_driver_support_at_tick();
+    Clock_driver_tickless_tick();
+  #elif CLOCK_DRIVER_USE_FAST_IDLE
     {
       struct timecounter *tc = _Timecounter;
       uint64_t us_per_tick = rtems_configuration_get_microseconds_per_tick();
@@ -249,6 +404,10 @@ rtems_device_driver Clock_initialize(
   atexit( Clock_exit );
 #endif
 
+  #if CLOCK_DRIVER_USE_TICKLESS_IDLE
+    Clock_driver_tickless_initialize();
+  #endif
+
   /*
    *  If we are counting ISRs per tick, then initialize the counter.
    */
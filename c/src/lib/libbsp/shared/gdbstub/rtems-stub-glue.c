@@ -132,7 +132,7 @@ Thread_Control *rtems_gdb_index_to_stub_id(
 
       if (gdb_index <= first + (int) (max_id - min_id)) {
         th = (Thread_Control *)
-          info->local_table[gdb_index - first + 1];
+          _Objects_Get_local_object(info, gdb_index - first + 1);
       }
 
       first = last + 1;
@@ -182,7 +182,10 @@ int rtems_gdb_stub_get_next_thread(int gdb_index)
           next_gdb_index == 0 && potential_next <= last;
           ++potential_next
         ) {
-          if (info->local_table[potential_next - first + 1] != NULL) {
+          if (
+            _Objects_Get_local_object(info, potential_next - first + 1)
+              != NULL
+          ) {
             next_gdb_index = potential_next;
           }
         }
@@ -270,7 +273,7 @@ static int rtems_gdb_stub_get_thread_info(
 
        if (gdb_index <= last) {
          Thread_Control *th = (Thread_Control *)
-           obj_info->local_table[gdb_index - first + 1];
+           _Objects_Get_local_object(obj_info, gdb_index - first + 1);
 
          if (th != NULL) {
            char tmp_buf[9];
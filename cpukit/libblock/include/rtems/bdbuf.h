@@ -44,7 +44,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using a hash index.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -70,6 +70,14 @@ extern "C" {
  * cannot be realloced.  Groups with no buffers in use can be taken and
  * realloced to a new size.  This is how buffers of different sizes move around
  * the cache.
+ *
+ * The groups may be partitioned into shards, see
+ * rtems_bdbuf_config::cache_shards.  Each shard has its own lock, hash index,
+ * lists and waiters.  A block is mapped to a shard by the hash of its device
+ * and block number, so accesses to different blocks usually do not contend
+ * for the same lock on SMP configurations.  A shard can only use its own
+ * groups, so each shard gets at least RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN
+ * groups.  This lets a user hold several buffers of one shard at a time.
 
  * The buffers are held in various lists in the cache.  All buffers follow this
  * state machine:
@@ -129,9 +137,9 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
- * If the block is to be read by the user and not in the cache it is transfered
- * from the disk into memory.  If no buffers are on the LRU list the modified
+ * assigned to a block and inserted to the hash index based on the block/device
+ * key.  If the block is to be read by the user and not in the cache it is
+ * transfered from the disk into memory.  If no buffers are on the LRU list the modified
  * list is checked.  If buffers are on the modified the swap out task will be
  * woken.  The request blocks until a buffer is available for recycle.
  *
@@ -148,14 +156,27 @@ extern "C" {
  * released as modified the user would have to block waiting until it had been
  * written.  This would be a performance problem.
  *
+ * The swap out task writes the buffers of one disk at a time.  The modified
+ * neighbours of the buffers to write are written with them, so that runs of
+ * consecutive blocks need one request, and the writes are sorted by block
+ * starting at the position of the previous write like an elevator.  The hold
+ * time is the maximum age of a modified buffer.  If more than the configured
+ * dirty ratio of the cache is modified, the oldest modified buffers are
+ * written before their hold time ends.
+ *
  * The code performs multiple block reads and writes.  Multiple block reads or
  * read-ahead increases performance with hardware that supports it.  It also
  * helps with a large cache as the disk head movement is reduced.  It however
  * is a speculative operation so excessive use can remove valuable and needed
- * blocks from the cache.  The read-ahead is triggered after two misses of
- * ascending consecutive blocks or a read hit of a block read by the
- * most-resent read-ahead transfer.  The read-ahead works per disk, but all
- * transfers are issued by the read-ahead task.
+ * blocks from the cache.  The read-ahead works per sequential read stream and
+ * several streams of a disk are tracked at the same time.  A stream starts
+ * with a miss and the read-ahead is triggered by a miss of the next block or
+ * a read hit of a block read by the most-recent read-ahead transfer of the
+ * stream.  The read-ahead window of a stream starts with a quarter of the
+ * maximum read-ahead blocks.  It doubles each time a block read ahead is
+ * accessed at the trigger and shrinks for each block read ahead which is
+ * recycled before any access.  All transfers are issued by the read-ahead
+ * task.
  *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
@@ -187,11 +208,11 @@ extern "C" {
  * @brief State of a buffer of the cache.
  *
  * The state has several implications.  Depending on the state a buffer can be
- * in the AVL tree, in a list, in use by an entity and a group user or not.
+ * in the hash index, in a list, in use by an entity and a group user or not.
  *
  * <table>
  *   <tr>
- *     <th>State</th><th>Valid Data</th><th>AVL Tree</th>
+ *     <th>State</th><th>Valid Data</th><th>Hash Index</th>
  *     <th>LRU List</th><th>Modified List</th><th>Synchronization List</th>
  *     <th>Group User</th><th>External User</th>
  *   </tr>
@@ -308,21 +329,13 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
+ * speed-up buffer lookup descriptors are organized in a hash index. The fields
  * 'dd' and 'block' are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
-
   rtems_disk_device *dd;        /**< disk device */
 
   rtems_blkdev_bnum block;      /**< block number on the device */
@@ -337,6 +350,10 @@ typedef struct rtems_bdbuf_buffer
                                   * part of. */
   uint32_t hold_timer;           /**< Timer to indicate how long a buffer
                                   * has been held in the cache modified. */
+  bool     hot;                  /**< The buffer was used more than once
+                                  * according to the replacement policy. */
+  bool     read_ahead;           /**< The buffer was read ahead and not
+                                  * accessed yet. */
 
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
@@ -360,20 +377,49 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * The policy to select a cached buffer for recycling.
+ */
+typedef enum {
+  /**
+   * Recycle the least recently used buffer.
+   */
+  RTEMS_BDBUF_REPLACEMENT_LRU,
+
+  /**
+   * The 2Q policy.  Buffers are recycled from a list of buffers used once.
+   * A block is only moved to a list of hot buffers if it is used again shortly
+   * after its buffer was recycled.  A quarter of the cache is reserved for the
+   * buffers used once, so that a sequential scan of a large file passes
+   * through the cache without displacing the hot buffers.
+   */
+  RTEMS_BDBUF_REPLACEMENT_2Q,
+
+  /**
+   * The adaptive replacement cache (ARC) policy.  A buffer accessed again
+   * while it is cached becomes hot.  The space reserved for the buffers used
+   * once adapts to the hits on recently recycled buffers.
+   */
+  RTEMS_BDBUF_REPLACEMENT_ARC
+} rtems_bdbuf_replacement_policy;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
  */
 typedef struct rtems_bdbuf_config {
-  uint32_t            max_read_ahead_blocks;   /**< Number of blocks to read
-                                                * ahead. */
+  uint32_t            max_read_ahead_blocks;   /**< Maximum number of blocks
+                                                * to read ahead with one
+                                                * request. */
   uint32_t            max_write_blocks;        /**< Number of blocks to write
                                                 * at once. */
   rtems_task_priority swapout_priority;        /**< Priority of the swap out
                                                 * task. */
   uint32_t            swapout_period;          /**< Period swap-out checks buf
                                                 * timers. */
-  uint32_t            swap_block_hold;         /**< Period a buffer is held. */
+  uint32_t            swap_block_hold;         /**< Period a buffer is held.
+                                                * This is the maximum age of
+                                                * a modified buffer. */
   size_t              swapout_workers;         /**< The number of worker
                                                 * threads for the swap-out
                                                 * task. */
@@ -389,6 +435,21 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  size_t              cache_shards;            /**< The number of independently
+                                                * locked shards of the cache.
+                                                * A value of zero is treated
+                                                * as one. The count is reduced
+                                                * to give each shard at least
+                                                * RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN
+                                                * groups. */
+  rtems_bdbuf_replacement_policy replacement_policy; /**< The replacement
+                                                      * policy. */
+  uint32_t            swapout_dirty_ratio;     /**< Percentage of a shard which
+                                                * may be modified. The oldest
+                                                * modified buffers beyond it
+                                                * are written before their
+                                                * hold period ends. A value of
+                                                * zero disables the limit. */
 } rtems_bdbuf_config;
 
 /**
@@ -399,10 +460,12 @@ typedef struct rtems_bdbuf_config {
 extern const rtems_bdbuf_config rtems_bdbuf_configuration;
 
 /**
- * The default value for the maximum read-ahead blocks disables the read-ahead
- * feature.
+ * Default maximum number of blocks to read ahead at once. The read-ahead
+ * window of a sequential stream starts with a quarter of it. A request of
+ * this many blocks is within the request size limit of rtems_bdbuf_init() on
+ * all ports. A value of zero disables the read-ahead feature.
  */
-#define RTEMS_BDBUF_MAX_READ_AHEAD_BLOCKS_DEFAULT    0
+#define RTEMS_BDBUF_MAX_READ_AHEAD_BLOCKS_DEFAULT    8
 
 /**
  * Default maximum number of blocks to write at once.
@@ -461,6 +524,29 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default number of cache shards. A single shard has one lock for all
+ * buffers.
+ */
+#define RTEMS_BDBUF_CACHE_SHARDS_DEFAULT (1)
+
+/**
+ * Minimum number of groups of a cache shard. A task which holds buffers of a
+ * shard and waits for another buffer of the same shard would wait forever if
+ * the shard had no other group.
+ */
+#define RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN (8)
+
+/**
+ * Default replacement policy.
+ */
+#define RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT RTEMS_BDBUF_REPLACEMENT_LRU
+
+/**
+ * The default swap-out dirty ratio disables the limit.
+ */
+#define RTEMS_BDBUF_SWAPOUT_DIRTY_RATIO_DEFAULT 0
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -0,0 +1,164 @@
+/**
+ * @file
+ *
+ * @ingroup rtems_bdbuf_hash
+ *
+ * @brief Block Device Buffer Hash Index
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_BDBUFHASH_H
+#define _RTEMS_BDBUFHASH_H
+
+#include <rtems/bdbuf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rtems_bdbuf_hash Block Device Buffer Hash Index
+ *
+ * @ingroup rtems_bdbuf
+ *
+ * The buffer descriptors of the cache are indexed by an open addressing hash
+ * table with linear probing keyed by the disk device and the block number.
+ * The block number is stored next to the descriptor pointer in each slot, so
+ * that a probe sequence usually stays within one or two cache lines and the
+ * descriptor is only dereferenced on a block number match.  Removal uses
+ * backward shift deletion, so there are no tombstones and the probe sequences
+ * stay short independent of the insert and remove history.
+ *
+ * The table has at least twice as many slots as buffer descriptors may be
+ * indexed at the same time.  The caller provides the synchronization.
+ *
+ * @{
+ */
+
+/**
+ * @brief A hash table slot.
+ */
+typedef struct rtems_bdbuf_hash_slot
+{
+  rtems_blkdev_bnum   block; /**< The block number of the descriptor. */
+  rtems_bdbuf_buffer* bd;    /**< The descriptor or NULL for a free slot. */
+} rtems_bdbuf_hash_slot;
+
+/**
+ * @brief The hash table.
+ */
+typedef struct rtems_bdbuf_hash_table
+{
+  rtems_bdbuf_hash_slot* slots; /**< The slot table. */
+  size_t                 mask;  /**< The slot count minus one. */
+  size_t                 count; /**< The count of indexed descriptors. */
+} rtems_bdbuf_hash_table;
+
+/**
+ * @brief Initializes a hash table.
+ *
+ * @param[in] table The hash table.
+ * @param[in] max_entries The maximum count of descriptors indexed at the same
+ *   time.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the slot table.
+ */
+rtems_status_code
+rtems_bdbuf_hash_initialize (rtems_bdbuf_hash_table* table,
+                             size_t                  max_entries);
+
+/**
+ * @brief Frees the slot table of a hash table.
+ *
+ * @param[in] table The hash table.
+ */
+void
+rtems_bdbuf_hash_destroy (rtems_bdbuf_hash_table* table);
+
+/**
+ * @brief Inserts a descriptor into a hash table.
+ *
+ * The disk device and block number of the descriptor are the key.
+ *
+ * @param[in] table The hash table.
+ * @param[in] bd The descriptor to insert.
+ *
+ * @retval 0 The descriptor was inserted.
+ * @retval -1 A descriptor with the same key is already present or the table
+ *   is full.
+ */
+int
+rtems_bdbuf_hash_insert (rtems_bdbuf_hash_table* table,
+                         rtems_bdbuf_buffer*     bd);
+
+/**
+ * @brief Removes a descriptor from a hash table.
+ *
+ * @param[in] table The hash table.
+ * @param[in] bd The descriptor to remove.
+ *
+ * @retval 0 The descriptor was removed.
+ * @retval -1 The descriptor is not present.
+ */
+int
+rtems_bdbuf_hash_remove (rtems_bdbuf_hash_table*   table,
+                         const rtems_bdbuf_buffer* bd);
+
+/**
+ * @brief Returns the hash value of a key.
+ */
+static inline size_t
+rtems_bdbuf_hash_key (const rtems_disk_device* dd, rtems_blkdev_bnum block)
+{
+  uint32_t h = (uint32_t) block ^ ((uint32_t) (uintptr_t) dd * 0x9e3779b1U);
+
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+
+  return h;
+}
+
+/**
+ * @brief Searches a hash table for the descriptor of a block.
+ *
+ * @param[in] table The hash table.
+ * @param[in] dd The disk device.
+ * @param[in] block The block number.
+ *
+ * @retval NULL No descriptor with this key is present.
+ * @return The descriptor of the block.
+ */
+static inline rtems_bdbuf_buffer*
+rtems_bdbuf_hash_search (const rtems_bdbuf_hash_table* table,
+                         const rtems_disk_device*      dd,
+                         rtems_blkdev_bnum             block)
+{
+  const rtems_bdbuf_hash_slot* slots = table->slots;
+  size_t                       mask = table->mask;
+  size_t                       i = rtems_bdbuf_hash_key (dd, block) & mask;
+
+  while (slots[i].bd != NULL)
+  {
+    if (slots[i].block == block && slots[i].bd->dd == dd)
+      return slots[i].bd;
+
+    i = (i + 1) & mask;
+  }
+
+  return NULL;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
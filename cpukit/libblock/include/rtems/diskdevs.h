@@ -59,7 +59,12 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_NO_TRIGGER ((rtems_blkdev_bnum) -1)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of sequential read streams tracked per disk for read-ahead.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAM_COUNT 4
+
+/**
+ * @brief Block device read-ahead control of a sequential read stream.
  */
 typedef struct {
   /**
@@ -67,6 +72,11 @@ typedef struct {
    */
   rtems_chain_node node;
 
+  /**
+   * @brief The disk device of this stream.
+   */
+  rtems_disk_device *dd;
+
   /**
    * @brief Block value to trigger the read-ahead request.
    *
@@ -82,6 +92,22 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Count of blocks to read with the next read-ahead request.
+   *
+   * The window grows if the blocks read ahead are accessed and shrinks if they
+   * are recycled before any access.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Value of the disk read-ahead clock at the last access of this
+   * stream.
+   *
+   * The least recently accessed stream is replaced by a new stream.
+   */
+  uint32_t last_access;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -144,6 +170,21 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Ghost hit count.
+   *
+   * Count of read misses on blocks whose buffer was recycled recently.  Only
+   * the 2Q and ARC replacement policies maintain this count.
+   */
+  uint32_t ghost_hits;
+
+  /**
+   * @brief Read-ahead waste count.
+   *
+   * Count of blocks read ahead and recycled before any access.
+   */
+  uint32_t read_ahead_wasted;
 } rtems_blkdev_stats;
 
 /**
@@ -267,9 +308,23 @@ struct rtems_disk_device {
   rtems_blkdev_stats stats;
 
   /**
-   * @brief Read-ahead control for this disk.
+   * @brief Read-ahead control of the sequential read streams of this disk.
+   */
+  rtems_blkdev_read_ahead read_ahead [RTEMS_DISK_READ_AHEAD_STREAM_COUNT];
+
+  /**
+   * @brief Read-ahead clock to order the accesses of the streams.
+   */
+  uint32_t read_ahead_clock;
+
+  /**
+   * @brief Media block at which the swap-out task starts to write the next
+   * modified buffers of this disk.
+   *
+   * The buffers are written in ascending block order from this position and
+   * then from the start of the disk, like an elevator.
    */
-  rtems_blkdev_read_ahead read_ahead;
+  rtems_blkdev_bnum write_position;
 };
 
 /**
@@ -0,0 +1,124 @@
+/**
+ * @file
+ *
+ * @ingroup rtems_bdbuf_hash
+ *
+ * @brief Block Device Buffer Hash Index
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/bdbufhash.h>
+
+rtems_status_code
+rtems_bdbuf_hash_initialize (rtems_bdbuf_hash_table* table,
+                             size_t                  max_entries)
+{
+  size_t slot_count = 2;
+  size_t size;
+
+  /*
+   * Keep the load factor at or below one half.
+   */
+  while (slot_count < 2 * max_entries)
+    slot_count <<= 1;
+
+  size = slot_count * sizeof (*table->slots);
+  table->slots = rtems_cache_aligned_malloc (size);
+  if (table->slots == NULL)
+    return RTEMS_NO_MEMORY;
+
+  memset (table->slots, 0, size);
+  table->mask = slot_count - 1;
+  table->count = 0;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void
+rtems_bdbuf_hash_destroy (rtems_bdbuf_hash_table* table)
+{
+  free (table->slots);
+  table->slots = NULL;
+}
+
+int
+rtems_bdbuf_hash_insert (rtems_bdbuf_hash_table* table,
+                         rtems_bdbuf_buffer*     bd)
+{
+  rtems_bdbuf_hash_slot* slots = table->slots;
+  size_t                 mask = table->mask;
+  rtems_blkdev_bnum      block = bd->block;
+  size_t                 i;
+
+  if (table->count >= mask)
+    return -1;
+
+  i = rtems_bdbuf_hash_key (bd->dd, block) & mask;
+
+  while (slots[i].bd != NULL)
+  {
+    if (slots[i].block == block && slots[i].bd->dd == bd->dd)
+      return -1;
+
+    i = (i + 1) & mask;
+  }
+
+  slots[i].block = block;
+  slots[i].bd = bd;
+  ++table->count;
+
+  return 0;
+}
+
+int
+rtems_bdbuf_hash_remove (rtems_bdbuf_hash_table*   table,
+                         const rtems_bdbuf_buffer* bd)
+{
+  rtems_bdbuf_hash_slot* slots = table->slots;
+  size_t                 mask = table->mask;
+  size_t                 i;
+  size_t                 j;
+
+  i = rtems_bdbuf_hash_key (bd->dd, bd->block) & mask;
+
+  while (slots[i].bd != bd)
+  {
+    if (slots[i].bd == NULL)
+      return -1;
+
+    i = (i + 1) & mask;
+  }
+
+  /*
+   * Shift the following entries of the probe sequence back into the hole,
+   * unless this would move an entry in front of its home slot.
+   */
+  for (j = (i + 1) & mask; slots[j].bd != NULL; j = (j + 1) & mask)
+  {
+    size_t home = rtems_bdbuf_hash_key (slots[j].bd->dd, slots[j].block)
+      & mask;
+
+    if (((j - home) & mask) >= ((j - i) & mask))
+    {
+      slots[i] = slots[j];
+      i = j;
+    }
+  }
+
+  slots[i].bd = NULL;
+  --table->count;
+
+  return 0;
+}
@@ -42,6 +42,7 @@
 #include <rtems/error.h>
 
 #include "rtems/bdbuf.h"
+#include "rtems/bdbufhash.h"
 
 #define BDBUF_INVALID_DEV NULL
 
@@ -95,6 +96,62 @@ typedef struct rtems_bdbuf_waiters {
 #endif
 } rtems_bdbuf_waiters;
 
+/**
+ * A shard of the BD buffer cache. Each shard owns a fixed subset of the
+ * groups and thus of the BDs and buffer memory. A block is mapped to a shard
+ * by the hash of its device and block number and can only be cached in a BD
+ * of this shard. The shards are locked independently.
+ */
+typedef struct rtems_bdbuf_shard
+{
+  rtems_bdbuf_lock_type  lock;           /**< The shard lock. It locks all
+                                          * shard data and the BDs of the
+                                          * shard. */
+  rtems_bdbuf_hash_table index;          /**< Buffer descriptor lookup hash
+                                          * index of the shard. */
+  rtems_chain_control    lru;            /**< Least recently used list. With
+                                          * the 2Q and ARC replacement
+                                          * policies it holds the free
+                                          * buffers and the buffers used
+                                          * once. */
+  rtems_chain_control    hot;            /**< Least recently used list of the
+                                          * buffers used more than once. Only
+                                          * used by the 2Q and ARC
+                                          * replacement policies. */
+  size_t                 capacity;       /**< The shard size in minimum size
+                                          * buffers. */
+  size_t                 hot_size;       /**< The size of the buffers marked
+                                          * hot in minimum size buffers. */
+  size_t                 modified_size;  /**< The size of the buffers in the
+                                          * modified state in minimum size
+                                          * buffers. */
+  size_t                 hot_target;     /**< Recycle hot buffers first if the
+                                          * hot size reaches this value. */
+  uint32_t*              ghosts;         /**< The ghost table. It remembers
+                                          * the keys of recently recycled
+                                          * buffers. */
+  size_t                 ghost_mask;     /**< The ghost table size minus
+                                          * one. */
+  size_t                 ghost_count [2]; /**< The count of ghosts of cold
+                                           * and hot buffers. */
+  rtems_chain_control    modified;       /**< Modified buffers list */
+  rtems_chain_control    sync;           /**< Buffers to sync list */
+  const rtems_disk_device *sync_device;  /**< The device of an active device
+                                          * sync or BDBUF_INVALID_DEV. A copy
+                                          * of the cache value, so that a
+                                          * modified release does not need
+                                          * the cache lock. */
+
+  rtems_bdbuf_waiters    access_waiters; /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters    transfer_waiters; /**< Wait for a buffer in TRANSFER
+                                            * state. */
+  rtems_bdbuf_waiters    buffer_waiters; /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_shard;
+
 /**
  * The BD buffer cache.
  */
@@ -116,8 +173,11 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_bdbuf_lock_type lock;            /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_bdbuf_lock_type lock;            /**< The cache lock. It locks the
+                                          * sync state, the swap-out workers
+                                          * and the read-ahead state. It may
+                                          * be obtained while a shard lock is
+                                          * owned, but not vice versa. */
   rtems_bdbuf_lock_type sync_lock;       /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -125,20 +185,8 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
+  rtems_bdbuf_shard*  shards;            /**< The shards of the cache. */
+  size_t              shard_count;       /**< The number of shards. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
@@ -233,6 +281,12 @@ static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
  */
 static rtems_bdbuf_cache bdbuf_cache;
 
+/**
+ * The device statistics are updated by all shards. Use a lock with a short
+ * critical section instead of the cache lock.
+ */
+RTEMS_INTERRUPT_LOCK_DEFINE (static, rtems_bdbuf_stats_lock, "bdbuf stats")
+
 static pthread_once_t rtems_bdbuf_once_state = PTHREAD_ONCE_INIT;
 
 #if RTEMS_BDBUF_TRACE
@@ -269,19 +323,29 @@ rtems_bdbuf_show_usage (void)
   uint32_t group;
   uint32_t total = 0;
   uint32_t val;
+  size_t   s;
 
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
+  total = 0;
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards[s];
+
+    val = rtems_bdbuf_list_count (&shard->lru);
+    printf (", lru[%zu]=%lu", s, val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->hot);
+    printf (", hot[%zu]=%lu", s, val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->modified);
+    printf (", mod[%zu]=%lu", s, val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->sync);
+    printf (", sync[%zu]=%lu", s, val);
+    total += val;
+  }
   printf (", total=%lu\n", total);
 }
 
@@ -311,15 +375,6 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define rtems_bdbuf_show_users(_w, _b) ((void) 0)
 #endif
 
-/**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
- */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
-#endif
-
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -409,501 +464,6 @@ rtems_bdbuf_waiter_delete (rtems_bdbuf_waiters *waiter)
 #endif
 }
 
-/**
- * Searches for the node with specified dd/block.
- *
- * @param root pointer to the root node of the AVL-Tree
- * @param dd disk device search key
- * @param block block search key
- * @retval NULL node with the specified dd/block is not found
- * @return pointer to the node with specified dd/block
- */
-static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
-{
-  rtems_bdbuf_buffer* p = *root;
-
-  while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
-
-  return p;
-}
-
-/**
- * Inserts the specified node to the AVl-Tree.
- *
- * @param root pointer to the root node of the AVL-Tree
- * @param node Pointer to the node to add.
- * @retval 0 The node added successfully
- * @retval -1 An error occured
- */
-static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
-{
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
-
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
-      return -1;
-    }
-
-    p = q;
-  }
-
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
-
-  return 0;
-}
-
-
-/**
- * Removes the node from the tree.
- *
- * @param root Pointer to pointer to the root node
- * @param node Pointer to the node to remove
- * @retval 0 Item removed
- * @retval -1 No such item found
- */
-static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
-{
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  memset (buf_stack, 0, sizeof(buf_stack));
-
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
-
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
-
-  q = p;
-
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
-  {
-    p = NULL;
-  }
-
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
-  }
-  else
-  {
-    rtems_bdbuf_buffer **t;
-
-    r = q->avl.right;
-
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
-
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
-
-      *t = q = s;
-    }
-  }
-
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
-  }
-
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
-
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-
-  }
-
-  return 0;
-}
-
-static void
-rtems_bdbuf_set_state (rtems_bdbuf_buffer *bd, rtems_bdbuf_buf_state state)
-{
-  bd->state = state;
-}
-
 static rtems_blkdev_bnum
 rtems_bdbuf_media_block (const rtems_disk_device *dd, rtems_blkdev_bnum block)
 {
@@ -978,6 +538,76 @@ rtems_bdbuf_unlock_cache (void)
   rtems_bdbuf_unlock (&bdbuf_cache.lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
 }
 
+/**
+ * Lock a shard. A task must not own more than one shard lock at a time
+ * except through rtems_bdbuf_lock_all_shards().
+ */
+static void
+rtems_bdbuf_lock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_lock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_LOCK);
+}
+
+/**
+ * Unlock a shard.
+ */
+static void
+rtems_bdbuf_unlock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_unlock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
+}
+
+/**
+ * Lock all shards in ascending order. This excludes all buffer accesses and
+ * is used to change the geometry of a device and to purge a device.
+ */
+static void
+rtems_bdbuf_lock_all_shards (void)
+{
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+    rtems_bdbuf_lock_shard (&bdbuf_cache.shards [s]);
+}
+
+/**
+ * Unlock all shards.
+ */
+static void
+rtems_bdbuf_unlock_all_shards (void)
+{
+  size_t s = bdbuf_cache.shard_count;
+
+  while (s > 0)
+    rtems_bdbuf_unlock_shard (&bdbuf_cache.shards [--s]);
+}
+
+/**
+ * Return the shard of a BD. The groups are assigned round-robin to the
+ * shards, so this mapping is fixed.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_shard_of_bd (const rtems_bdbuf_buffer *bd)
+{
+  size_t group_index = (size_t) (bd->group - bdbuf_cache.groups);
+
+  return &bdbuf_cache.shards [group_index % bdbuf_cache.shard_count];
+}
+
+/**
+ * Return the shard of a media block. The upper bits of the hash value select
+ * the shard, since the lower bits select the slot in the hash index of the
+ * shard.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_shard_of_block (const rtems_disk_device *dd,
+                            rtems_blkdev_bnum        block)
+{
+  uint32_t h = (uint32_t) rtems_bdbuf_hash_key (dd, block);
+
+  return &bdbuf_cache.shards [((uint64_t) h * bdbuf_cache.shard_count) >> 32];
+}
+
 /**
  * Lock the cache's sync. A single task can nest calls.
  */
@@ -1040,17 +670,18 @@ rtems_bdbuf_restore_preemption (rtems_mode prev_mode)
  * be woken and this would require storage and we do not know the number of
  * tasks that could be waiting.
  *
- * While we have the cache locked we can try and claim the semaphore and
- * therefore know when we release the lock to the cache we will block until the
+ * While we have the shard locked we can try and claim the semaphore and
+ * therefore know when we release the lock to the shard we will block until the
  * semaphore is released. This may even happen before we get to block.
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
+ * The function assumes the shard is locked on entry and it will be locked on
  * exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard   *shard,
+                            rtems_bdbuf_waiters *waiters)
 {
   /*
    * Indicate we are waiting.
@@ -1059,7 +690,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
 
 #if defined(RTEMS_BDBUF_USE_PTHREAD)
   {
-    int eno = pthread_cond_wait (&waiters->cond_var, &bdbuf_cache.lock);
+    int eno = pthread_cond_wait (&waiters->cond_var, &shard->lock);
     if (eno != 0)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CV_WAIT);
   }
@@ -1069,10 +700,10 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     rtems_mode        prev_mode;
 
     /*
-     * Disable preemption then unlock the cache and block.  There is no POSIX
+     * Disable preemption then unlock the shard and block.  There is no POSIX
      * condition variable in the core API so this is a work around.
      *
-     * The issue is a task could preempt after the cache is unlocked because it is
+     * The issue is a task could preempt after the shard is unlocked because it is
      * blocking or just hits that window, and before this task has blocked on the
      * semaphore. If the preempting task flushes the queue this task will not see
      * the flush and may block for ever or until another transaction flushes this
@@ -1081,9 +712,9 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     prev_mode = rtems_bdbuf_disable_preemption();
 
     /*
-     * Unlock the cache, wait, and lock the cache when we return.
+     * Unlock the shard, wait, and lock the shard when we return.
      */
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     sc = rtems_semaphore_obtain (waiters->sema, RTEMS_WAIT, RTEMS_BDBUF_WAIT_TIMEOUT);
 
@@ -1093,7 +724,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     if (sc != RTEMS_UNSATISFIED)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CACHE_WAIT_2);
 
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
 
     rtems_bdbuf_restore_preemption (prev_mode);
   }
@@ -1107,7 +738,7 @@ rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard_of_bd (bd), waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -1134,36 +765,224 @@ rtems_bdbuf_wake (rtems_bdbuf_waiters *waiters)
 }
 
 static void
-rtems_bdbuf_wake_swapper (void)
+rtems_bdbuf_wake_swapper (void)
+{
+  rtems_status_code sc = rtems_event_send (bdbuf_cache.swapout,
+                                           RTEMS_BDBUF_SWAPOUT_SYNC);
+  if (sc != RTEMS_SUCCESSFUL)
+    rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_SO_WAKE_1);
+}
+
+static bool
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_shard *shard)
+{
+  return shard->buffer_waiters.count;
+}
+
+/**
+ * Return the size of a BD in minimum size buffers.
+ */
+static size_t
+rtems_bdbuf_bd_size (const rtems_bdbuf_buffer *bd)
+{
+  return bdbuf_cache.max_bds_per_group / bd->group->bds_per_group;
+}
+
+/**
+ * Set the state of a BD. The shard of the BD must be locked. A BD is on the
+ * modified list of its shard if and only if it is in the modified state, so
+ * the size of the modified buffers of the shard is maintained here.
+ */
+static void
+rtems_bdbuf_set_state (rtems_bdbuf_buffer *bd, rtems_bdbuf_buf_state state)
+{
+  if (bd->state == RTEMS_BDBUF_STATE_MODIFIED)
+    rtems_bdbuf_shard_of_bd (bd)->modified_size -= rtems_bdbuf_bd_size (bd);
+
+  if (state == RTEMS_BDBUF_STATE_MODIFIED)
+    rtems_bdbuf_shard_of_bd (bd)->modified_size += rtems_bdbuf_bd_size (bd);
+
+  bd->state = state;
+}
+
+static void
+rtems_bdbuf_make_hot (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  if (!bd->hot)
+  {
+    bd->hot = true;
+    shard->hot_size += rtems_bdbuf_bd_size (bd);
+  }
+}
+
+static void
+rtems_bdbuf_make_cold (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  if (bd->hot)
+  {
+    bd->hot = false;
+    shard->hot_size -= rtems_bdbuf_bd_size (bd);
+  }
+}
+
+/**
+ * Return the ghost table entry of a key. Bit 0 tells if the buffer was hot.
+ * Bit 1 is set so that an entry is never zero which marks an empty slot.
+ */
+static uint32_t
+rtems_bdbuf_ghost_entry (uint32_t key, bool hot)
+{
+  return ((key | 2U) & ~1U) | (hot ? 1U : 0U);
+}
+
+/**
+ * Remember a recycled block in the ghost table. The table is direct mapped,
+ * so a new ghost replaces an older ghost in the same slot. A collision of two
+ * keys merely leads to a wrong replacement decision.
+ */
+static void
+rtems_bdbuf_ghost_add (rtems_bdbuf_shard       *shard,
+                       const rtems_disk_device *dd,
+                       rtems_blkdev_bnum        block,
+                       bool                     hot)
+{
+  uint32_t  key = (uint32_t) rtems_bdbuf_hash_key (dd, block);
+  uint32_t *slot = &shard->ghosts [key & shard->ghost_mask];
+
+  if (*slot != 0)
+    --shard->ghost_count [*slot & 1U];
+
+  *slot = rtems_bdbuf_ghost_entry (key, hot);
+  ++shard->ghost_count [hot];
+}
+
+/**
+ * Look for a block in the ghost table and remove it.
+ *
+ * @retval 0 The block is not in the ghost table.
+ * @retval 1 The block was recycled as a cold buffer.
+ * @retval 2 The block was recycled as a hot buffer.
+ */
+static int
+rtems_bdbuf_ghost_take (rtems_bdbuf_shard       *shard,
+                        const rtems_disk_device *dd,
+                        rtems_blkdev_bnum        block)
+{
+  uint32_t  key = (uint32_t) rtems_bdbuf_hash_key (dd, block);
+  uint32_t *slot = &shard->ghosts [key & shard->ghost_mask];
+  uint32_t  entry = *slot;
+
+  if (entry == 0 || (entry & ~1U) != rtems_bdbuf_ghost_entry (key, false))
+    return 0;
+
+  *slot = 0;
+  --shard->ghost_count [entry & 1U];
+
+  return 1 + (int) (entry & 1U);
+}
+
+/**
+ * Adapt the hot target of the ARC replacement policy after a ghost hit. A
+ * hit on a ghost of a cold buffer shows that the cold buffers are recycled
+ * too early, so the hot buffers get less space, and vice versa.
+ */
+static void
+rtems_bdbuf_arc_adapt (rtems_bdbuf_shard *shard, bool hot_ghost)
+{
+  size_t cold_ghosts = shard->ghost_count [0] + !hot_ghost;
+  size_t hot_ghosts = shard->ghost_count [1] + hot_ghost;
+  size_t delta;
+
+  if (hot_ghost)
+  {
+    delta = cold_ghosts > hot_ghosts ? cold_ghosts / hot_ghosts : 1;
+    if (delta > shard->capacity - shard->hot_target)
+      delta = shard->capacity - shard->hot_target;
+    shard->hot_target += delta;
+  }
+  else
+  {
+    delta = hot_ghosts > cold_ghosts ? hot_ghosts / cold_ghosts : 1;
+    if (delta > shard->hot_target)
+      delta = shard->hot_target;
+    shard->hot_target -= delta;
+  }
+}
+
+/**
+ * A new block was set up in an empty buffer. A block seen again shortly after
+ * its buffer was recycled is made hot. The ghost must be taken before a
+ * buffer is recycled for the block since this may replace the ghost.
+ */
+static void
+rtems_bdbuf_policy_miss (rtems_bdbuf_shard  *shard,
+                         rtems_bdbuf_buffer *bd,
+                         int                 ghost)
+{
+  if (ghost != 0)
+  {
+    rtems_interrupt_lock_context lock_context;
+
+    if (bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_ARC)
+      rtems_bdbuf_arc_adapt (shard, ghost == 2);
+
+    rtems_bdbuf_make_hot (shard, bd);
+
+    rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
+    ++bd->dd->stats.ghost_hits;
+    rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
+  }
+}
+
+/**
+ * A cached or modified buffer is accessed again. The ARC replacement policy
+ * makes it hot. The 2Q replacement policy only makes buffers hot which are
+ * seen again after they were recycled.
+ */
+static void
+rtems_bdbuf_policy_hit (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = rtems_event_send (bdbuf_cache.swapout,
-                                           RTEMS_BDBUF_SWAPOUT_SYNC);
-  if (sc != RTEMS_SUCCESSFUL)
-    rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_SO_WAKE_1);
+  /*
+   * The first access of a block read ahead is no reuse.
+   */
+  if (bd->read_ahead)
+    bd->read_ahead = false;
+  else if (bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_ARC)
+    rtems_bdbuf_make_hot (rtems_bdbuf_shard_of_bd (bd), bd);
 }
 
-static bool
-rtems_bdbuf_has_buffer_waiters (void)
+/**
+ * A cached buffer is recycled for another block.
+ */
+static void
+rtems_bdbuf_policy_evict (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  if (shard->ghosts != NULL
+      && (!bd->hot
+          || bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_ARC))
+    rtems_bdbuf_ghost_add (shard, bd->dd, bd->block, bd->hot);
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_index (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
+  if (rtems_bdbuf_hash_remove (&shard->index, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
+
+  rtems_bdbuf_make_cold (shard, bd);
 }
 
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_index_and_lru_list (rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_index (bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -1176,7 +995,8 @@ static void
 rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&rtems_bdbuf_shard_of_bd (bd)->lru,
+                                   &bd->link);
 }
 
 static void
@@ -1188,8 +1008,11 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_append_unprotected (bd->hot ? &shard->hot : &shard->lru,
+                                  &bd->link);
 }
 
 static void
@@ -1199,17 +1022,42 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
+    rtems_bdbuf_remove_from_index (bd);
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
   }
 }
 
+/**
+ * Set the device of an active device sync in all shards. The shards are
+ * locked in turn. The cache must not be locked.
+ */
+static void
+rtems_bdbuf_set_shard_sync_device (const rtems_disk_device *dd)
+{
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards [s];
+
+    rtems_bdbuf_lock_shard (shard);
+    shard->sync_device = dd;
+    rtems_bdbuf_unlock_shard (shard);
+  }
+}
+
 static void
 rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
+  /*
+   * The shard copy of the sync device is set before the sync starts and
+   * cleared before the sync requester releases the sync lock.
+   */
+  if (shard->sync_device == bd->dd)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     /*
      * Wait for the sync lock.
@@ -1217,7 +1065,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
   }
 
   /*
@@ -1236,24 +1084,26 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&shard->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&shard->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (shard))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
 rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
@@ -1283,18 +1133,20 @@ rtems_bdbuf_bds_per_group (size_t size)
 static void
 rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_discard_buffer (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash index and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
  * @param group The group to reallocate.
@@ -1318,7 +1170,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_index_and_lru_list (bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1329,7 +1181,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&rtems_bdbuf_shard_of_bd (group->bdbuf)->buffer_waiters);
 
   return group->bdbuf;
 }
@@ -1341,23 +1193,66 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
 {
   bd->dd        = dd ;
   bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->read_ahead = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (&rtems_bdbuf_shard_of_bd (bd)->index, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
+/**
+ * A buffer read ahead is recycled before any access. Shrink the window of the
+ * stream which read it ahead.
+ */
+static void
+rtems_bdbuf_read_ahead_wasted (const rtems_bdbuf_buffer *bd)
+{
+  rtems_disk_device           *dd = bd->dd;
+  rtems_blkdev_bnum            block;
+  rtems_interrupt_lock_context lock_context;
+  size_t                       i;
+
+  if (dd->block_to_media_block_shift >= 0)
+    block = bd->block >> dd->block_to_media_block_shift;
+  else
+    block = (rtems_blkdev_bnum)
+      ((((uint64_t) bd->block) * dd->media_block_size) / dd->block_size);
+
+  rtems_bdbuf_lock_cache ();
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = &dd->read_ahead [i];
+
+    if (stream->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && block < stream->next
+        && stream->next - block <= 2 * stream->window)
+    {
+      if (stream->window > 1)
+        --stream->window;
+
+      break;
+    }
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
+  ++dd->stats.read_ahead_wasted;
+  rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
+}
+
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_from_list (rtems_bdbuf_shard   *shard,
+                                  rtems_chain_control *list,
+                                  rtems_disk_device   *dd,
+                                  rtems_blkdev_bnum    block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (list);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (list, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1375,7 +1270,15 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        if (bd->state == RTEMS_BDBUF_STATE_CACHED)
+        {
+          if (bd->read_ahead)
+            rtems_bdbuf_read_ahead_wasted (bd);
+
+          rtems_bdbuf_policy_evict (shard, bd);
+        }
+
+        rtems_bdbuf_remove_from_index_and_lru_list (bd);
 
         empty_bd = bd;
       }
@@ -1396,6 +1299,46 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
   return NULL;
 }
 
+/**
+ * Recycle a buffer for a block. Free buffers are always at the front of the
+ * LRU list. Otherwise the hot buffers are only recycled first if the hot
+ * size reached its target.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
+                                      rtems_blkdev_bnum  block)
+{
+  rtems_chain_control *first = &shard->lru;
+  rtems_chain_control *second = &shard->hot;
+  rtems_bdbuf_buffer  *bd;
+  int                  ghost = 0;
+
+  if (shard->ghosts != NULL)
+    ghost = rtems_bdbuf_ghost_take (shard, dd, block);
+
+  if (shard->hot_size >= shard->hot_target
+      && !rtems_chain_is_empty (&shard->hot)
+      && (rtems_chain_is_empty (&shard->lru)
+        || ((rtems_bdbuf_buffer *) rtems_chain_first (&shard->lru))->state
+          != RTEMS_BDBUF_STATE_FREE))
+  {
+    first = &shard->hot;
+    second = &shard->lru;
+  }
+
+  bd = rtems_bdbuf_get_buffer_from_list (shard, first, dd, block);
+  if (bd == NULL)
+    bd = rtems_bdbuf_get_buffer_from_list (shard, second, dd, block);
+
+  if (bd != NULL)
+    rtems_bdbuf_policy_miss (shard, bd, ghost);
+  else if (ghost != 0)
+    rtems_bdbuf_ghost_add (shard, dd, block, ghost == 2);
+
+  return bd;
+}
+
 static rtems_status_code
 rtems_bdbuf_create_task(
   rtems_name name,
@@ -1513,6 +1456,7 @@ rtems_bdbuf_do_init (void)
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  size_t              s;
   rtems_status_code   sc;
   bool                locked;
 
@@ -1533,12 +1477,17 @@ rtems_bdbuf_do_init (void)
       > RTEMS_MINIMUM_STACK_SIZE / 8U)
     return RTEMS_INVALID_NUMBER;
 
+  if (bdbuf_config.replacement_policy != RTEMS_BDBUF_REPLACEMENT_LRU
+      && bdbuf_config.replacement_policy != RTEMS_BDBUF_REPLACEMENT_2Q
+      && bdbuf_config.replacement_policy != RTEMS_BDBUF_REPLACEMENT_ARC)
+    return RTEMS_INVALID_NUMBER;
+
+  if (bdbuf_config.swapout_dirty_ratio > 100)
+    return RTEMS_INVALID_NUMBER;
+
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   /*
@@ -1558,21 +1507,6 @@ rtems_bdbuf_do_init (void)
   if (sc != RTEMS_SUCCESSFUL)
     goto error;
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
-                                  &bdbuf_cache.access_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
-
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
-                                  &bdbuf_cache.transfer_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
-
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
-                                  &bdbuf_cache.buffer_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
-
   /*
    * Compute the various number of elements in the cache.
    */
@@ -1583,6 +1517,96 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
 
+  /*
+   * Each shard needs enough groups to let a user hold several of its buffers
+   * at a time. A small cache has only one shard.
+   */
+  bdbuf_cache.shard_count = bdbuf_config.cache_shards;
+  if (bdbuf_cache.shard_count >
+      bdbuf_cache.group_count / RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN)
+    bdbuf_cache.shard_count =
+      bdbuf_cache.group_count / RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN;
+  if (bdbuf_cache.shard_count == 0)
+    bdbuf_cache.shard_count = 1;
+
+  bdbuf_cache.shards = calloc (sizeof (rtems_bdbuf_shard),
+                               bdbuf_cache.shard_count);
+  if (!bdbuf_cache.shards)
+    goto error;
+
+  /*
+   * Create the locks, the waiters and the hash index of each shard. The
+   * groups are assigned round-robin to the shards.
+   */
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards[s];
+    size_t             shard_groups =
+      bdbuf_cache.group_count / bdbuf_cache.shard_count
+      + (s < bdbuf_cache.group_count % bdbuf_cache.shard_count);
+
+    rtems_chain_initialize_empty (&shard->lru);
+    rtems_chain_initialize_empty (&shard->hot);
+    rtems_chain_initialize_empty (&shard->modified);
+    rtems_chain_initialize_empty (&shard->sync);
+    shard->sync_device = BDBUF_INVALID_DEV;
+
+    sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'S', 'l'),
+                                  &shard->lock);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
+                                    &shard->access_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
+                                    &shard->transfer_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
+                                    &shard->buffer_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    shard->capacity = shard_groups * bdbuf_cache.max_bds_per_group;
+    shard->modified_size = 0;
+
+    sc = rtems_bdbuf_hash_initialize (&shard->index, shard->capacity);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    /*
+     * The 2Q replacement policy reserves a quarter of the shard for buffers
+     * used once and remembers the recycled ones for half the shard size. The
+     * ARC replacement policy starts with no space reserved for them, adapts
+     * it on ghost hits and remembers hot and cold ghosts for the shard size.
+     */
+    shard->hot_target = shard->capacity;
+    if (bdbuf_config.replacement_policy != RTEMS_BDBUF_REPLACEMENT_LRU)
+    {
+      size_t ghost_count = 2;
+      size_t ghost_max = shard->capacity;
+
+      if (bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_2Q)
+      {
+        shard->hot_target -= shard->capacity / 4;
+        ghost_max /= 2;
+      }
+
+      while (ghost_count < ghost_max)
+        ghost_count <<= 1;
+
+      shard->ghosts = calloc (sizeof (*shard->ghosts), ghost_count);
+      if (!shard->ghosts)
+        goto error;
+
+      shard->ghost_mask = ghost_count - 1;
+    }
+  }
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1622,7 +1646,8 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    rtems_chain_append_unprotected (&rtems_bdbuf_shard_of_bd (bd)->lru,
+                                    &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
@@ -1726,9 +1751,23 @@ error:
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
 
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.buffer_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.access_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.transfer_waiters);
+  if (bdbuf_cache.shards)
+  {
+    for (s = 0; s < bdbuf_cache.shard_count; s++)
+    {
+      rtems_bdbuf_shard* shard = &bdbuf_cache.shards[s];
+
+      rtems_bdbuf_hash_destroy (&shard->index);
+      free (shard->ghosts);
+      rtems_bdbuf_waiter_delete (&shard->buffer_waiters);
+      rtems_bdbuf_waiter_delete (&shard->access_waiters);
+      rtems_bdbuf_waiter_delete (&shard->transfer_waiters);
+      rtems_bdbuf_lock_delete (&shard->lock);
+    }
+
+    free (bdbuf_cache.shards);
+  }
+
   rtems_bdbuf_lock_delete (&bdbuf_cache.sync_lock);
 
   if (locked)
@@ -1785,6 +1824,8 @@ rtems_bdbuf_wait_for_transient_event (void)
 static void
 rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1801,12 +1842,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1819,7 +1860,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&rtems_bdbuf_shard_of_bd (bd)->sync,
+                                  &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1832,6 +1874,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
 static bool
 rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1853,19 +1897,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1876,6 +1920,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1891,7 +1937,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1900,23 +1946,25 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_shard *shard)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&shard->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
 }
 
 static void
 rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
   rtems_bdbuf_wait_for_sync_done (bd);
@@ -1930,27 +1978,31 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_index (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_shard *shard,
+                                       rtems_disk_device *dd,
                                        rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (&shard->index, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
     if (bd != NULL)
+    {
+      bd->read_ahead = true;
       rtems_bdbuf_group_obtain (bd);
+    }
   }
   else
     /*
@@ -1963,14 +2015,15 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_shard *shard,
+                                   rtems_disk_device *dd,
                                    rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (&shard->index, dd, block);
 
     if (bd != NULL)
     {
@@ -1978,19 +2031,19 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
       {
         if (rtems_bdbuf_wait_for_recycle (bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+          rtems_bdbuf_remove_from_index_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_wake (&shard->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (shard);
     }
   }
   while (bd == NULL);
@@ -2025,6 +2078,53 @@ rtems_bdbuf_get_media_block (const rtems_disk_device *dd,
   return sc;
 }
 
+/**
+ * Lock the shard of a block. The media block number depends on the block
+ * size of the device which may only change while all shards are locked.
+ * Compute it first without a lock to select the shard and verify it once the
+ * shard is locked.
+ *
+ * @param dd The disk device.
+ * @param block The block number relative to the block size of the device.
+ * @param shard_ptr Returns the locked shard. It is only locked on success.
+ * @param media_block_ptr Returns the media block number.
+ */
+static rtems_status_code
+rtems_bdbuf_lock_shard_of_block (const rtems_disk_device *dd,
+                                 rtems_blkdev_bnum        block,
+                                 rtems_bdbuf_shard      **shard_ptr,
+                                 rtems_blkdev_bnum       *media_block_ptr)
+{
+  while (true)
+  {
+    rtems_status_code  sc;
+    rtems_blkdev_bnum  media_block;
+    rtems_bdbuf_shard *shard;
+
+    sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+    if (sc != RTEMS_SUCCESSFUL)
+      return sc;
+
+    shard = rtems_bdbuf_shard_of_block (dd, media_block);
+    rtems_bdbuf_lock_shard (shard);
+
+    sc = rtems_bdbuf_get_media_block (dd, block, media_block_ptr);
+    if (sc != RTEMS_SUCCESSFUL)
+    {
+      rtems_bdbuf_unlock_shard (shard);
+      return sc;
+    }
+
+    if (*media_block_ptr == media_block)
+    {
+      *shard_ptr = shard;
+      return RTEMS_SUCCESSFUL;
+    }
+
+    rtems_bdbuf_unlock_shard (shard);
+  }
+}
+
 rtems_status_code
 rtems_bdbuf_get (rtems_disk_device   *dd,
                  rtems_blkdev_bnum    block,
@@ -2032,11 +2132,10 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
 {
   rtems_status_code   sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer *bd = NULL;
+  rtems_bdbuf_shard  *shard = NULL;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
-
-  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  sc = rtems_bdbuf_lock_shard_of_block (dd, block, &shard, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
     /*
@@ -2046,11 +2145,12 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
 
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -2064,6 +2164,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
          * start and write the whole block and the file system will have no
          * record of this so just gets the block to fill.
          */
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       default:
@@ -2076,9 +2177,9 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       rtems_bdbuf_show_users ("get", bd);
       rtems_bdbuf_show_usage ();
     }
-  }
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   *bd_ptr = bd;
 
@@ -2102,18 +2203,96 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
+/**
+ * Complete the buffers of a transfer request which belong to a shard. The
+ * shard must be locked.
+ *
+ * @param req The transfer request.
+ * @param first The index of the first buffer of the shard.
+ * @param sc The transfer status.
+ * @param shard The shard.
+ */
+static void
+rtems_bdbuf_transfer_complete_shard (rtems_blkdev_request *req,
+                                     uint32_t              first,
+                                     rtems_status_code     sc,
+                                     rtems_bdbuf_shard    *shard)
+{
+  uint32_t transfer_index = 0;
+  bool wake_transfer_waiters = false;
+  bool wake_buffer_waiters = false;
+
+  for (transfer_index = first; transfer_index < req->bufnum; ++transfer_index)
+  {
+    rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
+    bool waiters;
+
+    if (rtems_bdbuf_shard_of_bd (bd) != shard)
+      continue;
+
+    waiters = bd->waiters;
+
+    if (waiters)
+      wake_transfer_waiters = true;
+    else
+      wake_buffer_waiters = true;
+
+    rtems_bdbuf_group_release (bd);
+
+    if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
+      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+    else
+      rtems_bdbuf_discard_buffer (bd);
+
+    if (rtems_bdbuf_tracer)
+      rtems_bdbuf_show_users ("transfer", bd);
+  }
+
+  if (wake_transfer_waiters)
+    rtems_bdbuf_wake (&shard->transfer_waiters);
+
+  if (wake_buffer_waiters)
+    rtems_bdbuf_wake (&shard->buffer_waiters);
+}
+
+/**
+ * Return true if the buffer at the transfer index is the first buffer of its
+ * shard in the transfer request.
+ */
+static bool
+rtems_bdbuf_is_first_of_shard (const rtems_blkdev_request *req,
+                               uint32_t                    transfer_index,
+                               const rtems_bdbuf_shard    *shard)
+{
+  uint32_t i;
+
+  for (i = 0; i < transfer_index; ++i)
+    if (rtems_bdbuf_shard_of_bd (req->bufs [i].user) == shard)
+      return false;
+
+  return true;
+}
+
+/**
+ * Execute a transfer request. The buffers of the request may belong to
+ * different shards. Each shard is locked in turn to complete its buffers.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param locked_shard The shard locked by the caller or NULL. It is unlocked
+ * during the transfer and locked again on return.
+ */
 static rtems_status_code
 rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
                                       rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+                                      rtems_bdbuf_shard    *locked_shard)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
   uint32_t transfer_index = 0;
-  bool wake_transfer_waiters = false;
-  bool wake_buffer_waiters = false;
+  rtems_interrupt_lock_context lock_context;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  if (locked_shard != NULL)
+    rtems_bdbuf_unlock_shard (locked_shard);
 
   /* The return value will be ignored for transfer requests */
   dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
@@ -2122,9 +2301,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   rtems_bdbuf_wait_for_transient_event ();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache ();
-
   /* Statistics */
+  rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
   if (req->req == RTEMS_BLKDEV_REQ_READ)
   {
     dd->stats.read_blocks += req->bufnum;
@@ -2138,53 +2316,102 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     if (sc != RTEMS_SUCCESSFUL)
       ++dd->stats.write_errors;
   }
+  rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
 
   for (transfer_index = 0; transfer_index < req->bufnum; ++transfer_index)
   {
-    rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
-    bool waiters = bd->waiters;
+    rtems_bdbuf_shard *shard =
+      rtems_bdbuf_shard_of_bd (req->bufs [transfer_index].user);
 
-    if (waiters)
-      wake_transfer_waiters = true;
-    else
-      wake_buffer_waiters = true;
+    if (shard != locked_shard
+        && rtems_bdbuf_is_first_of_shard (req, transfer_index, shard))
+    {
+      rtems_bdbuf_lock_shard (shard);
+      rtems_bdbuf_transfer_complete_shard (req, transfer_index, sc, shard);
+      rtems_bdbuf_unlock_shard (shard);
+    }
+  }
 
-    rtems_bdbuf_group_release (bd);
+  if (locked_shard != NULL)
+  {
+    rtems_bdbuf_lock_shard (locked_shard);
+    rtems_bdbuf_transfer_complete_shard (req, 0, sc, locked_shard);
+  }
 
-    if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
-      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
-    else
-      rtems_bdbuf_discard_buffer (bd);
+  if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
+    return sc;
+  else
+    return RTEMS_IO_ERROR;
+}
 
-    if (rtems_bdbuf_tracer)
-      rtems_bdbuf_show_users ("transfer", bd);
-  }
+/**
+ * Get the buffers of the blocks of a read request which map to a shard. The
+ * shard must be locked. The request is cut at the first block which cannot
+ * be read ahead.
+ *
+ * @param dd The disk device.
+ * @param req The read request. The block numbers of all buffers are set and
+ * the user of a buffer which was not yet obtained is NULL.
+ * @param first The index of the first block of the shard.
+ * @param limit The current end of the request. It is updated if the request
+ * is cut.
+ * @param shard The shard.
+ */
+static void
+rtems_bdbuf_gather_read_shard (rtems_disk_device    *dd,
+                               rtems_blkdev_request *req,
+                               uint32_t              first,
+                               uint32_t             *limit,
+                               rtems_bdbuf_shard    *shard)
+{
+  uint32_t transfer_index;
 
-  if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+  for (transfer_index = first; transfer_index < *limit; ++transfer_index)
+  {
+    rtems_blkdev_sg_buffer *sg = &req->bufs [transfer_index];
+    rtems_bdbuf_buffer     *bd;
+
+    if (rtems_bdbuf_shard_of_block (dd, sg->block) != shard)
+      continue;
+
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, sg->block);
+
+    if (bd == NULL)
+    {
+      *limit = transfer_index;
+      break;
+    }
 
-  if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+    sg->user   = bd;
+    sg->buffer = bd->buffer;
 
-  if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
-    return sc;
-  else
-    return RTEMS_IO_ERROR;
+    if (rtems_bdbuf_tracer)
+      rtems_bdbuf_show_users ("read", bd);
+  }
 }
 
+/**
+ * Execute a read request for a buffer and the following blocks. The shard of
+ * the buffer must be locked. It is locked on return.
+ *
+ * The blocks are gathered shard by shard, so that each shard is locked only
+ * once. The buffers obtained beyond a block which cannot be read ahead are
+ * discarded afterwards.
+ */
 static rtems_status_code
 rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
                                   rtems_bdbuf_buffer *bd,
                                   uint32_t            transfer_count)
 {
+  rtems_bdbuf_shard *first_shard = rtems_bdbuf_shard_of_bd (bd);
   rtems_blkdev_request *req = NULL;
-  rtems_blkdev_bnum media_block = bd->block;
   uint32_t media_blocks_per_block = dd->media_blocks_per_block;
   uint32_t block_size = dd->block_size;
-  uint32_t transfer_index = 1;
+  uint32_t transfer_index;
+  uint32_t limit = transfer_count;
+  bool first_locked = true;
 
   /*
    * TODO: This type of request structure is wrong and should be removed.
@@ -2200,71 +2427,132 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
+  for (transfer_index = 0; transfer_index < transfer_count; ++transfer_index)
+  {
+    req->bufs [transfer_index].user   = NULL;
+    req->bufs [transfer_index].block  =
+      bd->block + transfer_index * media_blocks_per_block;
+    req->bufs [transfer_index].length = block_size;
+  }
+
   req->bufs [0].user   = bd;
-  req->bufs [0].block  = media_block;
-  req->bufs [0].length = block_size;
   req->bufs [0].buffer = bd->buffer;
 
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_users ("read", bd);
 
-  while (transfer_index < transfer_count)
+  rtems_bdbuf_gather_read_shard (dd, req, 1, &limit, first_shard);
+
+  /*
+   * The buffer of the first block is in the TRANSFER state, so it is safe to
+   * unlock its shard while the blocks of the other shards are gathered. The
+   * block size may change in the meantime. The blocks of the first shard are
+   * already gathered up to the limit.
+   */
+  for (transfer_index = 1; transfer_index < limit; ++transfer_index)
   {
-    media_block += media_blocks_per_block;
+    rtems_bdbuf_shard *shard;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    if (req->bufs [transfer_index].user != NULL)
+      continue;
 
-    if (bd == NULL)
-      break;
+    if (first_locked)
+    {
+      rtems_bdbuf_unlock_shard (first_shard);
+      first_locked = false;
+    }
 
-    rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+    shard = rtems_bdbuf_shard_of_block (dd, req->bufs [transfer_index].block);
+    rtems_bdbuf_lock_shard (shard);
 
-    req->bufs [transfer_index].user   = bd;
-    req->bufs [transfer_index].block  = media_block;
-    req->bufs [transfer_index].length = block_size;
-    req->bufs [transfer_index].buffer = bd->buffer;
+    if (dd->block_size == block_size)
+      rtems_bdbuf_gather_read_shard (dd, req, transfer_index, &limit, shard);
+    else
+      limit = transfer_index;
 
-    if (rtems_bdbuf_tracer)
-      rtems_bdbuf_show_users ("read", bd);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
-    ++transfer_index;
+  /*
+   * Move the buffers gathered beyond the limit together and discard them.
+   */
+  req->bufnum = limit;
+  for (transfer_index = limit;
+       transfer_index < transfer_count;
+       ++transfer_index)
+    if (req->bufs [transfer_index].user != NULL)
+      req->bufs [req->bufnum++] = req->bufs [transfer_index];
+
+  if (req->bufnum > limit && first_locked)
+  {
+    rtems_bdbuf_unlock_shard (first_shard);
+    first_locked = false;
+  }
+
+  for (transfer_index = limit; transfer_index < req->bufnum; ++transfer_index)
+  {
+    rtems_bdbuf_shard *shard =
+      rtems_bdbuf_shard_of_bd (req->bufs [transfer_index].user);
+    uint32_t           i;
+
+    for (i = limit; i < transfer_index; ++i)
+      if (rtems_bdbuf_shard_of_bd (req->bufs [i].user) == shard)
+        break;
+
+    if (i == transfer_index)
+    {
+      rtems_bdbuf_lock_shard (shard);
+      rtems_bdbuf_transfer_complete_shard (req, transfer_index,
+                                           RTEMS_UNSATISFIED, shard);
+      rtems_bdbuf_unlock_shard (shard);
+    }
   }
 
-  req->bufnum = transfer_index;
+  req->bufnum = limit;
+
+  if (!first_locked)
+    rtems_bdbuf_lock_shard (first_shard);
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+  return rtems_bdbuf_execute_transfer_request (dd, req, first_shard);
 }
 
 static bool
-rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
+rtems_bdbuf_is_read_ahead_active (const rtems_blkdev_read_ahead *stream)
 {
-  return !rtems_chain_is_node_off_chain (&dd->read_ahead.node);
+  return !rtems_chain_is_node_off_chain (&stream->node);
 }
 
 static void
-rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
+rtems_bdbuf_read_ahead_cancel (rtems_blkdev_read_ahead *stream)
 {
-  if (rtems_bdbuf_is_read_ahead_active (dd))
+  if (rtems_bdbuf_is_read_ahead_active (stream))
   {
-    rtems_chain_extract_unprotected (&dd->read_ahead.node);
-    rtems_chain_set_off_chain (&dd->read_ahead.node);
+    rtems_chain_extract_unprotected (&stream->node);
+    rtems_chain_set_off_chain (&stream->node);
   }
 }
 
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
-  rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = &dd->read_ahead [i];
+
+    rtems_bdbuf_read_ahead_cancel (stream);
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
 }
 
 static void
-rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_check_read_ahead_trigger (rtems_blkdev_read_ahead *stream,
+                                      rtems_blkdev_bnum        block)
 {
   if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+      && stream->trigger == block
+      && !rtems_bdbuf_is_read_ahead_active (stream))
   {
     rtems_status_code sc;
     rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
@@ -2277,22 +2565,123 @@ rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
         rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
     }
 
-    rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+    rtems_chain_append_unprotected (chain, &stream->node);
   }
 }
 
-static void
+/**
+ * Return the stream of a device which triggers a read-ahead at this block or
+ * NULL if there is none.
+ */
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_find_read_ahead_stream (rtems_disk_device *dd,
+                                    rtems_blkdev_bnum  block)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = &dd->read_ahead [i];
+
+    if (stream->trigger == block)
+      return stream;
+  }
+
+  return NULL;
+}
+
+/**
+ * Start a new stream after a miss which no stream expected. A stream without
+ * trigger is used first, otherwise the least recently accessed stream is
+ * replaced. The window starts with a quarter of the maximum.
+ */
+static rtems_blkdev_read_ahead *
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
-  if (dd->read_ahead.trigger != block)
+  rtems_blkdev_read_ahead *victim = &dd->read_ahead [0];
+  size_t                   i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = &dd->read_ahead [i];
+
+    if (stream->trigger == RTEMS_DISK_READ_AHEAD_NO_TRIGGER)
+    {
+      victim = stream;
+      break;
+    }
+
+    if ((int32_t) (stream->last_access - victim->last_access) < 0)
+      victim = stream;
+  }
+
+  rtems_bdbuf_read_ahead_cancel (victim);
+  victim->trigger = block + 1;
+  victim->next = block + 2;
+  victim->window = (bdbuf_config.max_read_ahead_blocks + 3) / 4;
+
+  return victim;
+}
+
+/**
+ * Update the read-ahead state of a device after a read access. The read-ahead
+ * state is protected by the cache lock.
+ */
+static void
+rtems_bdbuf_update_read_ahead (rtems_disk_device *dd,
+                               rtems_blkdev_bnum  block,
+                               bool               miss)
+{
+  if (bdbuf_cache.read_ahead_task != 0)
   {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+    rtems_blkdev_read_ahead *stream;
+
+    rtems_bdbuf_lock_cache ();
+
+    stream = rtems_bdbuf_find_read_ahead_stream (dd, block);
+    if (stream != NULL)
+    {
+      /*
+       * A hit at the trigger shows that the blocks read ahead are used, so
+       * read more of them at once.
+       */
+      if (!miss)
+      {
+        stream->window *= 2;
+        if (stream->window > bdbuf_config.max_read_ahead_blocks)
+          stream->window = bdbuf_config.max_read_ahead_blocks;
+      }
+
+      rtems_bdbuf_check_read_ahead_trigger (stream, block);
+    }
+    else if (miss)
+    {
+      stream = rtems_bdbuf_set_read_ahead_trigger (dd, block);
+    }
+
+    if (stream != NULL)
+      stream->last_access = ++dd->read_ahead_clock;
+
+    rtems_bdbuf_unlock_cache ();
   }
 }
 
+static void
+rtems_bdbuf_count_read_access (rtems_disk_device *dd, bool miss)
+{
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
+
+  if (miss)
+    ++dd->stats.read_misses;
+  else
+    ++dd->stats.read_hits;
+
+  rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
+}
+
 rtems_status_code
 rtems_bdbuf_read (rtems_disk_device   *dd,
                   rtems_blkdev_bnum    block,
@@ -2300,31 +2689,30 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 {
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer   *bd = NULL;
+  rtems_bdbuf_shard    *shard = NULL;
   rtems_blkdev_bnum     media_block;
+  bool                  miss = false;
 
-  rtems_bdbuf_lock_cache ();
-
-  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  sc = rtems_bdbuf_lock_shard_of_block (dd, block, &shard, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
     if (rtems_bdbuf_tracer)
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
-        ++dd->stats.read_hits;
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        ++dd->stats.read_hits;
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
-        ++dd->stats.read_misses;
-        rtems_bdbuf_set_read_ahead_trigger (dd, block);
+        miss = true;
         sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
         if (sc == RTEMS_SUCCESSFUL)
         {
@@ -2342,10 +2730,11 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
-  }
+    rtems_bdbuf_count_read_access (dd, miss);
+    rtems_bdbuf_update_read_ahead (dd, block, miss);
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   *bd_ptr = bd;
 
@@ -2353,7 +2742,7 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_shard (rtems_bdbuf_buffer *bd, const char *kind)
 {
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
@@ -2362,7 +2751,7 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2372,7 +2761,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2396,7 +2785,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2406,7 +2795,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release modified");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2428,7 +2817,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2438,7 +2827,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "sync");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2460,7 +2849,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2478,6 +2867,12 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
    * sync lock can only be obtained with the cache unlocked.
    */
   rtems_bdbuf_lock_sync ();
+
+  /*
+   * Make the modified releases for the device wait for the sync lock.
+   */
+  rtems_bdbuf_set_shard_sync_device (dd);
+
   rtems_bdbuf_lock_cache ();
 
   /*
@@ -2588,7 +2983,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, NULL);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2615,20 +3010,25 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
+ * @param shard The locked shard of the chain.
  * @param chain The modified chain to process.
  * @param transfer The chain to append buffers to be written too.
  * @param sync_active If true this is a sync operation so expire all timers.
  * @param update_timers If true update the timers.
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
+ * @param dirty_excess Expire the timers of the first buffers of the chain up
+ *                     to this size in minimum size buffers.
  */
 static void
 rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+                                         rtems_bdbuf_shard   *shard,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
                                          bool                 sync_active,
                                          bool                 update_timers,
-                                         uint32_t             timer_delta)
+                                         uint32_t             timer_delta,
+                                         size_t               dirty_excess)
 {
   if (!rtems_chain_is_empty (chain))
   {
@@ -2657,8 +3057,20 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (shard))
+        bd->hold_timer = 0;
+
+      /*
+       * The modified list is in release order, so the oldest buffers are
+       * written early if the shard exceeds the dirty ratio.
+       */
+      if (dirty_excess > 0)
+      {
+        size_t bd_size = rtems_bdbuf_bd_size (bd);
+
         bd->hold_timer = 0;
+        dirty_excess -= bd_size < dirty_excess ? bd_size : dirty_excess;
+      }
 
       if (bd->hold_timer)
       {
@@ -2729,13 +3141,159 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
   }
 }
 
+/**
+ * Return the size of the modified buffers of a shard beyond the dirty ratio in
+ * minimum size buffers.
+ */
+static size_t
+rtems_bdbuf_swapout_dirty_excess (const rtems_bdbuf_shard *shard)
+{
+  size_t dirty = shard->modified_size;
+  size_t limit;
+
+  if (bdbuf_config.swapout_dirty_ratio == 0)
+    return 0;
+
+  limit = (shard->capacity * bdbuf_config.swapout_dirty_ratio) / 100;
+
+  return dirty > limit ? dirty - limit : 0;
+}
+
+/**
+ * Take a modified buffer of the shard for the swapout transfer.
+ *
+ * @retval NULL The block has no modified buffer in this shard.
+ * @return The buffer in the transfer state.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_swapout_take_neighbour (rtems_disk_device *dd,
+                                    rtems_bdbuf_shard *shard,
+                                    rtems_blkdev_bnum  block)
+{
+  rtems_bdbuf_buffer *bd;
+
+  if (rtems_bdbuf_shard_of_block (dd, block) != shard)
+    return NULL;
+
+  bd = rtems_bdbuf_hash_search (&shard->index, dd, block);
+  if (bd == NULL || bd->state != RTEMS_BDBUF_STATE_MODIFIED)
+    return NULL;
+
+  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+  rtems_chain_extract_unprotected (&bd->link);
+
+  return bd;
+}
+
+/**
+ * Extend the runs of consecutive blocks on the transfer chain with the
+ * modified neighbours in the shard, even if their hold timer has not expired.
+ * A run is written with fewer requests and the neighbours need no write of
+ * their own later. The transfer chain stays sorted by block. A run stops at a
+ * neighbour of another shard, so the caller repeats the merge over all shards
+ * until no run is extended.
+ *
+ * @param dd The device of the transfer.
+ * @param shard The locked shard.
+ * @param transfer The sorted transfer chain.
+ *
+ * @retval true At least one neighbour was added to the transfer chain.
+ * @retval false The transfer chain is unchanged.
+ */
+static bool
+rtems_bdbuf_swapout_merge_runs (rtems_disk_device   *dd,
+                                rtems_bdbuf_shard   *shard,
+                                rtems_chain_control *transfer)
+{
+  rtems_blkdev_bnum step = dd->media_blocks_per_block;
+  rtems_chain_node* node = rtems_chain_first (transfer);
+  bool              merged = false;
+
+  while (!rtems_chain_is_tail (transfer, node))
+  {
+    rtems_chain_node*   previous = rtems_chain_previous (node);
+    rtems_chain_node*   next = rtems_chain_next (node);
+    rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+    rtems_bdbuf_buffer* neighbour;
+
+    /*
+     * Extend the run downwards. The neighbours are inserted in front of the
+     * current buffer, so they are not visited again.
+     */
+    while (bd->block >= step
+           && (rtems_chain_is_head (transfer, previous)
+               || ((rtems_bdbuf_buffer*) previous)->block != bd->block - step)
+           && (neighbour =
+                 rtems_bdbuf_swapout_take_neighbour (dd, shard,
+                                                     bd->block - step))
+              != NULL)
+    {
+      rtems_chain_insert_unprotected (previous, &neighbour->link);
+      bd = neighbour;
+      merged = true;
+    }
+
+    /*
+     * Extend the run upwards. The neighbour is visited next and extends the
+     * run further.
+     */
+    bd = (rtems_bdbuf_buffer*) node;
+    if ((rtems_chain_is_tail (transfer, next)
+         || ((rtems_bdbuf_buffer*) next)->block != bd->block + step)
+        && (neighbour = rtems_bdbuf_swapout_take_neighbour (dd, shard,
+                                                            bd->block + step))
+           != NULL)
+    {
+      rtems_chain_insert_unprotected (node, &neighbour->link);
+      merged = true;
+    }
+
+    node = rtems_chain_next (node);
+  }
+
+  return merged;
+}
+
+/**
+ * Rotate the sorted transfer chain so that the writes start at the write
+ * position of the device and wrap around to the lowest blocks afterwards. The
+ * write position moves behind the last block of the transfer.
+ *
+ * @param dd The device of the transfer.
+ * @param transfer The sorted transfer chain.
+ */
+static void
+rtems_bdbuf_swapout_elevator (rtems_disk_device   *dd,
+                              rtems_chain_control *transfer)
+{
+  rtems_chain_node*   node = rtems_chain_first (transfer);
+  rtems_bdbuf_buffer* last;
+
+  while (!rtems_chain_is_tail (transfer, node)
+         && ((rtems_bdbuf_buffer*) node)->block < dd->write_position)
+    node = rtems_chain_next (node);
+
+  if (!rtems_chain_is_tail (transfer, node))
+  {
+    while (rtems_chain_first (transfer) != node)
+    {
+      rtems_chain_node* first = rtems_chain_get_first_unprotected (transfer);
+
+      rtems_chain_append_unprotected (transfer, first);
+    }
+  }
+
+  last = (rtems_bdbuf_buffer*) rtems_chain_last (transfer);
+  dd->write_position = last->block + dd->media_blocks_per_block;
+}
+
 /**
  * Process the cache's modified buffers. Check the sync list first then the
  * modified list extracting the buffers suitable to be written to disk. We have
  * a device at a time. The task level loop will repeat this operation while
  * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * back on the modified list and try again later. The shards are locked one
+ * at a time and no lock is owned while the buffers are being written to disk.
  *
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
@@ -2753,6 +3311,7 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
+  size_t                      s;
 
   rtems_bdbuf_lock_cache ();
 
@@ -2792,38 +3351,80 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   if (sync_active)
     transfer->dd = bdbuf_cache.sync_device;
 
-  /*
-   * If we have any buffers in the sync queue move them to the modified
-   * list. The first sync buffer will select the device we use.
-   */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
-                                           &transfer->bds,
-                                           true, false,
-                                           timer_delta);
+  rtems_bdbuf_unlock_cache ();
 
   /*
-   * Process the cache's modified list.
+   * If we have any buffers in the sync queues move them to the modified
+   * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
-                                           &transfer->bds,
-                                           sync_active,
-                                           update_timers,
-                                           timer_delta);
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards [s];
+
+    rtems_bdbuf_lock_shard (shard);
+    rtems_bdbuf_swapout_modified_processing (&transfer->dd,
+                                             shard,
+                                             &shard->sync,
+                                             &transfer->bds,
+                                             true, false,
+                                             timer_delta, 0);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
+   * Process the modified lists of the shards. The shard can be unlocked
+   * afterwards because the state of each gathered buffer has been set to
    * TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards [s];
+    size_t             dirty_excess;
+
+    rtems_bdbuf_lock_shard (shard);
+    dirty_excess = rtems_bdbuf_swapout_dirty_excess (shard);
+    rtems_bdbuf_swapout_modified_processing (&transfer->dd,
+                                             shard,
+                                             &shard->modified,
+                                             &transfer->bds,
+                                             sync_active,
+                                             update_timers,
+                                             timer_delta,
+                                             dirty_excess);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
-   * If there are buffers to transfer to the media transfer them.
+   * If there are buffers to transfer to the media transfer them. Merge the
+   * modified neighbours of all shards into the runs and order the transfer
+   * for the elevator first. A neighbour of one shard may extend a run to a
+   * neighbour of a shard merged before, so repeat until no run is extended.
+   * This terminates since each extension takes a modified buffer. Only the
+   * swapout task changes the write position.
    */
   if (!rtems_chain_is_empty (&transfer->bds))
   {
+    bool merged;
+
+    do
+    {
+      merged = false;
+
+      for (s = 0; s < bdbuf_cache.shard_count; ++s)
+      {
+        rtems_bdbuf_shard* shard = &bdbuf_cache.shards [s];
+
+        rtems_bdbuf_lock_shard (shard);
+        if (rtems_bdbuf_swapout_merge_runs (transfer->dd, shard,
+                                            &transfer->bds))
+          merged = true;
+        rtems_bdbuf_unlock_shard (shard);
+      }
+    }
+    while (merged && bdbuf_cache.shard_count > 1);
+
+    rtems_bdbuf_swapout_elevator (transfer->dd, &transfer->bds);
+
     if (worker)
     {
       rtems_status_code sc = rtems_event_send (worker->id,
@@ -2847,6 +3448,7 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
     bdbuf_cache.sync_active = false;
     bdbuf_cache.sync_requester = 0;
     rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_set_shard_sync_device (BDBUF_INVALID_DEV);
     if (sync_requester)
       rtems_event_transient_send (sync_requester);
   }
@@ -2990,7 +3592,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_shard   *shard,
+                        rtems_chain_control *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -3006,22 +3609,26 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_shard *shard,
+                              rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
-
-  *prev = NULL;
+  rtems_bdbuf_hash_slot *slots = shard->index.slots;
+  size_t                 i;
 
-  while (cur != NULL)
+  /*
+   * The gathering does not change the hash index, so a linear scan over the
+   * slot table visits every indexed buffer exactly once.
+   */
+  for (i = 0; i <= shard->index.mask; ++i)
   {
-    if (cur->dd == dd)
+    rtems_bdbuf_buffer *cur = slots [i].bd;
+
+    if (cur != NULL && cur->dd == dd)
     {
       switch (cur->state)
       {
@@ -3031,7 +3638,7 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
         case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
           break;
         case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+          rtems_bdbuf_wake (&shard->transfer_waiters);
           /* Fall through */
         case RTEMS_BDBUF_STATE_MODIFIED:
           rtems_bdbuf_group_release (cur);
@@ -3052,57 +3659,38 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
           rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
       }
     }
-
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
-    {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
-      {
-        /* Up */
-        cur = *prev;
-        --prev;
-      }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
-    }
   }
 }
 
+/**
+ * Purge all buffers of a device. All shards must be locked.
+ */
 static void
 rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
 {
   rtems_chain_control purge_list;
+  size_t              s;
 
-  rtems_chain_initialize_empty (&purge_list);
+  rtems_bdbuf_lock_cache ();
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+  rtems_bdbuf_unlock_cache ();
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards [s];
+
+    rtems_chain_initialize_empty (&purge_list);
+    rtems_bdbuf_gather_for_purge (shard, &purge_list, dd);
+    rtems_bdbuf_purge_list (shard, &purge_list);
+  }
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
   rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 }
 
 rtems_status_code
@@ -3119,7 +3707,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
 
   if (block_size > 0)
   {
@@ -3157,7 +3745,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 
   return sc;
 }
@@ -3176,43 +3764,69 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 
     while ((node = rtems_chain_get_unprotected (chain)) != NULL)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
+      rtems_blkdev_read_ahead *stream =
+        RTEMS_CONTAINER_OF (node, rtems_blkdev_read_ahead, node);
+      rtems_disk_device *dd = stream->dd;
+      rtems_blkdev_bnum block = stream->next;
+      uint32_t window = stream->window;
       rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      rtems_bdbuf_shard *shard = NULL;
+      rtems_status_code sc;
 
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+      rtems_chain_set_off_chain (&stream->node);
 
+      /*
+       * The read-ahead state may change while the cache is unlocked. Update
+       * it only if no one else did it in the meantime.
+       */
+      rtems_bdbuf_unlock_cache ();
+
+      sc = rtems_bdbuf_lock_shard_of_block (dd, block, &shard, &media_block);
       if (sc == RTEMS_SUCCESSFUL)
       {
         rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+          rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
         if (bd != NULL)
         {
           uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          rtems_interrupt_lock_context lock_context;
 
-          if (transfer_count >= max_transfer_count)
-          {
-            transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
-          }
-          else
+          if (transfer_count > window)
+            transfer_count = window;
+
+          rtems_bdbuf_lock_cache ();
+          if (stream->next == block)
           {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+            if (transfer_count == window)
+            {
+              stream->trigger = block + transfer_count / 2;
+              stream->next = block + transfer_count;
+            }
+            else
+            {
+              stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+            }
           }
+          rtems_bdbuf_unlock_cache ();
 
+          rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock,
+                                        &lock_context);
           ++dd->stats.read_ahead_transfers;
+          rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock,
+                                        &lock_context);
+
           rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
         }
+
+        rtems_bdbuf_unlock_shard (shard);
+        rtems_bdbuf_lock_cache ();
       }
       else
       {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_lock_cache ();
+        if (stream->next == block)
+          stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
       }
     }
 
@@ -3225,14 +3839,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire (&rtems_bdbuf_stats_lock, &lock_context);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_interrupt_lock_release (&rtems_bdbuf_stats_lock, &lock_context);
 }
@@ -51,6 +51,8 @@ void rtems_blkdev_print_stats(
      " WRITE TRANSFERS      | %" PRIu32 "\n"
      " WRITE BLOCKS         | %" PRIu32 "\n"
      " WRITE ERRORS         | %" PRIu32 "\n"
+     " GHOST HITS           | %" PRIu32 "\n"
+     " READ AHEAD WASTED    | %" PRIu32 "\n"
      "----------------------+--------------------------------------------------------\n",
      media_block_size,
      media_block_count,
@@ -62,6 +64,8 @@ void rtems_blkdev_print_stats(
      stats->read_errors,
      stats->write_transfers,
      stats->write_blocks,
-     stats->write_errors
+     stats->write_errors,
+     stats->ghost_hits,
+     stats->read_ahead_wasted
   );
 }
@@ -81,6 +81,108 @@ extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 typedef void (*rtems_malloc_dirtier_t)(void *, size_t);
 extern rtems_malloc_dirtier_t rtems_malloc_dirty_helper;
 
+/**
+ * @brief Count of size classes of the per-processor malloc caches.
+ *
+ * The size class @a c caches blocks with an allocatable size of at least
+ * 16 << @a c bytes.
+ */
+#define RTEMS_MALLOC_CACHE_CLASS_COUNT 6
+
+/**
+ * @brief Maximum count of cached blocks per size class and processor.
+ */
+#define RTEMS_MALLOC_CACHE_CAPACITY 16
+
+/**
+ * @brief Count of blocks moved from or to the C program heap at once.
+ */
+#define RTEMS_MALLOC_CACHE_BATCH ( RTEMS_MALLOC_CACHE_CAPACITY / 2 )
+
+/**
+ * @brief Statistics of the per-processor malloc caches.
+ */
+typedef struct {
+  /**
+   * @brief Count of allocations satisfied by a cache.
+   */
+  uint32_t alloc_hits;
+
+  /**
+   * @brief Count of allocations which had to refill a cache.
+   */
+  uint32_t alloc_misses;
+
+  /**
+   * @brief Count of frees which put the block into a cache.
+   */
+  uint32_t free_hits;
+
+  /**
+   * @brief Count of frees which had to drain a cache.
+   */
+  uint32_t free_misses;
+
+  /**
+   * @brief Count of blocks currently held by the caches.
+   */
+  uint32_t cached_blocks;
+
+  /**
+   * @brief Sum of the size classes of the blocks currently held by the
+   * caches in bytes.
+   */
+  uintptr_t cached_bytes;
+} rtems_malloc_cache_information;
+
+/**
+ * @brief A size class of a per-processor malloc cache.
+ *
+ * The free blocks are linked via their first word.
+ */
+typedef struct {
+  void *first;
+  uint32_t count;
+} rtems_malloc_cache_class;
+
+/**
+ * @brief A per-processor malloc cache.
+ */
+typedef struct {
+  rtems_interrupt_lock Lock;
+  rtems_malloc_cache_class Classes[ RTEMS_MALLOC_CACHE_CLASS_COUNT ];
+  rtems_malloc_cache_information Stats;
+} CPU_STRUCTURE_ALIGNMENT rtems_malloc_cache;
+
+/**
+ * @brief The per-processor malloc caches.
+ *
+ * This is @c NULL if the caches are not configured, see
+ * CONFIGURE_MALLOC_PER_CPU_CACHE.  Otherwise it points to a table of
+ * rtems_malloc_cache_count caches indexed by the processor index.
+ */
+extern rtems_malloc_cache * const rtems_malloc_cache_table;
+
+extern const uint32_t rtems_malloc_cache_count;
+
+/**
+ * @brief Returns all blocks held by the per-processor malloc caches to the C
+ * program heap.
+ */
+void rtems_malloc_cache_flush( void );
+
+/**
+ * @brief Gets the statistics of the per-processor malloc caches.
+ *
+ * The statistics of all processors are summed up.
+ *
+ * @param[out] the_info The statistics.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 The caches are not configured or @a the_info is @c NULL.
+ */
+int malloc_cache_info( rtems_malloc_cache_information *the_info );
+
 /**
  *  @brief Dirty Memory Function
  *
@@ -36,6 +36,11 @@ void *malloc(
   if ( !size )
     return (void *) 0;
 
+  return_this = _Malloc_Cache_allocate( size );
+  if ( return_this != NULL ) {
+    return return_this;
+  }
+
   return_this = rtems_heap_allocate_aligned_with_boundary( size, 0, 0 );
   if ( !return_this ) {
     errno = ENOMEM;
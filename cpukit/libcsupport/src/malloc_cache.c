@@ -0,0 +1,449 @@
+/**
+ * @file
+ *
+ * @brief Per-Processor Malloc Caches
+ * @ingroup libcsupport
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "malloc_p.h"
+
+#include <string.h>
+
+#include <rtems/bspIo.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/smp.h>
+
+/*
+ * Each processor has a cache with free blocks of small size classes in front
+ * of the C program heap.  The cache of a processor is protected by an
+ * interrupt lock which is normally only acquired by the owner processor, so
+ * that the common allocation and free operations do not use the allocator
+ * mutex.  A cache miss moves a batch of blocks from or to the C program heap
+ * with one allocator mutex acquisition.
+ *
+ * The heap considers a cached block as allocated.  To detect a double free,
+ * the second word of a cached block contains a marker derived from the block
+ * address.  A marker match is confirmed by a search of the caches, since an
+ * allocated block may contain the marker by chance.
+ */
+
+#define MALLOC_CACHE_MIN_SIZE 16
+
+#define MALLOC_CACHE_MARKER ( (uintptr_t) 0x4d434348 )
+
+static uintptr_t _Malloc_Cache_class_size( size_t c )
+{
+  return (uintptr_t) MALLOC_CACHE_MIN_SIZE << c;
+}
+
+static rtems_malloc_cache *_Malloc_Cache_acquire(
+  rtems_interrupt_lock_context *lock_context
+)
+{
+  rtems_malloc_cache *cache;
+
+  rtems_interrupt_lock_interrupt_disable( lock_context );
+  cache = &rtems_malloc_cache_table[ _SMP_Get_current_processor() ];
+  rtems_interrupt_lock_acquire_isr( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Malloc_Cache_release(
+  rtems_malloc_cache *cache,
+  rtems_interrupt_lock_context *lock_context
+)
+{
+  rtems_interrupt_lock_release( &cache->Lock, lock_context );
+}
+
+static void _Malloc_Cache_set_marker( void *ptr, uintptr_t marker )
+{
+  ( (uintptr_t *) ptr )[ 1 ] = marker;
+}
+
+static bool _Malloc_Cache_has_marker( const void *ptr )
+{
+  return ( (const uintptr_t *) ptr )[ 1 ]
+    == ( (uintptr_t) ptr ^ MALLOC_CACHE_MARKER );
+}
+
+static void _Malloc_Cache_push(
+  rtems_malloc_cache_class *cache_class,
+  void *ptr
+)
+{
+  *(void **) ptr = cache_class->first;
+  _Malloc_Cache_set_marker( ptr, (uintptr_t) ptr ^ MALLOC_CACHE_MARKER );
+  cache_class->first = ptr;
+  ++cache_class->count;
+}
+
+static void *_Malloc_Cache_pop( rtems_malloc_cache_class *cache_class )
+{
+  void *ptr = cache_class->first;
+
+  cache_class->first = *(void **) ptr;
+  _Malloc_Cache_set_marker( ptr, 0 );
+  --cache_class->count;
+
+  return ptr;
+}
+
+static bool _Malloc_Cache_is_enabled( void )
+{
+  return rtems_malloc_cache_table != NULL
+    && _Malloc_System_state() == MALLOC_SYSTEM_STATE_NORMAL;
+}
+
+void _Malloc_Cache_initialize( void )
+{
+  uint32_t cpu_index;
+
+  if ( rtems_malloc_cache_table == NULL ) {
+    return;
+  }
+
+  for ( cpu_index = 0; cpu_index < rtems_malloc_cache_count; ++cpu_index ) {
+    rtems_malloc_cache *cache = &rtems_malloc_cache_table[ cpu_index ];
+
+    memset( cache, 0, sizeof( *cache ) );
+    rtems_interrupt_lock_initialize( &cache->Lock, "Malloc Cache" );
+  }
+}
+
+static void *_Malloc_Cache_refill( size_t c )
+{
+  Heap_Control *heap = RTEMS_Malloc_Heap;
+  uintptr_t class_size = _Malloc_Cache_class_size( c );
+  void *batch[ RTEMS_MALLOC_CACHE_BATCH ];
+  rtems_interrupt_lock_context lock_context;
+  rtems_malloc_cache *cache;
+  rtems_malloc_cache_class *cache_class;
+  void *ptr;
+  size_t n;
+  size_t i;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( n = 0; n < RTEMS_MALLOC_CACHE_BATCH; ++n ) {
+    batch[ n ] = _Heap_Allocate( heap, class_size );
+
+    if ( batch[ n ] == NULL ) {
+      break;
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( n == 0 ) {
+    return NULL;
+  }
+
+  /* The first block is returned to the caller, the others are cached */
+  ptr = batch[ 0 ];
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+  cache_class = &cache->Classes[ c ];
+  ++cache->Stats.alloc_misses;
+
+  for ( i = 1; i < n; ++i ) {
+    _Malloc_Cache_push( cache_class, batch[ i ] );
+  }
+
+  _Malloc_Cache_release( cache, &lock_context );
+
+  return ptr;
+}
+
+void *_Malloc_Cache_allocate( size_t size )
+{
+  rtems_interrupt_lock_context lock_context;
+  rtems_malloc_cache *cache;
+  rtems_malloc_cache_class *cache_class;
+  void *ptr;
+  size_t c;
+
+  if (
+    !_Malloc_Cache_is_enabled()
+      || size > _Malloc_Cache_class_size( RTEMS_MALLOC_CACHE_CLASS_COUNT - 1 )
+  ) {
+    return NULL;
+  }
+
+  c = 0;
+
+  while ( size > _Malloc_Cache_class_size( c ) ) {
+    ++c;
+  }
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+  cache_class = &cache->Classes[ c ];
+
+  if ( cache_class->count > 0 ) {
+    ptr = _Malloc_Cache_pop( cache_class );
+    ++cache->Stats.alloc_hits;
+    _Malloc_Cache_release( cache, &lock_context );
+  } else {
+    _Malloc_Cache_release( cache, &lock_context );
+    ptr = _Malloc_Cache_refill( c );
+  }
+
+  if ( ptr != NULL && rtems_malloc_dirty_helper != NULL ) {
+    (*rtems_malloc_dirty_helper)( ptr, size );
+  }
+
+  return ptr;
+}
+
+static void _Malloc_Cache_free_list( void *first )
+{
+  Heap_Control *heap = RTEMS_Malloc_Heap;
+
+  if ( first == NULL ) {
+    return;
+  }
+
+  _RTEMS_Lock_allocator();
+
+  while ( first != NULL ) {
+    void *next = *(void **) first;
+
+    _Malloc_Cache_set_marker( first, 0 );
+    _Heap_Free( heap, first );
+    first = next;
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+/*
+ * Returns the size class of an allocated block of the C program heap or
+ * RTEMS_MALLOC_CACHE_CLASS_COUNT if the block cannot be cached.  The size of
+ * the block is stable while it is allocated.  Pointers which do not look like
+ * allocated blocks are left to the heap which reports them.
+ *
+ * The cache lock of the current processor must be owned, so that the block
+ * headers are read together with the marker check and the insertion into the
+ * cache.  The heap changes the header of the next block only with the
+ * allocator mutex and keeps its previous used flag while the block is
+ * allocated.
+ */
+static size_t _Malloc_Cache_class_of_block( void *ptr )
+{
+  Heap_Control *heap = RTEMS_Malloc_Heap;
+  uintptr_t alloc_begin = (uintptr_t) ptr;
+  Heap_Block *block;
+  Heap_Block *next_block;
+  uintptr_t alloc_size;
+  size_t c;
+
+  if (
+    alloc_begin < heap->area_begin
+      || alloc_begin >= heap->area_end
+  ) {
+    return RTEMS_MALLOC_CACHE_CLASS_COUNT;
+  }
+
+  block = _Heap_Block_of_alloc_area( alloc_begin, heap->page_size );
+
+  if ( !_Heap_Is_block_in_heap( heap, block ) ) {
+    return RTEMS_MALLOC_CACHE_CLASS_COUNT;
+  }
+
+  next_block = _Heap_Block_at( block, _Heap_Block_size( block ) );
+
+  if (
+    !_Heap_Is_block_in_heap( heap, next_block )
+      || !_Heap_Is_prev_used( next_block )
+  ) {
+    return RTEMS_MALLOC_CACHE_CLASS_COUNT;
+  }
+
+  alloc_size = (uintptr_t) next_block + HEAP_ALLOC_BONUS - alloc_begin;
+
+  if (
+    alloc_size < _Malloc_Cache_class_size( 0 )
+      || alloc_size >= 2 * _Malloc_Cache_class_size(
+        RTEMS_MALLOC_CACHE_CLASS_COUNT - 1
+      )
+  ) {
+    return RTEMS_MALLOC_CACHE_CLASS_COUNT;
+  }
+
+  c = RTEMS_MALLOC_CACHE_CLASS_COUNT - 1;
+
+  while ( alloc_size < _Malloc_Cache_class_size( c ) ) {
+    --c;
+  }
+
+  return c;
+}
+
+/*
+ * Returns true, if the block is in a cache of one of the processors,
+ * otherwise false.  No cache lock may be owned.
+ */
+static bool _Malloc_Cache_contains( size_t c, const void *ptr )
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < rtems_malloc_cache_count; ++cpu_index ) {
+    rtems_malloc_cache *cache = &rtems_malloc_cache_table[ cpu_index ];
+    rtems_interrupt_lock_context lock_context;
+    const void *cached;
+
+    rtems_interrupt_lock_acquire( &cache->Lock, &lock_context );
+    cached = cache->Classes[ c ].first;
+
+    while ( cached != NULL && cached != ptr ) {
+      cached = *(void * const *) cached;
+    }
+
+    rtems_interrupt_lock_release( &cache->Lock, &lock_context );
+
+    if ( cached != NULL ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool _Malloc_Cache_free( void *ptr )
+{
+  rtems_interrupt_lock_context lock_context;
+  rtems_malloc_cache *cache;
+  rtems_malloc_cache_class *cache_class;
+  void *first;
+  void *last;
+  size_t c;
+  size_t i;
+
+  if ( !_Malloc_Cache_is_enabled() ) {
+    return false;
+  }
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+  c = _Malloc_Cache_class_of_block( ptr );
+
+  if ( c >= RTEMS_MALLOC_CACHE_CLASS_COUNT ) {
+    _Malloc_Cache_release( cache, &lock_context );
+    return false;
+  }
+
+  if ( _Malloc_Cache_has_marker( ptr ) ) {
+    _Malloc_Cache_release( cache, &lock_context );
+
+    /*
+     * The heap would accept the block, since it considers cached blocks as
+     * allocated, so report the double free here.
+     */
+    if ( _Malloc_Cache_contains( c, ptr ) ) {
+      printk( "Program heap: double free of %p\n", ptr );
+      return true;
+    }
+
+    cache = _Malloc_Cache_acquire( &lock_context );
+  }
+
+  cache_class = &cache->Classes[ c ];
+  _Malloc_Cache_push( cache_class, ptr );
+
+  if ( cache_class->count <= RTEMS_MALLOC_CACHE_CAPACITY ) {
+    ++cache->Stats.free_hits;
+    _Malloc_Cache_release( cache, &lock_context );
+    return true;
+  }
+
+  /* Drain a batch of blocks to the heap */
+  ++cache->Stats.free_misses;
+  first = cache_class->first;
+  last = first;
+
+  for ( i = 1; i < RTEMS_MALLOC_CACHE_BATCH; ++i ) {
+    last = *(void **) last;
+  }
+
+  cache_class->first = *(void **) last;
+  cache_class->count -= RTEMS_MALLOC_CACHE_BATCH;
+  *(void **) last = NULL;
+
+  _Malloc_Cache_release( cache, &lock_context );
+  _Malloc_Cache_free_list( first );
+
+  return true;
+}
+
+void rtems_malloc_cache_flush( void )
+{
+  uint32_t cpu_index;
+
+  if ( !_Malloc_Cache_is_enabled() ) {
+    return;
+  }
+
+  for ( cpu_index = 0; cpu_index < rtems_malloc_cache_count; ++cpu_index ) {
+    rtems_malloc_cache *cache = &rtems_malloc_cache_table[ cpu_index ];
+    size_t c;
+
+    for ( c = 0; c < RTEMS_MALLOC_CACHE_CLASS_COUNT; ++c ) {
+      rtems_interrupt_lock_context lock_context;
+      void *first;
+
+      rtems_interrupt_lock_acquire( &cache->Lock, &lock_context );
+      first = cache->Classes[ c ].first;
+      cache->Classes[ c ].first = NULL;
+      cache->Classes[ c ].count = 0;
+      rtems_interrupt_lock_release( &cache->Lock, &lock_context );
+
+      _Malloc_Cache_free_list( first );
+    }
+  }
+}
+
+int malloc_cache_info( rtems_malloc_cache_information *the_info )
+{
+  uint32_t cpu_index;
+
+  if ( the_info == NULL || rtems_malloc_cache_table == NULL ) {
+    return -1;
+  }
+
+  memset( the_info, 0, sizeof( *the_info ) );
+
+  for ( cpu_index = 0; cpu_index < rtems_malloc_cache_count; ++cpu_index ) {
+    rtems_malloc_cache *cache = &rtems_malloc_cache_table[ cpu_index ];
+    rtems_interrupt_lock_context lock_context;
+    size_t c;
+
+    rtems_interrupt_lock_acquire( &cache->Lock, &lock_context );
+
+    the_info->alloc_hits += cache->Stats.alloc_hits;
+    the_info->alloc_misses += cache->Stats.alloc_misses;
+    the_info->free_hits += cache->Stats.free_hits;
+    the_info->free_misses += cache->Stats.free_misses;
+
+    for ( c = 0; c < RTEMS_MALLOC_CACHE_CLASS_COUNT; ++c ) {
+      uint32_t count = cache->Classes[ c ].count;
+
+      the_info->cached_blocks += count;
+      the_info->cached_bytes += count * _Malloc_Cache_class_size( c );
+    }
+
+    rtems_interrupt_lock_release( &cache->Lock, &lock_context );
+  }
+
+  return 0;
+}
@@ -95,6 +95,22 @@ void *rtems_heap_allocate_aligned_with_boundary(
         boundary
       );
       _RTEMS_Unlock_allocator();
+
+      if ( p == NULL && rtems_malloc_cache_table != NULL ) {
+        /*
+         *  The per-processor caches may hold enough memory, so give it back
+         *  and try again.
+         */
+        rtems_malloc_cache_flush();
+        _RTEMS_Lock_allocator();
+        p = _Heap_Allocate_aligned_with_boundary(
+          heap,
+          size,
+          alignment,
+          boundary
+        );
+        _RTEMS_Unlock_allocator();
+      }
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
       p = _Heap_Allocate_aligned_with_boundary(
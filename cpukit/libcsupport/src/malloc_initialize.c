@@ -31,10 +31,17 @@ void RTEMS_Malloc_Initialize(
   Heap_Control *heap = RTEMS_Malloc_Heap;
 
   if ( !rtems_configuration_get_unified_work_area() ) {
-    Heap_Initialization_or_extend_handler init_or_extend = _Heap_Initialize;
+    Heap_Initialization_or_extend_handler init = _Heap_Initialize;
+    Heap_Initialization_or_extend_handler init_or_extend;
     uintptr_t page_size = CPU_HEAP_ALIGNMENT;
     size_t i;
 
+    if ( rtems_configuration_get_heap_segregated_fit() ) {
+      init = _Heap_Initialize_segregated_fit;
+    }
+
+    init_or_extend = init;
+
     for (i = 0; i < area_count; ++i) {
       const Heap_Area *area = &areas [i];
       uintptr_t space_available = (*init_or_extend)(
@@ -49,10 +56,12 @@ void RTEMS_Malloc_Initialize(
       }
     }
 
-    if ( init_or_extend == _Heap_Initialize ) {
+    if ( init_or_extend == init ) {
       _Internal_error( INTERNAL_ERROR_NO_MEMORY_FOR_HEAP );
     }
   }
+
+  _Malloc_Cache_initialize();
 }
 #else
 void RTEMS_Malloc_Initialize(
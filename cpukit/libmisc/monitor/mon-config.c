@@ -118,26 +118,26 @@ rtems_monitor_config_dump(
     length += fprintf(stdout,"MAXIMUMS");
     length += rtems_monitor_pad(DATACOL, length);
     length += fprintf(stdout,"tasks: %" PRId32 "%c;  timers: %" PRId32 "%c;  sems: %" PRId32 "%c;  que's: %" PRId32 "%c;  ext's: %" PRId32 "%c;\n",
-                     monitor_config->maximum_tasks & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_tasks & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_timers & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_timers & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_semaphores & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_semaphores & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_message_queues & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_message_queues & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_extensions & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_extensions & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+');
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_tasks),
+                     rtems_resource_is_unlimited(monitor_config->maximum_tasks) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_timers),
+                     rtems_resource_is_unlimited(monitor_config->maximum_timers) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_semaphores),
+                     rtems_resource_is_unlimited(monitor_config->maximum_semaphores) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_message_queues),
+                     rtems_resource_is_unlimited(monitor_config->maximum_message_queues) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_extensions),
+                     rtems_resource_is_unlimited(monitor_config->maximum_extensions) ? '+' : ' ');
     length = 0;
     length += rtems_monitor_pad(CONTCOL, length);
     length += fprintf(stdout,"partitions: %" PRId32 "%c;  regions: %" PRId32 "%c;  ports: %" PRId32 "%c;  periods: %" PRId32 "%c;\n",
-                     monitor_config->maximum_partitions & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_partitions & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_regions & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_regions & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_ports & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_ports & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+',
-                     monitor_config->maximum_periods & ~OBJECTS_UNLIMITED_OBJECTS,
-                     (monitor_config->maximum_periods & OBJECTS_UNLIMITED_OBJECTS) == 0 ? ' ' : '+');
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_partitions),
+                     rtems_resource_is_unlimited(monitor_config->maximum_partitions) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_regions),
+                     rtems_resource_is_unlimited(monitor_config->maximum_regions) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_ports),
+                     rtems_resource_is_unlimited(monitor_config->maximum_ports) ? '+' : ' ',
+                     (uint32_t) rtems_resource_maximum_per_allocation(monitor_config->maximum_periods),
+                     rtems_resource_is_unlimited(monitor_config->maximum_periods) ? '+' : ' ');
     return length;
 }
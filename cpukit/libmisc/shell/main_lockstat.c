@@ -0,0 +1,211 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#define __need_getopt_newlib
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/profiling.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+#include <rtems/stringto.h>
+
+#define LOCKSTAT_DEFAULT_COUNT 10
+
+#define LOCKSTAT_NAME_SIZE 32
+
+typedef struct {
+  rtems_profiling_smp_lock data;
+  uint64_t contended_count;
+  char name[LOCKSTAT_NAME_SIZE];
+} lockstat_entry;
+
+typedef struct {
+  lockstat_entry *entries;
+  size_t capacity;
+  size_t count;
+  size_t lock_count;
+} lockstat_context;
+
+static uint64_t lockstat_contended_count(const rtems_profiling_smp_lock *data)
+{
+  uint64_t contended = 0;
+  size_t i;
+
+  for (i = 1; i < RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS; ++i) {
+    contended += data->contention_counts[i];
+  }
+
+  return contended;
+}
+
+static bool lockstat_is_hotter(
+  const lockstat_entry *a,
+  uint64_t contended_count,
+  const rtems_profiling_smp_lock *b
+)
+{
+  if (a->contended_count != contended_count) {
+    return a->contended_count > contended_count;
+  }
+
+  return a->data.total_acquire_time > b->total_acquire_time;
+}
+
+static void lockstat_visitor(void *arg, const rtems_profiling_data *data)
+{
+  lockstat_context *ctx = arg;
+  const rtems_profiling_smp_lock *smp_lock;
+  uint64_t contended_count;
+  lockstat_entry *entry;
+  size_t i;
+
+  if (data->header.type != RTEMS_PROFILING_SMP_LOCK) {
+    return;
+  }
+
+  ++ctx->lock_count;
+  smp_lock = &data->smp_lock;
+  contended_count = lockstat_contended_count(smp_lock);
+
+  /* Keep the entries sorted, the hottest lock first */
+  i = ctx->count;
+
+  while (
+    i > 0
+      && !lockstat_is_hotter(&ctx->entries[i - 1], contended_count, smp_lock)
+  ) {
+    --i;
+  }
+
+  if (i >= ctx->capacity) {
+    return;
+  }
+
+  if (ctx->count < ctx->capacity) {
+    ++ctx->count;
+  }
+
+  memmove(
+    &ctx->entries[i + 1],
+    &ctx->entries[i],
+    (ctx->count - i - 1) * sizeof(ctx->entries[0])
+  );
+
+  entry = &ctx->entries[i];
+  entry->data = *smp_lock;
+  entry->contended_count = contended_count;
+  entry->data.name = NULL;
+  strlcpy(&entry->name[0], smp_lock->name, sizeof(entry->name));
+}
+
+static uint64_t lockstat_average(uint64_t total, uint64_t count)
+{
+  return count != 0 ? total / count : 0;
+}
+
+static void lockstat_print(const lockstat_context *ctx)
+{
+  size_t i;
+
+  printf(
+    "%-*s %12s %12s %8s %8s %8s %8s\n",
+    LOCKSTAT_NAME_SIZE - 1,
+    "NAME",
+    "USAGE",
+    "CONTENDED",
+    "AVG ACQ",
+    "MAX ACQ",
+    "AVG SEC",
+    "MAX SEC"
+  );
+
+  for (i = 0; i < ctx->count; ++i) {
+    const lockstat_entry *entry = &ctx->entries[i];
+    const rtems_profiling_smp_lock *data = &entry->data;
+
+    printf(
+      "%-*s %12" PRIu64 " %12" PRIu64 " %8" PRIu64 " %8" PRIu32
+        " %8" PRIu64 " %8" PRIu32 "\n",
+      LOCKSTAT_NAME_SIZE - 1,
+      &entry->name[0],
+      data->usage_count,
+      entry->contended_count,
+      lockstat_average(data->total_acquire_time, data->usage_count),
+      data->max_acquire_time,
+      lockstat_average(data->total_section_time, data->usage_count),
+      data->max_section_time
+    );
+  }
+
+  printf(
+    "%zu of %zu SMP locks shown, times in nanoseconds\n",
+    ctx->count,
+    ctx->lock_count
+  );
+}
+
+static int rtems_shell_main_lockstat(int argc, char **argv)
+{
+  int c;
+  struct getopt_data optdata;
+  lockstat_context ctx;
+  unsigned long count = LOCKSTAT_DEFAULT_COUNT;
+
+  memset(&optdata, 0, sizeof(optdata));
+
+  while ((c = getopt_r(argc, argv, "rn:", &optdata)) != -1) {
+    switch (c) {
+      case 'r':
+        rtems_profiling_reset();
+        return 0;
+      case 'n':
+        if (
+          rtems_string_to_unsigned_long(optdata.optarg, &count, NULL, 0)
+            != RTEMS_SUCCESSFUL
+            || count == 0
+        ) {
+          fprintf(stderr, "%s: invalid count: %s\n", argv[0], optdata.optarg);
+          return 1;
+        }
+        break;
+      default:
+        fprintf(stderr, "%s: [-r] [-n count]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.capacity = count;
+  ctx.entries = calloc(count, sizeof(ctx.entries[0]));
+
+  if (ctx.entries == NULL) {
+    fprintf(stderr, "%s: not enough memory\n", argv[0]);
+    return 1;
+  }
+
+  rtems_profiling_iterate(lockstat_visitor, &ctx);
+  lockstat_print(&ctx);
+  free(ctx.entries);
+
+  return 0;
+}
+
+rtems_shell_cmd_t rtems_shell_LOCKSTAT_Command = {
+  .name = "lockstat",
+  .usage = "[-r] [-n count]\n"
+    " -r  reset the profiling statistics\n"
+    " -n  print the count most contended SMP locks (default 10)\n",
+  .topic = "rtems",
+  .command = rtems_shell_main_lockstat
+};
@@ -32,12 +32,30 @@ static int rtems_shell_main_malloc_info(
     malloc_walk( 0, true );
   } else {
     region_information_block info;
+    rtems_malloc_cache_information cache_info;
 
     rtems_shell_print_unified_work_area_message();
     malloc_info( &info );
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+
+    if ( malloc_cache_info( &cache_info ) == 0 ) {
+      printf(
+        "Cache allocation hits:                    %12" PRIu32 "\n"
+        "Cache allocation misses:                  %12" PRIu32 "\n"
+        "Cache free hits:                          %12" PRIu32 "\n"
+        "Cache free misses:                        %12" PRIu32 "\n"
+        "Number of cached blocks:                  %12" PRIu32 "\n"
+        "Total bytes cached:                       %12" PRIuPTR "\n",
+        cache_info.alloc_hits,
+        cache_info.alloc_misses,
+        cache_info.free_hits,
+        cache_info.free_misses,
+        cache_info.cached_blocks,
+        cache_info.cached_bytes
+      );
+    }
   }
 
   return 0;
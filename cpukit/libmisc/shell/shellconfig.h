@@ -86,6 +86,7 @@ extern rtems_shell_cmd_t rtems_shell_TOP_Command;
 extern rtems_shell_cmd_t rtems_shell_STACKUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PERIODUSE_Command;
 extern rtems_shell_cmd_t rtems_shell_PROFREPORT_Command;
+extern rtems_shell_cmd_t rtems_shell_LOCKSTAT_Command;
 extern rtems_shell_cmd_t rtems_shell_WKSPACE_INFO_Command;
 extern rtems_shell_cmd_t rtems_shell_MALLOC_INFO_Command;
 extern rtems_shell_cmd_t rtems_shell_RTRACE_Command;
@@ -461,6 +462,11 @@ extern rtems_shell_alias_t * const rtems_shell_Initial_aliases[];
         defined(CONFIGURE_SHELL_COMMAND_PROFREPORT)
       &rtems_shell_PROFREPORT_Command,
     #endif
+    #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
+         !defined(CONFIGURE_SHELL_NO_COMMAND_LOCKSTAT)) || \
+        defined(CONFIGURE_SHELL_COMMAND_LOCKSTAT)
+      &rtems_shell_LOCKSTAT_Command,
+    #endif
     #if (defined(CONFIGURE_SHELL_COMMANDS_ALL) && \
          !defined(CONFIGURE_SHELL_NO_COMMAND_WKSPACE_INFO)) || \
         defined(CONFIGURE_SHELL_COMMAND_WKSPACE_INFO)
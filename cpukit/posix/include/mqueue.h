@@ -77,6 +77,17 @@ struct mq_attr {
   long  mq_curmsgs;
 };
 
+/**
+ * @brief Zero-copy message queue flag.
+ *
+ * This is an RTEMS extension.  In case this flag is set in the mq_flags of
+ * the attributes used by mq_open() to create a message queue, then the
+ * ownership of message buffers is passed to the receivers instead of copying
+ * the message content.  Messages must be received via
+ * mq_receive_buffer_np().  Senders do not block on such message queues.
+ */
+#define MQ_ZERO_COPY 0x40000000L
+
 /**
  * 15.2.2 Open a Message Queue, P1003.1b-1993, p. 272
  */
@@ -206,6 +217,68 @@ int mq_getattr(
   struct mq_attr *mqstat
 );
 
+/**
+ * @brief Get a message buffer from a zero-copy message queue.
+ *
+ * This is an RTEMS extension.  The calling thread becomes the owner of a
+ * message buffer of the message queue created with the MQ_ZERO_COPY flag.
+ * It may fill in the message in place and send it via mq_send_buffer_np() or
+ * give it back via mq_release_buffer_np().  This function does not block.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred, errno is set to EBADF, EINVAL or EAGAIN.
+ */
+int mq_get_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_ptr
+);
+
+/**
+ * @brief Send a message buffer to a zero-copy message queue.
+ *
+ * This is an RTEMS extension.  The ownership of the message buffer is passed
+ * to the message queue.  The message content is not copied.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred, errno is set to EBADF, EINVAL or EMSGSIZE.
+ */
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_ptr,
+  size_t        msg_len,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receive a message buffer from a zero-copy message queue.
+ *
+ * This is an RTEMS extension.  The calling thread becomes the owner of the
+ * message buffer of the received message.  It must give back the message
+ * buffer via mq_release_buffer_np() or send it via mq_send_buffer_np() after
+ * use.
+ *
+ * @return The length of the received message or -1 if an error occurred.
+ */
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **msg_ptr,
+  unsigned int  *msg_prio
+);
+
+/**
+ * @brief Release a message buffer to a zero-copy message queue.
+ *
+ * This is an RTEMS extension.  All message buffers must be released before
+ * the message queue is removed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred, errno is set to EBADF or EINVAL.
+ */
+int mq_release_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_ptr
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -139,11 +139,51 @@ RTEMS_INLINE_ROUTINE void *_POSIX_Keys_Key_value_map( RBTree_Node *node )
   return POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
 }
 
+/**
+ * @brief Returns the key value pair slot index of the key.
+ *
+ * The slot index is greater than or equal to THREAD_KEYS_SLOT_COUNT in case
+ * the key has no slot.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _POSIX_Keys_Key_value_slot( pthread_key_t key )
+{
+  /* Object indices start at one */
+  return (uint32_t) _Objects_Get_index( (Objects_Id) key ) - 1;
+}
+
 RTEMS_INLINE_ROUTINE POSIX_Keys_Key_value_pair *_POSIX_Keys_Key_value_find(
   pthread_key_t         key,
   const Thread_Control *the_thread
 )
 {
+  uint32_t slot;
+
+  slot = _POSIX_Keys_Key_value_slot( key );
+
+  if ( slot < THREAD_KEYS_SLOT_COUNT ) {
+    RBTree_Node               *node;
+    POSIX_Keys_Key_value_pair *key_value_pair;
+
+    /*
+     * At most one key with this index exists at a time, so the slot contains
+     * the only possible key value pair.  A stale key identifier with the same
+     * index must not see the value of the current key.
+     */
+    node = the_thread->Keys.Slots[ slot ];
+
+    if ( node == NULL ) {
+      return NULL;
+    }
+
+    key_value_pair = POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
+
+    if ( key_value_pair->key != key ) {
+      return NULL;
+    }
+
+    return key_value_pair;
+  }
+
   return _RBTree_Find_inline(
     &the_thread->Keys.Key_value_pairs,
     &key,
@@ -159,12 +199,39 @@ RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_insert(
   Thread_Control            *the_thread
 )
 {
+  uint32_t slot;
+
   _RBTree_Insert_inline(
     &the_thread->Keys.Key_value_pairs,
     &key_value_pair->Lookup_node,
     &key,
     _POSIX_Keys_Key_value_less
   );
+
+  slot = _POSIX_Keys_Key_value_slot( key );
+
+  if ( slot < THREAD_KEYS_SLOT_COUNT ) {
+    the_thread->Keys.Slots[ slot ] = &key_value_pair->Lookup_node;
+  }
+}
+
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_extract(
+  POSIX_Keys_Key_value_pair *key_value_pair,
+  Thread_Control            *the_thread
+)
+{
+  uint32_t slot;
+
+  _RBTree_Extract(
+    &the_thread->Keys.Key_value_pairs,
+    &key_value_pair->Lookup_node
+  );
+
+  slot = _POSIX_Keys_Key_value_slot( key_value_pair->key );
+
+  if ( slot < THREAD_KEYS_SLOT_COUNT ) {
+    the_thread->Keys.Slots[ slot ] = NULL;
+  }
 }
 
 /** @} */
@@ -68,24 +68,40 @@ typedef enum {
  */
 extern const pthread_mutexattr_t _POSIX_Mutex_Default_attributes;
 
-RTEMS_INLINE_ROUTINE Thread_Control *_POSIX_Mutex_Acquire(
-  POSIX_Mutex_Control  *the_mutex,
+RTEMS_INLINE_ROUTINE Thread_Control *_POSIX_Mutex_ISR_disable(
   Thread_queue_Context *queue_context
 )
 {
-  ISR_Level       level;
-  Thread_Control *executing;
+  ISR_Level level;
 
   _Thread_queue_Context_initialize( queue_context );
   _Thread_queue_Context_ISR_disable( queue_context, level );
   _Thread_queue_Context_set_ISR_level( queue_context, level );
-  executing = _Thread_Executing;
+  return _Thread_Executing;
+}
+
+RTEMS_INLINE_ROUTINE void _POSIX_Mutex_Acquire_critical(
+  POSIX_Mutex_Control  *the_mutex,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+)
+{
   _Thread_queue_Queue_acquire_critical(
     &the_mutex->Recursive.Mutex.Queue.Queue,
     &executing->Potpourri_stats,
     &queue_context->Lock_context.Lock_context
   );
+}
 
+RTEMS_INLINE_ROUTINE Thread_Control *_POSIX_Mutex_Acquire(
+  POSIX_Mutex_Control  *the_mutex,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *executing;
+
+  executing = _POSIX_Mutex_ISR_disable( queue_context );
+  _POSIX_Mutex_Acquire_critical( the_mutex, executing, queue_context );
   return executing;
 }
 
@@ -177,10 +193,12 @@ RTEMS_INLINE_ROUTINE Status_Control _POSIX_Mutex_Seize(
 {
   Thread_Control *owner;
 
-  owner = _POSIX_Mutex_Get_owner( the_mutex );
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &the_mutex->Recursive.Mutex.Queue.Queue,
+    executing
+  );
 
   if ( owner == NULL ) {
-    _POSIX_Mutex_Set_owner( the_mutex, executing );
     _Thread_Resource_count_increment( executing );
     _POSIX_Mutex_Release( the_mutex, queue_context );
     return STATUS_SUCCESSFUL;
@@ -227,11 +245,13 @@ RTEMS_INLINE_ROUTINE Status_Control _POSIX_Mutex_Surrender(
   }
 
   _Thread_Resource_count_decrement( executing );
-  _POSIX_Mutex_Set_owner( the_mutex, NULL );
 
   heads = the_mutex->Recursive.Mutex.Queue.Queue.heads;
 
   if ( heads == NULL ) {
+    _Thread_queue_Queue_clear_owner_critical(
+      &the_mutex->Recursive.Mutex.Queue.Queue
+    );
     _POSIX_Mutex_Release( the_mutex, queue_context );
     return STATUS_SUCCESSFUL;
   }
@@ -88,10 +88,7 @@ static void _POSIX_Keys_Run_destructors( Thread_Control *the_thread )
       key_value_pair = POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
       key = key_value_pair->key;
       value = key_value_pair->value;
-      _RBTree_Extract(
-        &the_thread->Keys.Key_value_pairs,
-        &key_value_pair->Lookup_node
-      );
+      _POSIX_Keys_Key_value_extract( key_value_pair, the_thread );
 
       _POSIX_Keys_Key_value_release( the_thread, &lock_context );
       _POSIX_Keys_Key_value_free( key_value_pair );
@@ -37,10 +37,7 @@ static void _POSIX_Keys_Destroy( POSIX_Keys_Control *the_key )
 
     the_thread = key_value_pair->thread;
     _POSIX_Keys_Key_value_acquire( the_thread, &lock_context );
-    _RBTree_Extract(
-      &the_thread->Keys.Key_value_pairs,
-      &key_value_pair->Lookup_node
-    );
+    _POSIX_Keys_Key_value_extract( key_value_pair, the_thread );
     _POSIX_Keys_Key_value_release( the_thread, &lock_context );
 
     _POSIX_Keys_Key_value_free( key_value_pair );
@@ -101,10 +101,7 @@ static int _POSIX_Keys_Delete_value(
 
     key_value_pair = _POSIX_Keys_Key_value_find( key, executing );
     if ( key_value_pair != NULL ) {
-      _RBTree_Extract(
-        &executing->Keys.Key_value_pairs,
-        &key_value_pair->Lookup_node
-      );
+      _POSIX_Keys_Key_value_extract( key_value_pair, executing );
 
       _POSIX_Keys_Key_value_release( executing, &lock_context );
 
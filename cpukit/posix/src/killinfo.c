@@ -67,7 +67,6 @@ int _POSIX_signals_Send(
   uint32_t                     index;
   uint32_t                     maximum;
   Objects_Information         *the_info;
-  Objects_Control            **object_table;
   Thread_Control              *the_thread;
   Thread_Control              *interested;
   Priority_Control             interested_priority;
@@ -208,10 +207,10 @@ int _POSIX_signals_Send(
       continue;
 
     maximum = the_info->maximum;
-    object_table = the_info->local_table;
 
     for ( index = 1 ; index <= maximum ; index++ ) {
-      the_thread = (Thread_Control *) object_table[ index ];
+      the_thread = (Thread_Control *)
+        _Objects_Get_local_object( the_info, index );
 
       if ( !the_thread )
         continue;
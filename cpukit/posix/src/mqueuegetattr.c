@@ -72,6 +72,10 @@ int mq_getattr(
   mqstat->mq_maxmsg  = the_mq->Message_queue.maximum_pending_messages;
   mqstat->mq_curmsgs = the_mq->Message_queue.number_of_pending_messages;
 
+  if ( the_mq->Message_queue.zero_copy ) {
+    mqstat->mq_flags |= MQ_ZERO_COPY;
+  }
+
   _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
   return 0;
 }
@@ -0,0 +1,70 @@
+/**
+ * @file
+ *
+ * @brief Get a Message Buffer from a Zero-Copy Message Queue
+ * @ingroup POSIX_MQUEUE
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+#include <rtems/posix/posixapi.h>
+
+#include <fcntl.h>
+
+int mq_get_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_ptr
+)
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  if ( msg_ptr == NULL ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if ( ( the_mq->oflag & O_ACCMODE ) == O_RDONLY ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  status = _CORE_message_queue_Get_buffer(
+    &the_mq->Message_queue,
+    &the_message,
+    &queue_context
+  );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_error( status ) );
+  }
+
+  *msg_ptr = the_message->Contents.buffer;
+  return 0;
+}
@@ -100,7 +100,8 @@ static mqd_t _POSIX_Message_queue_Create(
       &the_mq->Message_queue,
       CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO,
       attr->mq_maxmsg,
-      attr->mq_msgsize
+      attr->mq_msgsize,
+      ( attr->mq_flags & MQ_ZERO_COPY ) != 0
     )
   ) {
     _POSIX_Message_queue_Free( the_mq );
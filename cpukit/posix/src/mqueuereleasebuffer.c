@@ -0,0 +1,61 @@
+/**
+ * @file
+ *
+ * @brief Release a Message Buffer to a Zero-Copy Message Queue
+ * @ingroup POSIX_MQUEUE
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+
+int mq_release_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_ptr
+)
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  the_message = _CORE_message_queue_Get_buffer_control(
+    &the_mq->Message_queue,
+    msg_ptr
+  );
+
+  if ( !the_mq->Message_queue.zero_copy || the_message == NULL ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  _CORE_message_queue_Release_buffer(
+    &the_mq->Message_queue,
+    the_message,
+    &queue_context
+  );
+  return 0;
+}
@@ -66,7 +66,23 @@ int _POSIX_Mutex_Lock_support(
   the_mutex = _POSIX_Mutex_Get( mutex );
   POSIX_MUTEX_VALIDATE_OBJECT( the_mutex, flags );
 
-  executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
+  executing = _POSIX_Mutex_ISR_disable( &queue_context );
+
+#if defined(RTEMS_SMP)
+  if (
+    _POSIX_Mutex_Get_protocol( flags ) != POSIX_MUTEX_PRIORITY_CEILING
+      && _Thread_queue_Queue_try_set_owner(
+        &the_mutex->Recursive.Mutex.Queue.Queue,
+        executing
+      )
+  ) {
+    _Thread_Resource_count_increment( executing );
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return 0;
+  }
+#endif
+
+  _POSIX_Mutex_Acquire_critical( the_mutex, executing, &queue_context );
   _Thread_queue_Context_set_enqueue_callout( &queue_context, enqueue_callout);
   _Thread_queue_Context_set_timeout_argument( &queue_context, abstime );
 
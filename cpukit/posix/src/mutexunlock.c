@@ -31,7 +31,10 @@ bool _POSIX_Mutex_Auto_initialization( POSIX_Mutex_Control *the_mutex )
   /* We cannot use memset() and memcmp() due to structure internal padding */
   zero = 0;
   zero |= the_mutex->flags;
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  zero |= the_mutex->Recursive.Mutex.Queue.Queue.Lock.reserved[ 0 ];
+  zero |= the_mutex->Recursive.Mutex.Queue.Queue.Lock.reserved[ 1 ];
+#elif defined(RTEMS_SMP)
   zero |= _Atomic_Load_uint(
     &the_mutex->Recursive.Mutex.Queue.Queue.Lock.next_ticket,
     ATOMIC_ORDER_RELAXED
@@ -85,7 +88,26 @@ int pthread_mutex_unlock(
   the_mutex = _POSIX_Mutex_Get( mutex );
   POSIX_MUTEX_VALIDATE_OBJECT( the_mutex, flags );
 
-  executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
+  executing = _POSIX_Mutex_ISR_disable( &queue_context );
+
+#if defined(RTEMS_SMP)
+  if (
+    _POSIX_Mutex_Get_protocol( flags ) == POSIX_MUTEX_NO_PROTOCOL
+      && _POSIX_Mutex_Is_owner( the_mutex, executing )
+      && the_mutex->Recursive.nest_level == 0
+      && _Thread_queue_Queue_release_owner_fast(
+        &the_mutex->Recursive.Mutex.Queue.Queue,
+        executing,
+        POSIX_MUTEX_NO_PROTOCOL_TQ_OPERATIONS,
+        &queue_context
+      )
+  ) {
+    _Thread_Resource_count_decrement( executing );
+    return 0;
+  }
+#endif
+
+  _POSIX_Mutex_Acquire_critical( the_mutex, executing, &queue_context );
 
   switch ( _POSIX_Mutex_Get_protocol( flags ) ) {
     case POSIX_MUTEX_PRIORITY_CEILING:
@@ -56,6 +56,7 @@
 #include <rtems/rtems/mp.h>
 #endif
 #include <rtems/rtems/smp.h>
+#include <rtems/rtems/workqueue.h>
 
 #include <rtems/rtems/support.h>
 
@@ -167,6 +167,41 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_BARRIER_MANUAL_RELEASE    0x00000000
 
+/***************** RTEMS Message Queue Specific Attributes *****************/
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created will copy the message content on send and receive.
+ */
+#define RTEMS_COPY_MESSAGES             0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created will pass the ownership of message buffers to the
+ *  receivers instead of copying the message content.
+ *
+ *  @note Messages must be received via
+ *  rtems_message_queue_receive_buffer().
+ */
+#define RTEMS_ZERO_COPY_MESSAGES        0x00000400
+
+/******************** RTEMS Region Specific Attributes *********************/
+
+/**
+ *  This attribute constant indicates that the Classic API Region
+ *  instance created will use the first fit allocation method.
+ */
+#define RTEMS_FIRST_FIT                 0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Region
+ *  instance created will use a segregated fit free block index.  The
+ *  segment allocation and return need a constant time in this case.
+ *
+ *  @note The index is placed at the begin of the region memory area.
+ */
+#define RTEMS_SEGREGATED_FIT            0x00000200
+
 /**************** RTEMS Internal Task Specific Attributes ****************/
 
 /**
@@ -123,6 +123,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_priority(
    return ( attribute_set & RTEMS_PRIORITY ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the zero-copy messages attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the zero-copy messages attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_zero_copy_messages(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_ZERO_COPY_MESSAGES ) ? true : false;
+}
+
 /**
  *  @brief Checks if the binary semaphore attribute is
  *  enabled in the attribute_set.
@@ -239,6 +253,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_barrier_automatic(
    return ( attribute_set & RTEMS_BARRIER_AUTOMATIC_RELEASE ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the region segregated fit
+ *  attribute is enabled in the attribute_set
+ *
+ *  This function returns TRUE if the region segregated fit
+ *  attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_segregated_fit(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SEGREGATED_FIT ) ? true : false;
+}
+
 /**
  *  @brief Checks if the system task attribute
  *  is enabled in the attribute_set.
@@ -113,7 +113,7 @@ rtems_status_code rtems_clock_get_seconds_since_epoch(
  */
 RTEMS_INLINE_ROUTINE rtems_interval rtems_clock_get_ticks_since_boot(void)
 {
-  return _Watchdog_Ticks_since_boot;
+  return _Watchdog_Get_ticks_since_boot();
 }
 
 /**
@@ -127,7 +127,7 @@ RTEMS_INLINE_ROUTINE rtems_interval rtems_clock_tick_later(
   rtems_interval delta
 )
 {
-  return _Watchdog_Ticks_since_boot + delta;
+  return _Watchdog_Get_ticks_since_boot() + delta;
 }
 
 /**
@@ -148,7 +148,7 @@ RTEMS_INLINE_ROUTINE rtems_interval rtems_clock_tick_later_usec(
    * Add one additional tick, since we don't know the time to the clock next
    * tick.
    */
-  return _Watchdog_Ticks_since_boot
+  return _Watchdog_Get_ticks_since_boot()
     + (delta_in_usec + us_per_tick - 1) / us_per_tick + 1;
 }
 
@@ -183,7 +183,7 @@ RTEMS_INLINE_ROUTINE bool rtems_clock_tick_before(
   rtems_interval tick
 )
 {
-  return (int32_t) ( tick - _Watchdog_Ticks_since_boot ) > 0;
+  return (int32_t) ( tick - _Watchdog_Get_ticks_since_boot() ) > 0;
 }
 
 /**
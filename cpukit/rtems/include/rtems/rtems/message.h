@@ -230,6 +230,108 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval  timeout
 );
 
+/**
+ * @brief Gets a message buffer from a zero-copy message queue.
+ *
+ * The calling task becomes the owner of a message buffer of the message
+ * queue.  The message buffer has the maximum message size of the message
+ * queue.  The task may fill in the message in place and send it via
+ * rtems_message_queue_send_buffer() or give it back via
+ * rtems_message_queue_release_buffer().  This directive does not block.
+ *
+ * @param[in] id The message queue identifier.  It must be a local message
+ *   queue created with the RTEMS_ZERO_COPY_MESSAGES attribute.
+ * @param[out] buffer The message buffer.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The buffer parameter is NULL.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_NOT_DEFINED This is not a zero-copy message queue.
+ * @retval RTEMS_TOO_MANY All message buffers are in use.
+ */
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief Sends a message buffer to a zero-copy message queue.
+ *
+ * The ownership of the message buffer is passed to a task waiting to receive
+ * a message or the message buffer is placed at the REAR of the chain of
+ * pending messages.  The message content is not copied.
+ *
+ * @param[in] id The message queue identifier.
+ * @param[in] buffer The message buffer owned by the calling task obtained via
+ *   rtems_message_queue_get_buffer() or rtems_message_queue_receive_buffer().
+ * @param[in] size The size of the message in the message buffer.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS Invalid message buffer.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_INVALID_SIZE The size exceeds the maximum message size.
+ * @retval RTEMS_NOT_DEFINED This is not a zero-copy message queue.
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief Receives a message buffer from a zero-copy message queue.
+ *
+ * The calling task becomes the owner of the message buffer of the received
+ * message.  It must give back the message buffer via
+ * rtems_message_queue_release_buffer() or send it via
+ * rtems_message_queue_send_buffer() after use.  If no messages are
+ * outstanding and the option_set indicates that the task is willing to
+ * block, then the task will be blocked until a message arrives or until,
+ * optionally, timeout clock ticks have passed.
+ *
+ * @param[in] id The message queue identifier.
+ * @param[out] buffer The message buffer.
+ * @param[out] size The size of the received message.
+ * @param[in] option_set The options on receive.
+ * @param[in] timeout The number of ticks to wait.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The buffer or size parameter is NULL.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_NOT_DEFINED This is not a zero-copy message queue.
+ * @retval RTEMS_UNSATISFIED No message is pending and the task is not
+ *   willing to block.
+ * @retval RTEMS_TIMEOUT Timed out waiting for a message.
+ * @retval RTEMS_OBJECT_WAS_DELETED The message queue was deleted while
+ *   waiting for a message.
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ * @brief Releases a message buffer to a zero-copy message queue.
+ *
+ * @param[in] id The message queue identifier.
+ * @param[in] buffer The message buffer owned by the calling task.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS Invalid message buffer.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_NOT_DEFINED This is not a zero-copy message queue.
+ *
+ * @note All message buffers must be released before the message queue is
+ * deleted.
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**
  *  @brief rtems_message_queue_flush
  *
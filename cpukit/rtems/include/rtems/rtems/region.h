@@ -75,8 +75,8 @@ typedef struct {
  *  the region is of length bytes and starts at starting_address.
  *  The memory area will be divided into as many allocatable units of
  *  page_size bytes as possible.   The attribute_set determines which
- *  thread queue discipline is used by the region.  It returns the
- *  id of the created region in ID.
+ *  thread queue discipline and which allocation method is used by the
+ *  region.  It returns the id of the created region in ID.
  */
 rtems_status_code rtems_region_create(
   rtems_name          name,
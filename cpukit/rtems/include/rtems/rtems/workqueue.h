@@ -0,0 +1,453 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicWorkQueue
+ *
+ * @brief Classic API Work Queue Manager
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_RTEMS_WORKQUEUE_H
+#define _RTEMS_RTEMS_WORKQUEUE_H
+
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/rtems/types.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/watchdog.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ClassicWorkQueue Work Queues
+ *
+ * @ingroup ClassicRTEMS
+ *
+ * @brief Work queues execute short jobs in the context of worker tasks.
+ *
+ * A work queue has one worker task for each processor.  The worker tasks
+ * are created by rtems_work_queue_create() and terminate in
+ * rtems_work_queue_delete().  On SMP configurations, each worker task is
+ * moved to the scheduler instance owning its processor and its affinity is
+ * set to this processor.  The affinity is only enforced by schedulers which
+ * support it, e.g. the priority affinity SMP scheduler
+ * (CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP).  Alternatively, use one
+ * scheduler instance for each processor.  Otherwise, the worker tasks may
+ * execute on any processor of their scheduler instance.  A work item
+ * submitted by rtems_work_queue_submit() is queued for the worker of the
+ * current processor.  A worker with no pending work items of its own steals
+ * work items from the other workers.  If a work item is queued for a busy
+ * worker, then an idle worker is woken up to steal it.
+ *
+ * The work items of a worker are executed in priority order and in FIFO
+ * order within a priority.  Delayed work items submitted by
+ * rtems_work_queue_submit_after() are queued once their delay expired.
+ *
+ * Work items are provided by the user.  The submission of a work item
+ * involves no memory allocation and no copy of the work item.  The work
+ * queue directives may be called from interrupt context, except
+ * rtems_work_queue_create(), rtems_work_queue_delete() and
+ * rtems_work_queue_cancel_sync().
+ *
+ * @{
+ */
+
+/**
+ * @brief Work item priorities.
+ */
+typedef enum {
+  RTEMS_WORK_PRIORITY_HIGH,
+  RTEMS_WORK_PRIORITY_NORMAL,
+  RTEMS_WORK_PRIORITY_LOW,
+  RTEMS_WORK_PRIORITY_COUNT
+} rtems_work_priority;
+
+/**
+ * @brief Work item states.
+ */
+typedef enum {
+  RTEMS_WORK_ITEM_IDLE,
+  RTEMS_WORK_ITEM_DELAYED,
+  RTEMS_WORK_ITEM_PENDING
+} rtems_work_item_state;
+
+typedef struct rtems_work_item rtems_work_item;
+
+typedef struct rtems_work_queue_worker rtems_work_queue_worker;
+
+/**
+ * @brief Work item handler.
+ *
+ * The work item is idle during the handler execution.  The handler may
+ * submit its work item again.  The worker accesses the work item after the
+ * handler returned, so the handler must not free its work item.  Use
+ * rtems_work_queue_cancel_sync() before the storage of a work item is
+ * reused.
+ *
+ * @param[in] item The work item.
+ */
+typedef void ( *rtems_work_handler )( rtems_work_item *item );
+
+/**
+ * @brief Work item.
+ *
+ * Use rtems_work_item_initialize() to initialize a work item.  The members
+ * are private.
+ */
+struct rtems_work_item {
+  /**
+   * @brief Node for the pending work items chain of a worker.
+   */
+  Chain_Node Node;
+
+  /**
+   * @brief Watchdog for delayed work items.
+   */
+  Watchdog_Control Delay;
+
+  /**
+   * @brief The worker owning this work item.
+   *
+   * The state of the work item is protected by the lock of this worker.  It
+   * may only change if the work item is idle.
+   */
+  rtems_work_queue_worker *worker;
+
+  /**
+   * @brief The handler of this work item.
+   */
+  rtems_work_handler handler;
+
+  /**
+   * @brief The handler argument.
+   */
+  void *arg;
+
+  /**
+   * @brief The priority of this work item.
+   */
+  rtems_work_priority priority;
+
+  /**
+   * @brief The state of this work item.
+   */
+  rtems_work_item_state state;
+
+  /**
+   * @brief Indicates that the work item was cancelled while its delay
+   * expired.
+   *
+   * The delay expiration in progress makes the work item idle.
+   */
+  bool cancelled;
+
+  /**
+   * @brief Count of handler executions in progress.
+   */
+  uint32_t running;
+
+  /**
+   * @brief The task waiting in rtems_work_queue_cancel_sync() or zero.
+   */
+  rtems_id waiter;
+};
+
+/**
+ * @brief Worker of a work queue.
+ *
+ * The members are private.
+ */
+struct rtems_work_queue_worker {
+  /**
+   * @brief Lock to protect the pending work items and the state of the work
+   * items owned by this worker.
+   */
+  ISR_LOCK_MEMBER( Lock )
+
+  /**
+   * @brief Pending work items for each priority.
+   */
+  Chain_Control Pending[ RTEMS_WORK_PRIORITY_COUNT ];
+
+  /**
+   * @brief Count of pending work items.
+   */
+  uint32_t pending_count;
+
+  /**
+   * @brief Count of delayed work items owned by this worker.
+   */
+  uint32_t delayed_count;
+
+  /**
+   * @brief Indicates if the worker task waits for work items.
+   */
+  bool waiting;
+
+  /**
+   * @brief Indicates if the worker task shall terminate.
+   */
+  bool terminate;
+
+  /**
+   * @brief The worker task identifier.
+   */
+  rtems_id task_id;
+
+  /**
+   * @brief The processor index of this worker.
+   */
+  uint32_t cpu_index;
+
+  /**
+   * @brief The work queue of this worker.
+   */
+  struct rtems_work_queue *queue;
+
+  /**
+   * @brief Count of work items executed by this worker.
+   */
+  uint32_t executed;
+
+  /**
+   * @brief Count of work items stolen by this worker from other workers.
+   */
+  uint32_t stolen;
+};
+
+/**
+ * @brief Work queue.
+ *
+ * The members are private.
+ */
+typedef struct rtems_work_queue {
+  /**
+   * @brief Lock to protect the first owner assignment of work items.
+   */
+  ISR_LOCK_MEMBER( Lock )
+
+  /**
+   * @brief The task waiting in rtems_work_queue_delete().
+   */
+  rtems_id deleter;
+
+  /**
+   * @brief The workers with one entry for each processor.
+   */
+  rtems_work_queue_worker *workers;
+
+  /**
+   * @brief The count of workers.
+   */
+  uint32_t worker_count;
+} rtems_work_queue;
+
+/**
+ * @brief Work queue worker information.
+ */
+typedef struct {
+  /**
+   * @brief The worker task identifier.
+   */
+  rtems_id task_id;
+
+  /**
+   * @brief Count of pending work items.
+   */
+  uint32_t pending;
+
+  /**
+   * @brief Count of work items executed by this worker.
+   */
+  uint32_t executed;
+
+  /**
+   * @brief Count of work items stolen by this worker from other workers.
+   */
+  uint32_t stolen;
+} rtems_work_queue_worker_info;
+
+/**
+ * @brief Initializes a work item.
+ *
+ * @param[out] item The work item.
+ * @param[in] handler The work item handler.
+ * @param[in] arg The handler argument.
+ * @param[in] priority The work item priority.
+ */
+void rtems_work_item_initialize(
+  rtems_work_item     *item,
+  rtems_work_handler   handler,
+  void                *arg,
+  rtems_work_priority  priority
+);
+
+/**
+ * @brief Returns the handler argument of a work item.
+ *
+ * @param[in] item The work item.
+ *
+ * @return The handler argument.
+ */
+RTEMS_INLINE_ROUTINE void *rtems_work_item_get_argument(
+  const rtems_work_item *item
+)
+{
+  return item->arg;
+}
+
+/**
+ * @brief Creates a work queue.
+ *
+ * One worker task is created for each processor.  The tasks are named by
+ * the specified name.
+ *
+ * @param[out] queue The work queue.
+ * @param[in] name The name of the worker tasks.
+ * @param[in] priority The priority of the worker tasks.
+ * @param[in] stack_size The stack size of the worker tasks.
+ * @param[in] modes The initial modes of the worker tasks.
+ * @param[in] attributes The attributes of the worker tasks.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The queue pointer is NULL.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the workers.
+ * @retval RTEMS_TOO_MANY Not enough tasks to create the worker tasks.
+ * @retval other The worker task creation failed.
+ */
+rtems_status_code rtems_work_queue_create(
+  rtems_work_queue    *queue,
+  rtems_name           name,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_mode           modes,
+  rtems_attribute      attributes
+);
+
+/**
+ * @brief Deletes a work queue.
+ *
+ * The worker tasks finish the work item handlers in progress and terminate.
+ * This directive must not be called by a work item handler.
+ *
+ * @param[in] queue The work queue.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The queue pointer is NULL.
+ * @retval RTEMS_RESOURCE_IN_USE The work queue has pending or delayed work
+ *   items.
+ */
+rtems_status_code rtems_work_queue_delete( rtems_work_queue *queue );
+
+/**
+ * @brief Submits a work item to the worker of the current processor.
+ *
+ * @param[in] queue The work queue.
+ * @param[in] item The work item.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_RESOURCE_IN_USE The work item is already pending or delayed.
+ */
+rtems_status_code rtems_work_queue_submit(
+  rtems_work_queue *queue,
+  rtems_work_item  *item
+);
+
+/**
+ * @brief Submits a work item to the worker of a processor.
+ *
+ * @param[in] queue The work queue.
+ * @param[in] item The work item.
+ * @param[in] cpu_index The processor index of the worker.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor index.
+ * @retval RTEMS_RESOURCE_IN_USE The work item is already pending or delayed.
+ */
+rtems_status_code rtems_work_queue_submit_to_processor(
+  rtems_work_queue *queue,
+  rtems_work_item  *item,
+  uint32_t          cpu_index
+);
+
+/**
+ * @brief Submits a work item to the worker of the current processor after
+ * a delay.
+ *
+ * @param[in] queue The work queue.
+ * @param[in] item The work item.
+ * @param[in] ticks The delay in clock ticks.  A delay of zero submits the
+ *   work item immediately.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_RESOURCE_IN_USE The work item is already pending or delayed.
+ */
+rtems_status_code rtems_work_queue_submit_after(
+  rtems_work_queue *queue,
+  rtems_work_item  *item,
+  rtems_interval    ticks
+);
+
+/**
+ * @brief Cancels a pending or delayed work item.
+ *
+ * This directive does not wait for the completion of a work item handler in
+ * progress.  In case the delay of the work item expires concurrently, then
+ * the work item stays delayed until the delay expiration is done.
+ *
+ * @param[in] item The work item.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The work item was neither pending nor
+ *   delayed.
+ */
+rtems_status_code rtems_work_queue_cancel( rtems_work_item *item );
+
+/**
+ * @brief Cancels a work item and waits until the work queue no longer uses
+ * it.
+ *
+ * This directive waits for the completion of the work item handlers and
+ * delay expirations in progress.  Afterwards, the storage of the work item
+ * may be reused.  At most one task may wait for a particular work item.  This
+ * directive must not be called by the handler of the work item.  It uses the
+ * transient event of the calling task.
+ *
+ * @param[in] item The work item.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ */
+rtems_status_code rtems_work_queue_cancel_sync( rtems_work_item *item );
+
+/**
+ * @brief Gets information about a worker of a work queue.
+ *
+ * @param[in] queue The work queue.
+ * @param[in] cpu_index The processor index of the worker.
+ * @param[out] info The worker information.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The information pointer is NULL.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor index.
+ */
+rtems_status_code rtems_work_queue_get_worker_info(
+  rtems_work_queue             *queue,
+  uint32_t                      cpu_index,
+  rtems_work_queue_worker_info *info
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_RTEMS_WORKQUEUE_H */
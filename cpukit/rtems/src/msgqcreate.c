@@ -64,6 +64,13 @@ rtems_status_code rtems_message_queue_create(
       return RTEMS_INVALID_SIZE;
 
 #if defined(RTEMS_MULTIPROCESSING)
+  /*
+   * Message buffers of zero-copy message queues are owned by local tasks, so
+   * they cannot be global.
+   */
+  if ( is_global && _Attributes_Is_zero_copy_messages( attribute_set ) )
+    return RTEMS_NOT_DEFINED;
+
 #if 1
   /*
    * I am not 100% sure this should be an error.
@@ -109,7 +116,8 @@ rtems_status_code rtems_message_queue_create(
            &the_message_queue->message_queue,
            discipline,
            count,
-           max_message_size
+           max_message_size,
+           _Attributes_Is_zero_copy_messages( attribute_set )
          ) ) {
 #if defined(RTEMS_MULTIPROCESSING)
     if ( is_global )
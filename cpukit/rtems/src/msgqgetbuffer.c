@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_get_buffer
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  if ( buffer == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_message_queue = _Message_queue_Get( id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  status = _CORE_message_queue_Get_buffer(
+    &the_message_queue->message_queue,
+    &the_message,
+    &queue_context
+  );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *buffer = the_message->Contents.buffer;
+  }
+
+  return _Status_Get( status );
+}
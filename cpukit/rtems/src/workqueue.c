@@ -0,0 +1,783 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicWorkQueue
+ *
+ * @brief Classic API Work Queue Manager Implementation
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/rtems/workqueue.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/wkspace.h>
+
+static void _Work_queue_Acquire(
+  rtems_work_queue_worker *worker,
+  ISR_lock_Context        *lock_context
+)
+{
+  _ISR_lock_ISR_disable_and_acquire( &worker->Lock, lock_context );
+}
+
+static void _Work_queue_Release(
+  rtems_work_queue_worker *worker,
+  ISR_lock_Context        *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &worker->Lock, lock_context );
+}
+
+/*
+ * Sets the first owner of a work item.  The owner of a work item which was
+ * submitted before only changes with the lock of the owner acquired.
+ */
+static void _Work_queue_Initialize_owner(
+  rtems_work_queue        *queue,
+  rtems_work_item         *item,
+  rtems_work_queue_worker *worker
+)
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &queue->Lock, &lock_context );
+
+  if ( item->worker == NULL ) {
+    item->worker = worker;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &queue->Lock, &lock_context );
+}
+
+static rtems_work_queue_worker *_Work_queue_Get_current_worker(
+  const rtems_work_queue *queue
+)
+{
+  return &queue->workers[
+    _SMP_Get_current_processor() % queue->worker_count
+  ];
+}
+
+/*
+ * Acquires the lock of the worker owning the work item.  Returns with the
+ * lock acquired and the owner unchanged.
+ */
+static rtems_work_queue_worker *_Work_queue_Acquire_owner(
+  rtems_work_item  *item,
+  ISR_lock_Context *lock_context
+)
+{
+  while ( true ) {
+    rtems_work_queue_worker *worker;
+
+    worker = item->worker;
+    _Work_queue_Acquire( worker, lock_context );
+
+    if ( worker == item->worker ) {
+      return worker;
+    }
+
+    _Work_queue_Release( worker, lock_context );
+  }
+}
+
+/*
+ * Transfers the ownership of an idle work item to the target worker.
+ * Returns with the lock of the target worker acquired or NULL, if the work
+ * item is not idle.
+ */
+static rtems_work_queue_worker *_Work_queue_Acquire_idle_item(
+  rtems_work_item         *item,
+  rtems_work_queue_worker *target,
+  ISR_lock_Context        *lock_context
+)
+{
+  while ( true ) {
+    rtems_work_queue_worker *owner;
+
+    owner = _Work_queue_Acquire_owner( item, lock_context );
+
+    if ( item->state != RTEMS_WORK_ITEM_IDLE ) {
+      _Work_queue_Release( owner, lock_context );
+      return NULL;
+    }
+
+    if ( owner == target ) {
+      return owner;
+    }
+
+    item->worker = target;
+    _Work_queue_Release( owner, lock_context );
+  }
+}
+
+static void _Work_queue_Wake_up( rtems_work_queue_worker *worker )
+{
+  (void) rtems_event_system_send( worker->task_id, RTEMS_EVENT_SYSTEM_SERVER );
+}
+
+/*
+ * Returns the task waiting for the work item if the work queue no longer
+ * uses it.  The lock of the owner must be acquired.
+ */
+static rtems_id _Work_queue_Get_waiter( rtems_work_item *item )
+{
+  rtems_id waiter;
+
+  if ( item->state != RTEMS_WORK_ITEM_IDLE || item->running > 0 ) {
+    return 0;
+  }
+
+  waiter = item->waiter;
+  item->waiter = 0;
+  return waiter;
+}
+
+static void _Work_queue_Wake_up_waiter( rtems_id waiter )
+{
+  if ( waiter != 0 ) {
+    (void) rtems_event_transient_send( waiter );
+  }
+}
+
+/*
+ * Wakes up a waiting worker, so that it steals the work items of a busy
+ * worker.
+ */
+static void _Work_queue_Wake_up_thief(
+  rtems_work_queue        *queue,
+  rtems_work_queue_worker *busy
+)
+{
+  uint32_t i;
+
+  for ( i = 1 ; i < queue->worker_count ; ++i ) {
+    rtems_work_queue_worker *thief;
+    ISR_lock_Context         lock_context;
+    bool                     wake_up;
+
+    thief = &queue->workers[ ( busy->cpu_index + i ) % queue->worker_count ];
+
+    if ( !thief->waiting ) {
+      continue;
+    }
+
+    _Work_queue_Acquire( thief, &lock_context );
+    wake_up = thief->waiting;
+    thief->waiting = false;
+    _Work_queue_Release( thief, &lock_context );
+
+    if ( wake_up ) {
+      _Work_queue_Wake_up( thief );
+      break;
+    }
+  }
+}
+
+/*
+ * Enqueues the work item with the lock of the target worker acquired.
+ * Releases the lock.
+ */
+static void _Work_queue_Enqueue_and_release(
+  rtems_work_queue_worker *worker,
+  rtems_work_item         *item,
+  ISR_lock_Context        *lock_context
+)
+{
+  bool wake_up;
+
+  item->state = RTEMS_WORK_ITEM_PENDING;
+  _Chain_Append_unprotected(
+    &worker->Pending[ item->priority ],
+    &item->Node
+  );
+  ++worker->pending_count;
+  wake_up = worker->waiting;
+  worker->waiting = false;
+  _Work_queue_Release( worker, lock_context );
+
+  if ( wake_up ) {
+    _Work_queue_Wake_up( worker );
+  } else {
+    _Work_queue_Wake_up_thief( worker->queue, worker );
+  }
+}
+
+static rtems_work_item *_Work_queue_Dequeue_critical(
+  rtems_work_queue_worker *worker
+)
+{
+  int priority;
+
+  if ( worker->pending_count == 0 ) {
+    return NULL;
+  }
+
+  for ( priority = 0 ; priority < RTEMS_WORK_PRIORITY_COUNT ; ++priority ) {
+    Chain_Control *pending;
+
+    pending = &worker->Pending[ priority ];
+
+    if ( !_Chain_Is_empty( pending ) ) {
+      rtems_work_item *item;
+
+      item = (rtems_work_item *) _Chain_Get_first_unprotected( pending );
+      --worker->pending_count;
+
+      /* The handler may submit its work item again */
+      item->state = RTEMS_WORK_ITEM_IDLE;
+      ++item->running;
+      return item;
+    }
+  }
+
+  _Assert( 0 );
+  return NULL;
+}
+
+static rtems_work_item *_Work_queue_Steal( rtems_work_queue_worker *thief )
+{
+  rtems_work_queue *queue;
+  uint32_t          i;
+
+  queue = thief->queue;
+
+  for ( i = 1 ; i < queue->worker_count ; ++i ) {
+    rtems_work_queue_worker *victim;
+    rtems_work_item         *item;
+    ISR_lock_Context         lock_context;
+
+    victim = &queue->workers[ ( thief->cpu_index + i ) % queue->worker_count ];
+
+    if ( victim->pending_count == 0 ) {
+      continue;
+    }
+
+    _Work_queue_Acquire( victim, &lock_context );
+    item = _Work_queue_Dequeue_critical( victim );
+    _Work_queue_Release( victim, &lock_context );
+
+    if ( item != NULL ) {
+      ++thief->stolen;
+      return item;
+    }
+  }
+
+  return NULL;
+}
+
+static void _Work_queue_Finish( rtems_work_item *item )
+{
+  rtems_work_queue_worker *owner;
+  ISR_lock_Context         lock_context;
+  rtems_id                 waiter;
+
+  owner = _Work_queue_Acquire_owner( item, &lock_context );
+  _Assert( item->running > 0 );
+  --item->running;
+  waiter = _Work_queue_Get_waiter( item );
+  _Work_queue_Release( owner, &lock_context );
+
+  _Work_queue_Wake_up_waiter( waiter );
+}
+
+static rtems_task _Work_queue_Worker_body( rtems_task_argument arg )
+{
+  rtems_work_queue_worker *worker;
+
+  worker = (rtems_work_queue_worker *) arg;
+
+  while ( true ) {
+    ISR_lock_Context  lock_context;
+    rtems_work_item  *item;
+    rtems_event_set   events;
+
+    _Work_queue_Acquire( worker, &lock_context );
+    worker->waiting = false;
+
+    if ( worker->terminate ) {
+      _Work_queue_Release( worker, &lock_context );
+      break;
+    }
+
+    item = _Work_queue_Dequeue_critical( worker );
+    _Work_queue_Release( worker, &lock_context );
+
+    if ( item == NULL ) {
+      item = _Work_queue_Steal( worker );
+    }
+
+    if ( item != NULL ) {
+      ++worker->executed;
+      ( *item->handler )( item );
+      _Work_queue_Finish( item );
+      continue;
+    }
+
+    _Work_queue_Acquire( worker, &lock_context );
+
+    if ( worker->pending_count > 0 || worker->terminate ) {
+      _Work_queue_Release( worker, &lock_context );
+      continue;
+    }
+
+    worker->waiting = true;
+    _Work_queue_Release( worker, &lock_context );
+
+    (void) rtems_event_system_receive(
+      RTEMS_EVENT_SYSTEM_SERVER,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+  }
+
+  (void) rtems_event_transient_send( worker->queue->deleter );
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void _Work_queue_Delay_expired( Watchdog_Control *the_watchdog )
+{
+  rtems_work_item         *item;
+  rtems_work_queue_worker *worker;
+  ISR_lock_Context         lock_context;
+  rtems_id                 waiter;
+
+  item = RTEMS_CONTAINER_OF( the_watchdog, rtems_work_item, Delay );
+  worker = _Work_queue_Acquire_owner( item, &lock_context );
+
+  /*
+   * A delayed work item is only idle again after the delay expiration, see
+   * _Work_queue_Cancel_critical().
+   */
+  _Assert( item->state == RTEMS_WORK_ITEM_DELAYED );
+  _Assert( worker->delayed_count > 0 );
+  --worker->delayed_count;
+
+  if ( item->cancelled ) {
+    item->cancelled = false;
+    item->state = RTEMS_WORK_ITEM_IDLE;
+    waiter = _Work_queue_Get_waiter( item );
+    _Work_queue_Release( worker, &lock_context );
+
+    _Work_queue_Wake_up_waiter( waiter );
+    return;
+  }
+
+  _Work_queue_Enqueue_and_release( worker, item, &lock_context );
+}
+
+/*
+ * Returns true, if the delay was removed before its expiration, otherwise
+ * false.  The delay expiration may be in progress in the latter case.
+ */
+static bool _Work_queue_Remove_delay( rtems_work_item *item )
+{
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+  bool              removed;
+
+  cpu = _Watchdog_Get_CPU( &item->Delay );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+  removed = _Watchdog_Is_scheduled( &item->Delay );
+
+  if ( removed ) {
+    _Watchdog_Remove(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+      &item->Delay
+    );
+  }
+
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+  return removed;
+}
+
+static rtems_status_code _Work_queue_Cancel_critical(
+  rtems_work_queue_worker *worker,
+  rtems_work_item         *item
+)
+{
+  switch ( item->state ) {
+    case RTEMS_WORK_ITEM_PENDING:
+      _Chain_Extract_unprotected( &item->Node );
+      --worker->pending_count;
+      item->state = RTEMS_WORK_ITEM_IDLE;
+      return RTEMS_SUCCESSFUL;
+    case RTEMS_WORK_ITEM_DELAYED:
+      if ( item->cancelled ) {
+        return RTEMS_INCORRECT_STATE;
+      }
+
+      if ( _Work_queue_Remove_delay( item ) ) {
+        --worker->delayed_count;
+        item->state = RTEMS_WORK_ITEM_IDLE;
+      } else {
+        /* Let the delay expiration in progress make the work item idle */
+        item->cancelled = true;
+      }
+
+      return RTEMS_SUCCESSFUL;
+    default:
+      return RTEMS_INCORRECT_STATE;
+  }
+}
+
+void rtems_work_item_initialize(
+  rtems_work_item     *item,
+  rtems_work_handler   handler,
+  void                *arg,
+  rtems_work_priority  priority
+)
+{
+  _Assert( priority < RTEMS_WORK_PRIORITY_COUNT );
+
+  _Chain_Set_off_chain( &item->Node );
+  _Watchdog_Preinitialize( &item->Delay, _Per_CPU_Get_by_index( 0 ) );
+  _Watchdog_Initialize( &item->Delay, _Work_queue_Delay_expired );
+  item->worker = NULL;
+  item->handler = handler;
+  item->arg = arg;
+  item->priority = priority;
+  item->state = RTEMS_WORK_ITEM_IDLE;
+  item->cancelled = false;
+  item->running = 0;
+  item->waiter = 0;
+}
+
+rtems_status_code rtems_work_queue_create(
+  rtems_work_queue    *queue,
+  rtems_name           name,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_mode           modes,
+  rtems_attribute      attributes
+)
+{
+  rtems_work_queue_worker *workers;
+  uint32_t                 worker_count;
+  uint32_t                 cpu_index;
+
+  if ( queue == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  worker_count = rtems_get_processor_count();
+  workers = _Workspace_Allocate( worker_count * sizeof( *workers ) );
+
+  if ( workers == NULL ) {
+    return RTEMS_NO_MEMORY;
+  }
+
+  _ISR_lock_Initialize( &queue->Lock, "Work Queue" );
+  queue->deleter = 0;
+  queue->workers = workers;
+  queue->worker_count = worker_count;
+
+  for ( cpu_index = 0 ; cpu_index < worker_count ; ++cpu_index ) {
+    rtems_work_queue_worker *worker;
+    rtems_status_code        sc;
+    int                      i;
+
+    worker = &workers[ cpu_index ];
+    _ISR_lock_Initialize( &worker->Lock, "Work Queue" );
+
+    for ( i = 0 ; i < RTEMS_WORK_PRIORITY_COUNT ; ++i ) {
+      _Chain_Initialize_empty( &worker->Pending[ i ] );
+    }
+
+    worker->pending_count = 0;
+    worker->delayed_count = 0;
+    worker->waiting = false;
+    worker->terminate = false;
+    worker->cpu_index = cpu_index;
+    worker->queue = queue;
+    worker->executed = 0;
+    worker->stolen = 0;
+
+    sc = rtems_task_create(
+      name,
+      priority,
+      stack_size,
+      modes,
+      attributes,
+      &worker->task_id
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      while ( cpu_index > 0 ) {
+        --cpu_index;
+        (void) rtems_task_delete( workers[ cpu_index ].task_id );
+        _ISR_lock_Destroy( &workers[ cpu_index ].Lock );
+      }
+
+      _ISR_lock_Destroy( &worker->Lock );
+      _ISR_lock_Destroy( &queue->Lock );
+      _Workspace_Free( workers );
+      return sc;
+    }
+  }
+
+  /*
+   * Start the workers after all of them exist, since a worker may steal
+   * work items from any other worker.
+   */
+  for ( cpu_index = 0 ; cpu_index < worker_count ; ++cpu_index ) {
+    rtems_work_queue_worker *worker;
+    rtems_status_code        sc;
+#if defined(RTEMS_SMP)
+    rtems_id                 scheduler;
+    cpu_set_t                cpu;
+#endif
+
+    worker = &workers[ cpu_index ];
+
+#if defined(RTEMS_SMP)
+    sc = rtems_scheduler_ident_by_processor( cpu_index, &scheduler );
+
+    if ( sc == RTEMS_SUCCESSFUL ) {
+      sc = rtems_task_set_scheduler( worker->task_id, scheduler, priority );
+      _Assert( sc == RTEMS_SUCCESSFUL );
+
+      CPU_ZERO( &cpu );
+      CPU_SET( (int) cpu_index, &cpu );
+      sc = rtems_task_set_affinity( worker->task_id, sizeof( cpu ), &cpu );
+      _Assert( sc == RTEMS_SUCCESSFUL );
+    }
+#endif
+
+    sc = rtems_task_start(
+      worker->task_id,
+      _Work_queue_Worker_body,
+      (rtems_task_argument) worker
+    );
+    _Assert( sc == RTEMS_SUCCESSFUL );
+    (void) sc;
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_queue_delete( rtems_work_queue *queue )
+{
+  uint32_t cpu_index;
+
+  if ( queue == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  for ( cpu_index = 0 ; cpu_index < queue->worker_count ; ++cpu_index ) {
+    rtems_work_queue_worker *worker;
+    ISR_lock_Context         lock_context;
+    bool                     busy;
+
+    worker = &queue->workers[ cpu_index ];
+    _Work_queue_Acquire( worker, &lock_context );
+    busy = worker->pending_count > 0 || worker->delayed_count > 0;
+    _Work_queue_Release( worker, &lock_context );
+
+    if ( busy ) {
+      return RTEMS_RESOURCE_IN_USE;
+    }
+  }
+
+  queue->deleter = rtems_task_self();
+
+  for ( cpu_index = 0 ; cpu_index < queue->worker_count ; ++cpu_index ) {
+    rtems_work_queue_worker *worker;
+    ISR_lock_Context         lock_context;
+    bool                     wake_up;
+
+    worker = &queue->workers[ cpu_index ];
+    _Work_queue_Acquire( worker, &lock_context );
+    worker->terminate = true;
+    wake_up = worker->waiting;
+    worker->waiting = false;
+    _Work_queue_Release( worker, &lock_context );
+
+    if ( wake_up ) {
+      _Work_queue_Wake_up( worker );
+    }
+  }
+
+  /* Wait until all workers finished their work item handler in progress */
+  for ( cpu_index = 0 ; cpu_index < queue->worker_count ; ++cpu_index ) {
+    (void) rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  }
+
+  for ( cpu_index = 0 ; cpu_index < queue->worker_count ; ++cpu_index ) {
+    rtems_work_queue_worker *worker;
+
+    worker = &queue->workers[ cpu_index ];
+    (void) rtems_task_delete( worker->task_id );
+    _ISR_lock_Destroy( &worker->Lock );
+  }
+
+  _ISR_lock_Destroy( &queue->Lock );
+  _Workspace_Free( queue->workers );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_queue_submit_to_processor(
+  rtems_work_queue *queue,
+  rtems_work_item  *item,
+  uint32_t          cpu_index
+)
+{
+  rtems_work_queue_worker *worker;
+  ISR_lock_Context         lock_context;
+
+  if ( cpu_index >= queue->worker_count ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  worker = &queue->workers[ cpu_index ];
+
+  if ( item->worker == NULL ) {
+    _Work_queue_Initialize_owner( queue, item, worker );
+  }
+
+  worker = _Work_queue_Acquire_idle_item( item, worker, &lock_context );
+
+  if ( worker == NULL ) {
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  _Work_queue_Enqueue_and_release( worker, item, &lock_context );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_queue_submit(
+  rtems_work_queue *queue,
+  rtems_work_item  *item
+)
+{
+  return rtems_work_queue_submit_to_processor(
+    queue,
+    item,
+    _Work_queue_Get_current_worker( queue )->cpu_index
+  );
+}
+
+rtems_status_code rtems_work_queue_submit_after(
+  rtems_work_queue *queue,
+  rtems_work_item  *item,
+  rtems_interval    ticks
+)
+{
+  rtems_work_queue_worker *worker;
+  ISR_lock_Context         lock_context;
+
+  worker = _Work_queue_Get_current_worker( queue );
+
+  if ( item->worker == NULL ) {
+    _Work_queue_Initialize_owner( queue, item, worker );
+  }
+
+  worker = _Work_queue_Acquire_idle_item( item, worker, &lock_context );
+
+  if ( worker == NULL ) {
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  if ( ticks == 0 ) {
+    _Work_queue_Enqueue_and_release( worker, item, &lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+
+  item->state = RTEMS_WORK_ITEM_DELAYED;
+  ++worker->delayed_count;
+  _Watchdog_Per_CPU_insert_ticks(
+    &item->Delay,
+    _Per_CPU_Get_by_index( worker->cpu_index ),
+    ticks
+  );
+  _Work_queue_Release( worker, &lock_context );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_queue_cancel( rtems_work_item *item )
+{
+  rtems_work_queue_worker *worker;
+  ISR_lock_Context         lock_context;
+  rtems_status_code        sc;
+
+  if ( item->worker == NULL ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  worker = _Work_queue_Acquire_owner( item, &lock_context );
+  sc = _Work_queue_Cancel_critical( worker, item );
+  _Work_queue_Release( worker, &lock_context );
+  return sc;
+}
+
+rtems_status_code rtems_work_queue_cancel_sync( rtems_work_item *item )
+{
+  if ( item->worker == NULL ) {
+    return RTEMS_SUCCESSFUL;
+  }
+
+  while ( true ) {
+    rtems_work_queue_worker *worker;
+    ISR_lock_Context         lock_context;
+
+    worker = _Work_queue_Acquire_owner( item, &lock_context );
+    (void) _Work_queue_Cancel_critical( worker, item );
+
+    if ( item->state == RTEMS_WORK_ITEM_IDLE && item->running == 0 ) {
+      _Work_queue_Release( worker, &lock_context );
+      return RTEMS_SUCCESSFUL;
+    }
+
+    /*
+     * Wait for the handler executions and the delay expiration in progress.
+     * A handler may submit the work item again, so cancel it again
+     * afterwards.
+     */
+    item->waiter = rtems_task_self();
+    _Work_queue_Release( worker, &lock_context );
+
+    (void) rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  }
+}
+
+rtems_status_code rtems_work_queue_get_worker_info(
+  rtems_work_queue             *queue,
+  uint32_t                      cpu_index,
+  rtems_work_queue_worker_info *info
+)
+{
+  rtems_work_queue_worker *worker;
+  ISR_lock_Context         lock_context;
+
+  if ( info == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cpu_index >= queue->worker_count ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  worker = &queue->workers[ cpu_index ];
+
+  _Work_queue_Acquire( worker, &lock_context );
+  info->task_id = worker->task_id;
+  info->pending = worker->pending_count;
+  info->executed = worker->executed;
+  info->stolen = worker->stolen;
+  _Work_queue_Release( worker, &lock_context );
+
+  return RTEMS_SUCCESSFUL;
+}
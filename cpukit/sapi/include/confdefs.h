@@ -31,6 +31,7 @@
 #include <rtems/score/apimutex.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/userextimpl.h>
+#include <rtems/score/watchdogimpl.h>
 #include <rtems/score/wkspace.h>
 
 #ifdef CONFIGURE_DISABLE_BSP_SETTINGS
@@ -774,6 +775,8 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
  *
  *  - CONFIGURE_SCHEDULER_PRIORITY - Deterministic Priority Scheduler
  *  - CONFIGURE_SCHEDULER_PRIORITY_SMP - Deterministic Priority SMP Scheduler
+ *  - CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP - Deterministic Priority SMP
+ *    Scheduler with per-processor ready queues
  *  - CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP - Deterministic
  *    Priority SMP Affinity Scheduler
  *  - CONFIGURE_SCHEDULER_STRONG_APA - Strong APA Scheduler
@@ -781,6 +784,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
  *  - CONFIGURE_SCHEDULER_SIMPLE_SMP - Simple SMP Priority Scheduler
  *  - CONFIGURE_SCHEDULER_EDF - EDF Scheduler
  *  - CONFIGURE_SCHEDULER_EDF_SMP - EDF SMP Scheduler
+ *  - CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP - Clustered EDF SMP Scheduler
  *  - CONFIGURE_SCHEDULER_CBS - CBS Scheduler
  *  - CONFIGURE_SCHEDULER_USER  - user provided scheduler
  *
@@ -801,12 +805,14 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
 #if !defined(CONFIGURE_SCHEDULER_USER) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) && \
+    !defined(CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_STRONG_APA) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) && \
     !defined(CONFIGURE_SCHEDULER_EDF) && \
     !defined(CONFIGURE_SCHEDULER_EDF_SMP) && \
+    !defined(CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP) && \
     !defined(CONFIGURE_SCHEDULER_CBS)
   #if defined(RTEMS_SMP) && CONFIGURE_MAXIMUM_PROCESSORS > 1
     /**
@@ -872,6 +878,34 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #endif
 #endif
 
+/*
+ * If the Deterministic Priority SMP Scheduler with per-processor ready queues
+ * is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP)
+  #if !defined(CONFIGURE_SCHEDULER_NAME)
+    /** Configure the name of the scheduler instance */
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name('M', 'P', 'D', 'L')
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_CONTROLS)
+    /** Configure the context needed by the scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTEXT \
+      RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1, \
+        CONFIGURE_MAXIMUM_PROCESSORS \
+      )
+
+    /** Configure the controls for this scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTROLS \
+      RTEMS_SCHEDULER_CONTROL_PRIORITY_LOCAL_SMP( \
+        dflt, \
+        CONFIGURE_SCHEDULER_NAME \
+      )
+  #endif
+#endif
+
 /*
  * If the Deterministic Priority Affinity SMP Scheduler is selected, then configure for
  * it.
@@ -1001,6 +1035,35 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #endif
 #endif
 
+/*
+ * If the Clustered EDF SMP Scheduler is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP)
+  #if !defined(CONFIGURE_SCHEDULER_NAME)
+    /** Configure the name of the scheduler instance */
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name('M', 'C', 'E', 'D')
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_EDF_CLUSTER_SIZE)
+    /** Configure the count of processors per cluster */
+    #define CONFIGURE_SCHEDULER_EDF_CLUSTER_SIZE 4
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_CONTROLS)
+    /** Configure the context needed by the scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTEXT \
+      RTEMS_SCHEDULER_CONTEXT_EDF_CLUSTER_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PROCESSORS, \
+        CONFIGURE_SCHEDULER_EDF_CLUSTER_SIZE \
+      )
+
+    /** Configure the controls for this scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTROLS \
+      RTEMS_SCHEDULER_CONTROL_EDF_CLUSTER_SMP(dflt, CONFIGURE_SCHEDULER_NAME)
+  #endif
+#endif
+
 /*
  * If the CBS Scheduler is selected, then configure for it.
  */
@@ -1279,6 +1342,99 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
      _Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE )
 #endif
 
+/**
+ * If CONFIGURE_TASK_STACK_POOL is defined, then the task stacks are allocated
+ * by the task stack pool, see <rtems/stackpool.h>.  Freed stacks are recycled
+ * for later stack allocations of the same size class.  They are returned to
+ * the RTEMS Workspace only by rtems_stack_pool_trim().
+ */
+#ifdef CONFIGURE_TASK_STACK_POOL
+  #include <rtems/stackpool.h>
+
+  /**
+   * This specifies the stack sizes of the task stack pool size classes in
+   * ascending order.  At most eight size classes are allowed.  The default is
+   * one, two, four and eight times the minimum task stack size.
+   */
+  #ifndef CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES
+    #define CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES \
+      CONFIGURE_MINIMUM_TASK_STACK_SIZE, \
+      2 * CONFIGURE_MINIMUM_TASK_STACK_SIZE, \
+      4 * CONFIGURE_MINIMUM_TASK_STACK_SIZE, \
+      8 * CONFIGURE_MINIMUM_TASK_STACK_SIZE
+  #endif
+
+  #if defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_DEALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_ALLOCATOR_INIT)
+    #error "CONFIGURE_TASK_STACK_POOL cannot be used with a custom task stack allocator"
+  #endif
+
+  #define CONFIGURE_TASK_STACK_ALLOCATOR_INIT rtems_stack_pool_initialize
+  #define CONFIGURE_TASK_STACK_ALLOCATOR rtems_stack_pool_allocate
+  #define CONFIGURE_TASK_STACK_DEALLOCATOR rtems_stack_pool_free
+
+  /*
+   * A stack is rounded up to the next size class.  Stacks larger than the
+   * largest size class bypass the pool.  The padding with zero classes allows
+   * up to eight size classes.
+   */
+  #define _CONFIGURE_TASK_STACK_POOL_CLASS_COUNT_MAX 8
+
+  #define _Configure_Task_stack_pool_round_up(_stack_size) \
+    _Configure_Task_stack_pool_round_up_expand( \
+      _stack_size, \
+      CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES, \
+      0, 0, 0, 0, 0, 0, 0, 0 \
+    )
+
+  #define _Configure_Task_stack_pool_round_up_expand(...) \
+    _Configure_Task_stack_pool_round_up_8(__VA_ARGS__)
+
+  #define _Configure_Task_stack_pool_round_up_8( \
+    _s, _c0, _c1, _c2, _c3, _c4, _c5, _c6, _c7, ... \
+  ) \
+    ((_s) <= (_c0) ? (_c0) : (_s) <= (_c1) ? (_c1) : \
+      (_s) <= (_c2) ? (_c2) : (_s) <= (_c3) ? (_c3) : \
+      (_s) <= (_c4) ? (_c4) : (_s) <= (_c5) ? (_c5) : \
+      (_s) <= (_c6) ? (_c6) : (_s) <= (_c7) ? (_c7) : (_s))
+
+  #ifndef CONFIGURE_TASK_STACK_FROM_ALLOCATOR
+    #define CONFIGURE_TASK_STACK_FROM_ALLOCATOR(_stack_size) \
+      _Configure_From_workspace( \
+        _Configure_Task_stack_pool_round_up(_stack_size) \
+          + RTEMS_STACK_POOL_HEADER_SIZE \
+      )
+  #endif
+
+  #ifdef CONFIGURE_INIT
+    static const size_t _Configure_Task_stack_pool_sizes[] = {
+      CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES
+    };
+
+    RTEMS_STATIC_ASSERT(
+      RTEMS_ARRAY_SIZE( _Configure_Task_stack_pool_sizes )
+        <= _CONFIGURE_TASK_STACK_POOL_CLASS_COUNT_MAX,
+      _Configure_Task_stack_pool_sizes
+    );
+
+    static rtems_stack_pool_class _Configure_Task_stack_pool_classes[
+      RTEMS_ARRAY_SIZE( _Configure_Task_stack_pool_sizes )
+    ];
+
+    const rtems_stack_pool_configuration rtems_stack_pool_config = {
+      _Configure_Task_stack_pool_sizes,
+      _Configure_Task_stack_pool_classes,
+      RTEMS_ARRAY_SIZE( _Configure_Task_stack_pool_sizes ),
+      #ifdef CONFIGURE_TASK_STACK_POOL_GUARD_PATTERN
+        true
+      #else
+        false
+      #endif
+    };
+  #endif
+#endif
+
 /**
  * Configure the very much optional task stack allocator initialization
  */
@@ -1378,6 +1534,24 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       NULL;
     #endif
 #endif
+
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the per-processor caches of the C program heap.  They
+   * satisfy small allocations without the allocator mutex.
+   */
+  #if defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
+    static rtems_malloc_cache
+      _Configure_Malloc_cache_table[ CONFIGURE_MAXIMUM_PROCESSORS ];
+
+    rtems_malloc_cache * const rtems_malloc_cache_table =
+      &_Configure_Malloc_cache_table[ 0 ];
+  #else
+    rtems_malloc_cache * const rtems_malloc_cache_table = NULL;
+  #endif
+
+  const uint32_t rtems_malloc_cache_count = CONFIGURE_MAXIMUM_PROCESSORS;
+#endif
 /**@}*/  /* end of Malloc Configuration */
 
 /**
@@ -1437,7 +1611,9 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
 
 /**
  * This macro accounts for how memory for a set of configured objects is
- * allocated from the Executive Workspace.
+ * allocated from the Executive Workspace.  The local table page of unlimited
+ * objects may have up to twice the entries of the objects per allocation.
+ * The name hash index has at most four entries per object index.
  *
  * NOTE: It does NOT attempt to address the more complex case of unlimited
  *       objects.
@@ -1446,10 +1622,20 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     _Configure_From_workspace(_Configure_Max_Objects(_number) * (_size)) + \
     _Configure_From_workspace( \
       _Configure_Zero_or_One(_number) * ( \
-        (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Control *) + \
+        sizeof(Objects_Control **) + \
         _Configure_Align_up(sizeof(void *), CPU_ALIGNMENT) + \
         _Configure_Align_up(sizeof(uint32_t), CPU_ALIGNMENT) \
       ) \
+    ) + \
+    _Configure_From_workspace( \
+      _Configure_Zero_or_One(_number) * \
+        (1 + _Configure_Zero_or_One((_number) & RTEMS_UNLIMITED_OBJECTS)) * \
+        (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Control *) \
+    ) + \
+    _Configure_From_workspace( \
+      _Configure_Zero_or_One((_number) & RTEMS_NAME_HASH_OBJECTS) * \
+        (1 + _Configure_Zero_or_One((_number) & RTEMS_UNLIMITED_OBJECTS)) * \
+        4 * (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Maximum) \
     ) \
   )
 /**@}*/
@@ -1819,6 +2005,18 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY \
                               RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
   #endif
+  #ifndef CONFIGURE_BDBUF_CACHE_SHARDS
+    #define CONFIGURE_BDBUF_CACHE_SHARDS \
+                              RTEMS_BDBUF_CACHE_SHARDS_DEFAULT
+  #endif
+  #ifndef CONFIGURE_BDBUF_REPLACEMENT_POLICY
+    #define CONFIGURE_BDBUF_REPLACEMENT_POLICY \
+                              RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT
+  #endif
+  #ifndef CONFIGURE_SWAPOUT_DIRTY_RATIO
+    #define CONFIGURE_SWAPOUT_DIRTY_RATIO \
+                              RTEMS_BDBUF_SWAPOUT_DIRTY_RATIO_DEFAULT
+  #endif
   #ifdef CONFIGURE_INIT
     const rtems_bdbuf_config rtems_bdbuf_configuration = {
       CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS,
@@ -1832,7 +2030,10 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
       CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
       CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+      CONFIGURE_BDBUF_CACHE_SHARDS,
+      CONFIGURE_BDBUF_REPLACEMENT_POLICY,
+      CONFIGURE_SWAPOUT_DIRTY_RATIO
     };
   #endif
 
@@ -1857,11 +2058,13 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
      *   o disk lock
      *   o bdbuf lock
      *   o bdbuf sync lock
-     *   o bdbuf access condition
-     *   o bdbuf transfer condition
-     *   o bdbuf buffer condition
+     *   o bdbuf shard lock (per shard)
+     *   o bdbuf access condition (per shard)
+     *   o bdbuf transfer condition (per shard)
+     *   o bdbuf buffer condition (per shard)
      */
-    #define _CONFIGURE_LIBBLOCK_SEMAPHORES 6
+    #define _CONFIGURE_LIBBLOCK_SEMAPHORES \
+      (3 + 4 * CONFIGURE_BDBUF_CACHE_SHARDS)
   #endif
 
   #if defined(CONFIGURE_HAS_OWN_BDBUF_TABLE) || \
@@ -2841,7 +3044,9 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   (_CONFIGURE_NUMBER_OF_INITIAL_EXTENSIONS == 0 ? 0 : \
     _Configure_From_workspace( \
       _CONFIGURE_NUMBER_OF_INITIAL_EXTENSIONS \
-        * sizeof(User_extensions_Switch_control) \
+        * (sizeof(User_extensions_thread_switch_extension) \
+          + sizeof(User_extensions_thread_create_extension) \
+          + sizeof(User_extensions_thread_delete_extension)) \
     ))
 
 /**
@@ -3039,6 +3244,9 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #ifdef CONFIGURE_SCHEDULER_EDF_SMP
       Scheduler_EDF_SMP_Node EDF_SMP;
     #endif
+    #ifdef CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP
+      Scheduler_EDF_cluster_SMP_Node EDF_cluster_SMP;
+    #endif
     #ifdef CONFIGURE_SCHEDULER_PRIORITY
       Scheduler_priority_Node Priority;
     #endif
@@ -3048,6 +3256,9 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #ifdef CONFIGURE_SCHEDULER_PRIORITY_SMP
       Scheduler_priority_SMP_Node Priority_SMP;
     #endif
+    #ifdef CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP
+      Scheduler_priority_local_SMP_Node Priority_local_SMP;
+    #endif
     #ifdef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
       Scheduler_priority_affinity_SMP_Node Priority_affinity_SMP;
     #endif
@@ -3137,6 +3348,21 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   const uint64_t _Watchdog_Monotonic_max_seconds =
     UINT64_MAX / _CONFIGURE_TICKS_PER_SECOND;
 
+  /**
+   * This configures the timing wheels for the monotonic watchdogs of each
+   * processor.  Watchdogs with a timeout within the range of the timing
+   * wheel are inserted and removed in constant time.
+   */
+  #ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+    Watchdog_Wheel _Watchdog_Wheel_table[ CONFIGURE_MAXIMUM_PROCESSORS ];
+
+    RTEMS_SYSINIT_ITEM(
+      _Watchdog_Wheel_initialize,
+      RTEMS_SYSINIT_DATA_STRUCTURES,
+      RTEMS_SYSINIT_ORDER_LAST
+    );
+  #endif
+
   /**
    * This is the Classic API Configuration Table.
    */
@@ -3211,6 +3437,12 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #else
       false,
     #endif
+    #ifdef CONFIGURE_HEAP_SEGREGATED_FIT      /* true for segregated fit
+                                                 heaps */
+      true,
+    #else
+      false,
+    #endif
     #ifdef RTEMS_SMP
       #ifdef _CONFIGURE_SMP_APPLICATION
         true,
@@ -43,6 +43,21 @@ extern "C" {
 #define rtems_resource_maximum_per_allocation(resource) \
   _Objects_Maximum_per_allocation(resource)
 
+/*
+ *  Name hash index support.  Changes the configuration table entry for POSIX
+ *  or RTEMS APIs so that the object names of the class are indexed by a hash
+ *  table.  The ident and open directives of this class need then an average
+ *  constant time independent of the count of objects.
+ */
+
+#define RTEMS_NAME_HASH_OBJECTS OBJECTS_NAME_HASH_OBJECTS
+
+#define rtems_resource_name_hash(resource) \
+  ( resource | RTEMS_NAME_HASH_OBJECTS )
+
+#define rtems_resource_has_name_hash(resource) \
+  _Objects_Has_name_hash(resource)
+
 #include <rtems/score/watchdog.h>
 
 /*
@@ -231,6 +246,16 @@ typedef struct {
    */
   bool                           stack_allocator_avoids_work_space;
 
+  /**
+   * @brief Specifies if the RTEMS Workspace and the C Program Heap use a
+   * segregated fit free block index.
+   *
+   * If this element is @a true, then the heaps are initialized with
+   * _Heap_Initialize_segregated_fit() and allocations need a constant time,
+   * otherwise they use the first fit method.
+   */
+  bool                           heap_segregated_fit;
+
   #ifdef RTEMS_SMP
     bool                         smp_enabled;
   #endif
@@ -286,6 +311,9 @@ extern const rtems_configuration_table Configuration;
 #define rtems_configuration_get_stack_allocator_avoids_work_space() \
         (Configuration.stack_allocator_avoids_work_space)
 
+#define rtems_configuration_get_heap_segregated_fit() \
+        (Configuration.heap_segregated_fit)
+
 #define rtems_configuration_get_stack_space_size() \
         (Configuration.stack_space_size)
 
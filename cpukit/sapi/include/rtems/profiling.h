@@ -51,10 +51,10 @@ extern "C" {
  * dispatch latency.  On SMP configurations statistics of all SMP locks in the
  * system are available.
  *
- * Profiling information can be retrieved via rtems_profiling_iterate() and
- * reported as an XML dump via rtems_profiling_report_xml().  These functions
- * are always available, but actual profiling data is only available if enabled
- * at build configuration time.
+ * Profiling information can be retrieved via rtems_profiling_iterate(),
+ * reported as an XML dump via rtems_profiling_report_xml() and reset via
+ * rtems_profiling_reset().  These functions are always available, but actual
+ * profiling data is only available if enabled at build configuration time.
  *
  * @{
  */
@@ -324,6 +324,16 @@ int rtems_profiling_report_xml(
   const char *indentation
 );
 
+/**
+ * @brief Resets the profiling data of the system.
+ *
+ * The maximum values, counts and total times of the per-CPU and SMP lock
+ * profiling data are set to zero.  The SMP locks stay registered and keep
+ * their names.  Updates carried out concurrently on other processors may
+ * survive the reset.
+ */
+void rtems_profiling_reset( void );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -114,6 +114,39 @@
     }
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP
+  #include <rtems/score/scheduleredfclustersmp.h>
+
+  #define RTEMS_SCHEDULER_CONTEXT_EDF_CLUSTER_SMP_NAME( name ) \
+    RTEMS_SCHEDULER_CONTEXT_NAME( EDF_cluster_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_CONTEXT_EDF_CLUSTER_SMP( \
+    name, \
+    max_cpu_count, \
+    cpus_per_cluster \
+  ) \
+    static struct { \
+      Scheduler_EDF_cluster_SMP_Context Base; \
+      Scheduler_EDF_cluster_SMP_Cluster Clusters[ \
+        ( ( max_cpu_count ) + ( cpus_per_cluster ) - 1 ) / ( cpus_per_cluster ) \
+      ]; \
+    } RTEMS_SCHEDULER_CONTEXT_EDF_CLUSTER_SMP_NAME( name ) = { \
+      .Base = { \
+        .cluster_size = ( cpus_per_cluster ), \
+        .cluster_count = \
+          ( ( max_cpu_count ) + ( cpus_per_cluster ) - 1 ) / ( cpus_per_cluster ) \
+      } \
+    }
+
+  #define RTEMS_SCHEDULER_CONTROL_EDF_CLUSTER_SMP( name, obj_name ) \
+    { \
+      &RTEMS_SCHEDULER_CONTEXT_EDF_CLUSTER_SMP_NAME( name ).Base.Base.Base, \
+      SCHEDULER_EDF_CLUSTER_SMP_ENTRY_POINTS, \
+      SCHEDULER_EDF_MAXIMUM_PRIORITY, \
+      ( obj_name ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_PRIORITY
   #include <rtems/score/schedulerpriority.h>
 
@@ -183,6 +216,45 @@
     }
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP
+  #include <rtems/score/schedulerprioritylocalsmp.h>
+
+  #define RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ) \
+    RTEMS_SCHEDULER_CONTEXT_NAME( priority_local_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP( \
+    name, \
+    prio_count, \
+    max_cpu_count \
+  ) \
+    static struct { \
+      Scheduler_priority_local_SMP_Context Base; \
+      Scheduler_priority_local_SMP_Ready_queue \
+        Ready_queues[ ( max_cpu_count ) ]; \
+      Chain_Control Ready[ ( max_cpu_count ) ][ ( prio_count ) ]; \
+      Processor_mask Ready_queues_of_priority[ ( prio_count ) ]; \
+    } RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ) = { \
+      .Base = { \
+        .Ready_queues_of_priority = \
+          &RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ) \
+            .Ready_queues_of_priority[ 0 ], \
+        .Ready = &RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ) \
+          .Ready[ 0 ][ 0 ], \
+        .ready_queue_count = ( max_cpu_count ) \
+      } \
+    }
+
+  #define RTEMS_SCHEDULER_CONTROL_PRIORITY_LOCAL_SMP( name, obj_name ) \
+    { \
+      &RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ).Base.Base.Base, \
+      SCHEDULER_PRIORITY_LOCAL_SMP_ENTRY_POINTS, \
+      RTEMS_ARRAY_SIZE( \
+        RTEMS_SCHEDULER_CONTEXT_PRIORITY_LOCAL_SMP_NAME( name ).Ready[ 0 ] \
+      ) - 1, \
+      ( obj_name ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_STRONG_APA
   #include <rtems/score/schedulerstrongapa.h>
 
@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * @brief Task Stack Pool API
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_STACKPOOL_H
+#define _RTEMS_STACKPOOL_H
+
+#include <rtems.h>
+#include <rtems/chain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup StackPool Task Stack Pool
+ *
+ * @ingroup ClassicRTEMS
+ *
+ * @brief Task Stack Pool API.
+ *
+ * The task stack pool is a task stack allocator which recycles the stacks of
+ * deleted tasks.  The stack sizes are rounded up to the next size class.  Each
+ * size class has a pool of free stacks.  A stack allocation takes a stack from
+ * the pool of its size class (a hit) or allocates a new stack from the RTEMS
+ * Workspace (a miss).  A freed stack is returned to the pool of its size class.
+ * Stacks larger than the largest size class bypass the pool.  This avoids the
+ * fragmentation of the RTEMS Workspace and the heap allocation overhead in
+ * applications which create and delete tasks frequently.
+ *
+ * The free stacks of the pool are not returned to the RTEMS Workspace
+ * automatically, so the pool size is the peak stack demand of each size
+ * class.  Use rtems_stack_pool_trim() to return the free stacks to the RTEMS
+ * Workspace, e.g. after an application phase with many tasks.
+ *
+ * Optionally, free stacks are filled with the pattern of the stack checker.
+ * The guard area at the begin of a free stack is verified before the stack is
+ * reused to detect writes to free stacks.
+ *
+ * Use CONFIGURE_TASK_STACK_POOL to enable the task stack pool,
+ * CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES to define the size classes and
+ * CONFIGURE_TASK_STACK_POOL_GUARD_PATTERN to enable the guard pattern.
+ */
+/**@{*/
+
+/**
+ * @brief The byte pattern of free stacks.
+ *
+ * This is the pattern used by the stack checker.
+ */
+#define RTEMS_STACK_POOL_GUARD_BYTE 0xa5
+
+/**
+ * @brief The size of the guard area at the begin of a free stack in bytes.
+ */
+#define RTEMS_STACK_POOL_GUARD_SIZE 16
+
+/**
+ * @brief The size of the stack header in front of each stack managed by the
+ * stack pool.
+ */
+#define RTEMS_STACK_POOL_HEADER_SIZE \
+  ( ( sizeof( rtems_stack_pool_header ) + CPU_STACK_ALIGNMENT - 1 ) \
+    & ~( (size_t) CPU_STACK_ALIGNMENT - 1 ) )
+
+/**
+ * @brief Task stack pool statistics of a size class.
+ */
+typedef struct {
+  /**
+   * @brief The stack size of this size class in bytes.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief Count of stack allocations satisfied by a free stack of the pool.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of stack allocations satisfied by the RTEMS Workspace.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of stack allocations which failed.
+   */
+  uint32_t failures;
+
+  /**
+   * @brief Count of free stacks in the pool.
+   */
+  uint32_t free_stacks;
+
+  /**
+   * @brief Count of stacks with a modified guard pattern detected at reuse.
+   */
+  uint32_t guard_violations;
+} rtems_stack_pool_statistics;
+
+/**
+ * @brief Task stack pool size class control.
+ */
+typedef struct {
+  /**
+   * @brief Chain of free stack headers.
+   */
+  rtems_chain_control free_stacks;
+
+  /**
+   * @brief The statistics of this size class.
+   */
+  rtems_stack_pool_statistics stats;
+} rtems_stack_pool_class;
+
+/**
+ * @brief Task stack pool configuration.
+ *
+ * This structure is defined by the application configuration via
+ * <rtems/confdefs.h>.
+ */
+typedef struct {
+  /**
+   * @brief The stack sizes of the size classes in ascending order.
+   */
+  const size_t *stack_sizes;
+
+  /**
+   * @brief The size class controls with one entry for each size class.
+   */
+  rtems_stack_pool_class *classes;
+
+  /**
+   * @brief The count of size classes.
+   */
+  size_t class_count;
+
+  /**
+   * @brief If true, then free stacks are filled with the guard pattern.
+   */
+  bool guard_pattern;
+} rtems_stack_pool_configuration;
+
+/**
+ * @brief Header in front of each stack managed by the stack pool.
+ */
+typedef struct {
+  /**
+   * @brief Node for the chain of free stacks of the size class.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief The size class index or the class count for stacks which bypass
+   * the pool.
+   */
+  size_t class_index;
+} rtems_stack_pool_header;
+
+/**
+ * @brief The task stack pool configuration.
+ */
+extern const rtems_stack_pool_configuration rtems_stack_pool_config;
+
+/**
+ * @brief Initializes the task stack pool.
+ *
+ * This is the task stack allocator initialization hook.
+ *
+ * @param[in] stack_space_size The configured stack space size.  It is not
+ *   used.
+ */
+void rtems_stack_pool_initialize( size_t stack_space_size );
+
+/**
+ * @brief Allocates a task stack.
+ *
+ * This is the task stack allocator hook.
+ *
+ * @param[in] stack_size The stack size in bytes.
+ *
+ * @retval NULL Not enough memory.
+ * @retval other The begin address of the stack.
+ */
+void *rtems_stack_pool_allocate( size_t stack_size );
+
+/**
+ * @brief Frees a task stack.
+ *
+ * This is the task stack deallocator hook.  Stacks of a size class are
+ * returned to the pool of their size class.
+ *
+ * @param[in] stack The begin address of the stack.  It may be NULL.
+ */
+void rtems_stack_pool_free( void *stack );
+
+/**
+ * @brief Returns the free stacks of all size classes to the RTEMS Workspace.
+ *
+ * Stacks in use are not affected.  They return to the pool once they are
+ * freed.  This function must be called from thread context.
+ */
+void rtems_stack_pool_trim( void );
+
+/**
+ * @brief Gets the statistics of a size class.
+ *
+ * @param[in] class_index The size class index.
+ * @param[out] stats The statistics.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The statistics pointer is NULL.
+ * @retval RTEMS_INVALID_NUMBER Invalid size class index.
+ */
+rtems_status_code rtems_stack_pool_get_statistics(
+  size_t                       class_index,
+  rtems_stack_pool_statistics *stats
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_STACKPOOL_H */
@@ -0,0 +1,51 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smplock.h>
+#include <rtems.h>
+
+static void per_cpu_stats_reset(void)
+{
+#ifdef RTEMS_PROFILING
+  uint32_t n = rtems_get_processor_count();
+  uint32_t i;
+
+  for (i = 0; i < n; ++i) {
+    Per_CPU_Control *per_cpu = _Per_CPU_Get_by_index(i);
+    Per_CPU_Stats *stats = &per_cpu->Stats;
+    ISR_Level level;
+
+    _ISR_Local_disable(level);
+    stats->max_thread_dispatch_disabled_time = 0;
+    stats->max_interrupt_time = 0;
+    stats->max_interrupt_delay = 0;
+    stats->thread_dispatch_disabled_count = 0;
+    stats->total_thread_dispatch_disabled_time = 0;
+    stats->interrupt_count = 0;
+    stats->total_interrupt_time = 0;
+    _ISR_Local_enable(level);
+  }
+#endif
+}
+
+static void smp_lock_stats_reset(void)
+{
+#if defined(RTEMS_PROFILING) && defined(RTEMS_SMP)
+  _SMP_lock_Stats_reset();
+#endif
+}
+
+void rtems_profiling_reset(void)
+{
+  per_cpu_stats_reset();
+  smp_lock_stats_reset();
+}
@@ -0,0 +1,273 @@
+/**
+ * @file
+ *
+ * @brief Task Stack Pool
+ *
+ * @ingroup StackPool
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/stackpool.h>
+#include <rtems/rtems/intr.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+RTEMS_INTERRUPT_LOCK_DEFINE( static, stack_pool_lock, "Stack Pool" )
+
+static void stack_pool_acquire( rtems_interrupt_lock_context *lock_context )
+{
+  rtems_interrupt_lock_acquire( &stack_pool_lock, lock_context );
+}
+
+static void stack_pool_release( rtems_interrupt_lock_context *lock_context )
+{
+  rtems_interrupt_lock_release( &stack_pool_lock, lock_context );
+}
+
+static rtems_stack_pool_header *stack_pool_get_header( void *stack )
+{
+  return (rtems_stack_pool_header *)
+    ( (char *) stack - RTEMS_STACK_POOL_HEADER_SIZE );
+}
+
+static void *stack_pool_get_stack( rtems_stack_pool_header *header )
+{
+  return (char *) header + RTEMS_STACK_POOL_HEADER_SIZE;
+}
+
+static size_t stack_pool_find_class(
+  const rtems_stack_pool_configuration *config,
+  size_t                                stack_size
+)
+{
+  size_t class_index;
+
+  for (
+    class_index = 0 ;
+    class_index < config->class_count ;
+    ++class_index
+  ) {
+    if ( stack_size <= config->stack_sizes[ class_index ] ) {
+      break;
+    }
+  }
+
+  return class_index;
+}
+
+static bool stack_pool_is_guard_intact( const void *stack )
+{
+  const uint8_t *guard;
+  size_t         i;
+
+  guard = stack;
+
+  for ( i = 0 ; i < RTEMS_STACK_POOL_GUARD_SIZE ; ++i ) {
+    if ( guard[ i ] != RTEMS_STACK_POOL_GUARD_BYTE ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void rtems_stack_pool_initialize( size_t stack_space_size )
+{
+  const rtems_stack_pool_configuration *config;
+  size_t                                class_index;
+
+  (void) stack_space_size;
+  config = &rtems_stack_pool_config;
+
+  for (
+    class_index = 0 ;
+    class_index < config->class_count ;
+    ++class_index
+  ) {
+    rtems_stack_pool_class *pool_class;
+
+    pool_class = &config->classes[ class_index ];
+    rtems_chain_initialize_empty( &pool_class->free_stacks );
+    memset( &pool_class->stats, 0, sizeof( pool_class->stats ) );
+    pool_class->stats.stack_size = config->stack_sizes[ class_index ];
+  }
+}
+
+void *rtems_stack_pool_allocate( size_t stack_size )
+{
+  const rtems_stack_pool_configuration *config;
+  rtems_stack_pool_class               *pool_class;
+  rtems_stack_pool_header              *header;
+  rtems_interrupt_lock_context          lock_context;
+  size_t                                class_index;
+  void                                 *stack;
+
+  config = &rtems_stack_pool_config;
+  class_index = stack_pool_find_class( config, stack_size );
+
+  if ( class_index >= config->class_count ) {
+    header = _Workspace_Allocate( RTEMS_STACK_POOL_HEADER_SIZE + stack_size );
+
+    if ( header == NULL ) {
+      return NULL;
+    }
+
+    header->class_index = config->class_count;
+    return stack_pool_get_stack( header );
+  }
+
+  pool_class = &config->classes[ class_index ];
+
+  stack_pool_acquire( &lock_context );
+  header = (rtems_stack_pool_header *)
+    _Chain_Get_unprotected( &pool_class->free_stacks );
+
+  if ( header != NULL ) {
+    ++pool_class->stats.hits;
+    --pool_class->stats.free_stacks;
+  }
+
+  stack_pool_release( &lock_context );
+
+  if ( header != NULL ) {
+    stack = stack_pool_get_stack( header );
+
+    if ( config->guard_pattern && !stack_pool_is_guard_intact( stack ) ) {
+      stack_pool_acquire( &lock_context );
+      ++pool_class->stats.guard_violations;
+      stack_pool_release( &lock_context );
+    }
+
+    return stack;
+  }
+
+  header = _Workspace_Allocate(
+    RTEMS_STACK_POOL_HEADER_SIZE + config->stack_sizes[ class_index ]
+  );
+
+  stack_pool_acquire( &lock_context );
+
+  if ( header != NULL ) {
+    ++pool_class->stats.misses;
+  } else {
+    ++pool_class->stats.failures;
+  }
+
+  stack_pool_release( &lock_context );
+
+  if ( header == NULL ) {
+    return NULL;
+  }
+
+  header->class_index = class_index;
+  return stack_pool_get_stack( header );
+}
+
+void rtems_stack_pool_free( void *stack )
+{
+  const rtems_stack_pool_configuration *config;
+  rtems_stack_pool_class               *pool_class;
+  rtems_stack_pool_header              *header;
+  rtems_interrupt_lock_context          lock_context;
+
+  if ( stack == NULL ) {
+    return;
+  }
+
+  config = &rtems_stack_pool_config;
+  header = stack_pool_get_header( stack );
+
+  if ( header->class_index >= config->class_count ) {
+    _Workspace_Free( header );
+    return;
+  }
+
+  pool_class = &config->classes[ header->class_index ];
+
+  if ( config->guard_pattern ) {
+    memset(
+      stack,
+      RTEMS_STACK_POOL_GUARD_BYTE,
+      config->stack_sizes[ header->class_index ]
+    );
+  }
+
+  stack_pool_acquire( &lock_context );
+  _Chain_Prepend_unprotected( &pool_class->free_stacks, &header->node );
+  ++pool_class->stats.free_stacks;
+  stack_pool_release( &lock_context );
+}
+
+void rtems_stack_pool_trim( void )
+{
+  const rtems_stack_pool_configuration *config;
+  size_t                                class_index;
+
+  config = &rtems_stack_pool_config;
+
+  for (
+    class_index = 0 ;
+    class_index < config->class_count ;
+    ++class_index
+  ) {
+    rtems_stack_pool_class *pool_class;
+
+    pool_class = &config->classes[ class_index ];
+
+    while ( true ) {
+      rtems_stack_pool_header      *header;
+      rtems_interrupt_lock_context  lock_context;
+
+      stack_pool_acquire( &lock_context );
+      header = (rtems_stack_pool_header *)
+        _Chain_Get_unprotected( &pool_class->free_stacks );
+
+      if ( header != NULL ) {
+        --pool_class->stats.free_stacks;
+      }
+
+      stack_pool_release( &lock_context );
+
+      if ( header == NULL ) {
+        break;
+      }
+
+      _Workspace_Free( header );
+    }
+  }
+}
+
+rtems_status_code rtems_stack_pool_get_statistics(
+  size_t                       class_index,
+  rtems_stack_pool_statistics *stats
+)
+{
+  const rtems_stack_pool_configuration *config;
+  rtems_interrupt_lock_context          lock_context;
+
+  if ( stats == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  config = &rtems_stack_pool_config;
+
+  if ( class_index >= config->class_count ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  stack_pool_acquire( &lock_context );
+  *stats = config->classes[ class_index ].stats;
+  stack_pool_release( &lock_context );
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -21,6 +21,7 @@
 
 #include <rtems/score/chain.h>
 #include <rtems/score/isrlock.h>
+#include <rtems/score/rbtree.h>
 #include <rtems/score/threadq.h>
 #include <rtems/score/watchdog.h>
 
@@ -94,6 +95,13 @@ typedef struct {
   #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
     /** This field is the priority of this message. */
     int                        priority;
+    /**
+     * @brief Node for the pending message priority index.
+     *
+     * Only the last pending message of each priority group is in the index,
+     * see CORE_message_queue_Control::Pending_priorities.
+     */
+    RBTree_Node                Priority_node;
   #endif
   /** This field points to the contents of the message. */
   CORE_message_queue_Buffer  Contents;
@@ -158,6 +166,19 @@ struct CORE_message_queue_Control {
    *  message priority or in FIFO order.
    */
   Chain_Control                      Pending_messages;
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    /**
+     * @brief Index of the pending messages ordered by message priority.
+     *
+     * The pending messages are kept in ascending priority order.  This
+     * red-black tree contains the last pending message of each distinct
+     * priority.  A new message of a certain priority is inserted after the
+     * last message of the same or the next higher priority present in the
+     * queue, so the insert operation is logarithmic in the count of distinct
+     * priorities and not linear in the count of pending messages.
+     */
+    RBTree_Control                   Pending_priorities;
+  #endif
   /** This is the address of the memory allocated for message buffers.
    *  It is allocated are part of message queue initialization and freed
    *  as part of destroying it.
@@ -173,6 +194,12 @@ struct CORE_message_queue_Control {
    *  when it does not contain a pending message.
    */
   Chain_Control                      Inactive_messages;
+  /** This field is true, if the ownership of message buffers is passed to
+   *  the receivers instead of copying the message content.  In this mode,
+   *  receivers must release the message buffers after use and senders may
+   *  fill a message buffer obtained from the message queue in place.
+   */
+  bool                               zero_copy;
 };
 
 /**@}*/
@@ -81,6 +81,8 @@ typedef int CORE_message_queue_Submit_types;
  *         that will be allowed to pend at any given time
  *  @param[in] maximum_message_size is the size of largest message that
  *         may be sent to this message queue instance
+ *  @param[in] zero_copy indicates if the ownership of message buffers is
+ *         passed to the receivers instead of copying the message content
  *
  *  @retval true if the message queue can be initialized.  In general,
  *         false will only be returned if memory for the pending
@@ -90,7 +92,8 @@ bool _CORE_message_queue_Initialize(
   CORE_message_queue_Control     *the_message_queue,
   CORE_message_queue_Disciplines  discipline,
   uint32_t                        maximum_pending_messages,
-  size_t                          maximum_message_size
+  size_t                          maximum_message_size,
+  bool                            zero_copy
 );
 
 /**
@@ -270,6 +273,115 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ *  @brief Insert a message buffer into the message queue.
+ *
+ *  Inserts the message into the message queue according to the submit type
+ *  without a copy of the message content.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message to enqueue
+ *  @param[in] content_size the message content size in bytes
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Insert_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             content_size,
+  CORE_message_queue_Submit_types    submit_type
+);
+
+/**
+ *  @brief Get a message buffer from a zero-copy message queue.
+ *
+ *  The caller becomes the owner of an inactive message buffer.  It may fill
+ *  in the message content and submit it via
+ *  _CORE_message_queue_Submit_buffer() or give it back via
+ *  _CORE_message_queue_Release_buffer().  This operation does not block.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[out] the_message_p points to the variable that will contain the
+ *         message buffer
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ *  @retval STATUS_SUCCESSFUL Successful operation.
+ *  @retval STATUS_NOT_DEFINED This is not a zero-copy message queue.
+ *  @retval STATUS_TOO_MANY All message buffers are in use.
+ */
+Status_Control _CORE_message_queue_Get_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  CORE_message_queue_Buffer_control **the_message_p,
+  Thread_queue_Context               *queue_context
+);
+
+/**
+ *  @brief Submit a message buffer to a zero-copy message queue.
+ *
+ *  The ownership of the message buffer is passed to the first waiting
+ *  receiver or the message is inserted into the pending messages.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer owned by the caller
+ *  @param[in] size is the size of the message content
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ *  @retval indication of the successful completion or reason for failure
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+);
+
+/**
+ *  @brief Seize a message buffer from a zero-copy message queue.
+ *
+ *  The caller becomes the owner of the first pending message buffer.  It
+ *  must give it back via _CORE_message_queue_Release_buffer() after use.
+ *  The thread will be blocked if wait is true and no message is pending.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing is the executing thread
+ *  @param[out] the_message_p points to the variable that will contain the
+ *         message buffer
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ *  @retval indication of the successful completion or reason for failure
+ *
+ *  @note Returns message priority via return area in TCB.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+);
+
+/**
+ *  @brief Release a message buffer to a zero-copy message queue.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer owned by the caller
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ */
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+);
+
 RTEMS_INLINE_ROUTINE Status_Control _CORE_message_queue_Send(
   CORE_message_queue_Control       *the_message_queue,
   const void                       *buffer,
@@ -345,6 +457,21 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Copy_buffer (
   memcpy(destination, source, size);
 }
 
+/**
+ * This function returns the size of a message buffer including the message
+ * buffer control of @a the_message_queue.
+ */
+RTEMS_INLINE_ROUTINE size_t _CORE_message_queue_Buffer_size(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  size_t align_mask;
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  return ( ( the_message_queue->maximum_message_size + align_mask )
+    & ~align_mask ) + sizeof( CORE_message_queue_Buffer_control );
+}
+
 /**
  * This function allocates a message buffer from the inactive
  * message buffer chain.
@@ -370,6 +497,42 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * This function returns the message buffer of @a the_message_queue which
+ * contains the message content at @a buffer.  In case @a buffer is not the
+ * content of a message buffer owned by an application, then NULL is returned.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_buffer_control(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  uintptr_t                          begin;
+  uintptr_t                          offset;
+  size_t                             buffer_size;
+
+  the_message = RTEMS_CONTAINER_OF(
+    buffer,
+    CORE_message_queue_Buffer_control,
+    Contents.buffer
+  );
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) the_message - begin;
+  buffer_size = _CORE_message_queue_Buffer_size( the_message_queue );
+
+  if (
+    offset / buffer_size >= the_message_queue->maximum_pending_messages
+      || offset % buffer_size != 0
+      || !_Chain_Is_node_off_chain( &the_message->Node )
+  ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
 /**
  * This function returns the priority of @a the_message.
  *
@@ -396,8 +559,36 @@ RTEMS_INLINE_ROUTINE
   CORE_message_queue_Control *the_message_queue
 )
 {
-  return (CORE_message_queue_Buffer_control *)
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = (CORE_message_queue_Buffer_control *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    if ( the_message != NULL ) {
+      const Chain_Node *next;
+
+      /*
+       *  The pending messages are in priority order.  In case the next
+       *  message has a different priority, then this was the last message of
+       *  its priority group and thus in the priority index.
+       */
+      next = _Chain_Immutable_first( &the_message_queue->Pending_messages );
+
+      if (
+        _Chain_Is_tail( &the_message_queue->Pending_messages, next )
+          || ( (const CORE_message_queue_Buffer_control *) next )->priority
+            != the_message->priority
+      ) {
+        _RBTree_Extract(
+          &the_message_queue->Pending_priorities,
+          &the_message->Priority_node
+        );
+      }
+    }
+  #endif
+
+  return the_message;
 }
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
@@ -431,6 +622,38 @@ RTEMS_INLINE_ROUTINE
     do { } while ( 0 )
 #endif
 
+/**
+ * This routine releases @a the_message_queue after a message was inserted
+ * into the pending messages.  It invokes the notification handler in case
+ * the message queue transitioned from zero to one pending messages.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Release_and_notify(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  /*
+   *  According to POSIX, does this happen before or after the message
+   *  is actually enqueued.  It is logical to think afterwards, because
+   *  the message is actually in the queue at this point.
+   */
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+}
+
 RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
   CORE_message_queue_Control      *the_message_queue,
   const void                      *buffer,
@@ -465,14 +688,41 @@ RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
-   *(size_t *) the_thread->Wait.return_argument = size;
-   the_thread->Wait.count = (uint32_t) submit_type;
+  if ( the_message_queue->zero_copy ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    /*
+     *  The waiting receivers of a zero-copy message queue take over a
+     *  message buffer.
+     */
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+
+    _Chain_Set_off_chain( &the_message->Node );
+    the_message->Contents.size = size;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    the_message->priority = submit_type;
+#endif
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_message->Contents.buffer,
+      size
+    );
+    *(CORE_message_queue_Buffer_control **)
+      the_thread->Wait.return_argument_second.mutable_object = the_message;
+  } else {
+    *(size_t *) the_thread->Wait.return_argument = size;
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+  }
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
+  the_thread->Wait.count = (uint32_t) submit_type;
 
   _Thread_queue_Extract_critical(
     &the_message_queue->Wait_queue.Queue,
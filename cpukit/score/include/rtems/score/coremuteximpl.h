@@ -143,12 +143,27 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Seize(
 {
   Thread_Control *owner;
 
+#if defined(RTEMS_SMP)
+  if (
+    _Thread_queue_Queue_try_set_owner(
+      &the_mutex->Mutex.Wait_queue.Queue,
+      executing
+    )
+  ) {
+    _Thread_Resource_count_increment( executing );
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   _CORE_mutex_Acquire_critical( &the_mutex->Mutex, queue_context );
 
-  owner = _CORE_mutex_Get_owner( &the_mutex->Mutex );
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &the_mutex->Mutex.Wait_queue.Queue,
+    executing
+  );
 
   if ( owner == NULL ) {
-    _CORE_mutex_Set_owner( &the_mutex->Mutex, executing );
     _Thread_Resource_count_increment( executing );
     _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
     return STATUS_SUCCESSFUL;
@@ -181,6 +196,27 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Surrender(
   unsigned int        nest_level;
   Thread_queue_Heads *heads;
 
+#if defined(RTEMS_SMP)
+  /*
+   * The priority inheritance operations use the thread queue owner, so
+   * priority inheritance mutexes are released with the thread queue lock.
+   */
+  if (
+    operations != CORE_MUTEX_TQ_PRIORITY_INHERIT_OPERATIONS
+      && _CORE_mutex_Is_owner( &the_mutex->Mutex, executing )
+      && the_mutex->nest_level == 0
+      && _Thread_queue_Queue_release_owner_fast(
+        &the_mutex->Mutex.Wait_queue.Queue,
+        executing,
+        operations,
+        queue_context
+      )
+  ) {
+    _Thread_Resource_count_decrement( executing );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   _CORE_mutex_Acquire_critical( &the_mutex->Mutex, queue_context );
 
   if ( !_CORE_mutex_Is_owner( &the_mutex->Mutex, executing ) ) {
@@ -197,11 +233,13 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Surrender(
   }
 
   _Thread_Resource_count_decrement( executing );
-  _CORE_mutex_Set_owner( &the_mutex->Mutex, NULL );
 
   heads = the_mutex->Mutex.Wait_queue.Queue.heads;
 
   if ( heads == NULL ) {
+    _Thread_queue_Queue_clear_owner_critical(
+      &the_mutex->Mutex.Wait_queue.Queue
+    );
     _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
     return STATUS_SUCCESSFUL;
   }
@@ -42,6 +42,11 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally, the free list may be indexed by a segregated fit free block
+ * index (see @ref Heap_Segregated_index).  In this case, the free list is kept
+ * sorted by free block size classes and allocations use a good fit method
+ * with a constant time search.
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -336,6 +341,58 @@ typedef struct {
   uint32_t resizes;
 } Heap_Statistics;
 
+/**
+ * @brief Log2 of the count of second level classes of the segregated fit
+ * free block index.
+ *
+ * Each first level class covers a power of two size range.  This range is
+ * subdivided into second level classes of equal width.
+ */
+#define HEAP_SEGREGATED_SL_COUNT_LOG2 4
+
+/**
+ * @brief Count of second level classes of the segregated fit free block index.
+ */
+#define HEAP_SEGREGATED_SL_COUNT (1U << HEAP_SEGREGATED_SL_COUNT_LOG2)
+
+/**
+ * @brief Count of first level classes of the segregated fit free block index.
+ *
+ * The last first level class contains also all blocks which are too large
+ * for a first level class of their own.
+ */
+#define HEAP_SEGREGATED_FL_COUNT 32
+
+/**
+ * @brief Segregated fit free block index.
+ *
+ * This is a two-level bitmap index of free block classes similar to the Two
+ * Level Segregated Fit (TLSF) allocator.  The free list of the heap is kept
+ * sorted by free block class.  For each non-empty class the index provides
+ * the first free block of this class in the free list.  The bitmaps indicate
+ * which classes are non-empty.  This enables allocation and free operations
+ * in constant time.
+ *
+ * @see _Heap_Initialize_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief Bit @a fl is set if a second level bitmap @a fl is not zero.
+   */
+  uint32_t fl_bitmap;
+
+  /**
+   * @brief Bit @a sl of bitmap @a fl is set if the class (@a fl, @a sl) is
+   * not empty.
+   */
+  uint32_t sl_bitmap[ HEAP_SEGREGATED_FL_COUNT ];
+
+  /**
+   * @brief The first free block of each class in the free list.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FL_COUNT ][ HEAP_SEGREGATED_SL_COUNT ];
+} Heap_Segregated_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -348,6 +405,14 @@ struct Heap_Control {
   Heap_Block *first_block;
   Heap_Block *last_block;
   Heap_Statistics stats;
+
+  /**
+   * @brief The segregated fit free block index.
+   *
+   * In case this pointer is @c NULL, then the heap uses the first fit method,
+   * otherwise the free list is indexed by this segregated fit index.
+   */
+  Heap_Segregated_index *segregated_index;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
   #endif
@@ -400,7 +465,8 @@ typedef struct {
  * table of Heap_Area elements and iterate through it.  Set the handler to
  * _Heap_Initialize() in the first iteration and then to _Heap_Extend().
  *
- * @see Heap_Area, _Heap_Initialize(), _Heap_Extend(), or _Heap_No_extend().
+ * @see Heap_Area, _Heap_Initialize(), _Heap_Initialize_segregated_fit(),
+ * _Heap_Extend(), or _Heap_No_extend().
  */
 typedef uintptr_t (*Heap_Initialization_or_extend_handler)(
   Heap_Control *heap,
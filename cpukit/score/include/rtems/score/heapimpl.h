@@ -91,6 +91,28 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Initializes the heap control block @a heap to manage the area
+ * starting at @a area_begin of size @a area_size bytes with a segregated fit
+ * free block index.
+ *
+ * The segregated fit free block index (see @ref Heap_Segregated_index) is
+ * placed at the begin of the area.  The remaining area is initialized via
+ * _Heap_Initialize().  Allocation and free operations of this heap need a
+ * constant time in case no alignment or boundary constraints are specified.
+ * The heap may be extended with _Heap_Extend().
+ *
+ * Returns the maximum memory available, or zero in case of failure.
+ *
+ * @see Heap_Initialization_or_extend_handler.
+ */
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
 /**
  * @brief Allocates a memory area of size @a size bytes from the heap @a heap.
  *
@@ -293,6 +315,8 @@ Heap_Resize_status _Heap_Resize_block(
  * inserted into the free list or merged with an adjacent free block.  If the
  * block is used, they will be inserted after the free list head.  If the block
  * is free, they will be inserted after the previous block in the free list.
+ * In case the heap uses a segregated fit free block index, they will be
+ * inserted according to their free block class.
  *
  * Inappropriate values for @a alloc_begin or @a alloc_size may corrupt the
  * heap.
@@ -440,6 +464,186 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+RTEMS_INLINE_ROUTINE bool _Heap_Is_segregated_fit( const Heap_Control *heap )
+{
+  return heap->segregated_index != NULL;
+}
+
+/**
+ * @brief Returns the index of the most significant bit set in @a value.
+ *
+ * The @a value must not be zero.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _Heap_Segregated_fls( uintptr_t value )
+{
+  return (unsigned int) ( sizeof( unsigned long ) * 8 - 1 )
+    - (unsigned int) __builtin_clzl( (unsigned long) value );
+}
+
+/**
+ * @brief Maps the block size @a size to the free block class
+ * (@a fl, @a sl).
+ *
+ * The mapping is monotonic, so the free list sorted by classes is also
+ * roughly sorted by block size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_mapping(
+  uintptr_t size,
+  unsigned int *fl,
+  unsigned int *sl
+)
+{
+  unsigned int msb = _Heap_Segregated_fls( size );
+
+  if ( msb >= HEAP_SEGREGATED_FL_COUNT ) {
+    *fl = HEAP_SEGREGATED_FL_COUNT - 1;
+    *sl = HEAP_SEGREGATED_SL_COUNT - 1;
+  } else if ( msb >= HEAP_SEGREGATED_SL_COUNT_LOG2 ) {
+    *fl = msb;
+    *sl = (unsigned int) ( size >> ( msb - HEAP_SEGREGATED_SL_COUNT_LOG2 ) )
+      - HEAP_SEGREGATED_SL_COUNT;
+  } else {
+    *fl = msb;
+    *sl = (unsigned int) ( size << ( HEAP_SEGREGATED_SL_COUNT_LOG2 - msb ) )
+      - HEAP_SEGREGATED_SL_COUNT;
+  }
+}
+
+/**
+ * @brief Inserts the free block @a block into the free list of the heap
+ * @a heap according to its free block class.
+ *
+ * The block size must be valid.  The heap must use a segregated fit free
+ * block index.
+ */
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block @a block from the free list of the heap
+ * @a heap.
+ *
+ * The block size must be the one used to insert the block.  The heap must use
+ * a segregated fit free block index.
+ */
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Sets the size of the free block @a block to @a size and moves it to
+ * its new free block class if necessary.
+ *
+ * The heap must use a segregated fit free block index.
+ */
+void _Heap_Segregated_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+);
+
+/**
+ * @brief Returns the first free block which may satisfy an allocation request
+ * for a block of at least @a size bytes.
+ *
+ * In case no alignment constraints are present, this block is large enough.
+ * The free list tail is returned if no such block exists.  The heap must use
+ * a segregated fit free block index.
+ */
+Heap_Block *_Heap_Segregated_first_candidate(
+  Heap_Control *heap,
+  uintptr_t size
+);
+
+/**
+ * @brief Returns the free block to start the search for a free block of at
+ * least @a size bytes.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_list_first_candidate(
+  Heap_Control *heap,
+  uintptr_t size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Segregated_first_candidate( heap, size );
+  }
+
+  return _Heap_Free_list_first( heap );
+}
+
+/**
+ * @brief Inserts the free block @a block into the free list of the heap
+ * @a heap.
+ *
+ * The block size must be valid.  In case the heap uses the first fit method,
+ * then the block is inserted after @a block_before, otherwise it is inserted
+ * according to its free block class.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *block_before,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    _Heap_Free_list_insert_after( block_before, block );
+  }
+}
+
+/**
+ * @brief Removes the free block @a block from the free list of the heap
+ * @a heap.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_remove( heap, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces the free block @a old_block with the free block
+ * @a new_block in the free list of the heap @a heap.
+ *
+ * The size of the new block must be valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_remove( heap, old_block );
+    _Heap_Segregated_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of the free block @a block which is part of the free
+ * list of the heap @a heap to @a size.
+ *
+ * The previous block of a free block is always used.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_set_size( heap, block, size );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
 RTEMS_INLINE_ROUTINE bool _Heap_Is_aligned(
   uintptr_t value,
   uintptr_t alignment
@@ -0,0 +1,302 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreMPSCRing
+ *
+ * @brief Multiple Producer Single Consumer Ring API
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_MPSCRING_H
+#define _RTEMS_SCORE_MPSCRING_H
+
+#include <sys/lock.h>
+
+#include <rtems/score/basedefs.h>
+#include <rtems/score/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ScoreMPSCRing Multiple Producer Single Consumer Ring Handler
+ *
+ * @ingroup Score
+ *
+ * The MPSC Ring Handler provides a bounded, lock-free ring of item pointers
+ * with an arbitrary count of producers and exactly one consumer thread.  The
+ * producers may be interrupt service routines on any processor.  They
+ * neither disable interrupts nor acquire a lock to enqueue an item.  Each
+ * slot carries a sequence number which tells whether it is free for the
+ * producer of a particular ring position or ready for the consumer.
+ *
+ * The consumer thread may block on the ring in case it is empty.  It
+ * announces this via a waiting indicator.  Only a producer which observes
+ * this indicator takes the slow path and wakes up the consumer via a
+ * self-contained semaphore.  In the common case, when the consumer is busy,
+ * the enqueue operation is a single compare-and-swap plus a store.
+ *
+ * @{
+ */
+
+/**
+ * @brief A ring slot.
+ */
+typedef struct {
+  /**
+   * @brief The sequence number of this slot.
+   *
+   * A value equal to the enqueue position of a producer indicates a free
+   * slot.  A value of the enqueue position plus one indicates a slot ready
+   * for the consumer.
+   */
+  Atomic_Uint sequence;
+
+  /**
+   * @brief The item stored in this slot.
+   */
+  void *item;
+} MPSC_ring_Slot;
+
+/**
+ * @brief The MPSC ring control.
+ */
+typedef struct {
+  /**
+   * @brief The next enqueue position shared by all producers.
+   */
+  Atomic_Uint enqueue_position;
+
+  /**
+   * @brief Indicates that the consumer is about to block or is blocked.
+   */
+  Atomic_Uint consumer_waiting;
+
+  /**
+   * @brief The next dequeue position.
+   *
+   * This member is only accessed by the consumer.
+   */
+  unsigned int dequeue_position;
+
+  /**
+   * @brief The slot count minus one.
+   */
+  unsigned int mask;
+
+  /**
+   * @brief The slot table.
+   */
+  MPSC_ring_Slot *slots;
+
+  /**
+   * @brief Count of items rejected due to a full ring.
+   */
+  Atomic_Uint overruns;
+
+  /**
+   * @brief The semaphore to wake up the consumer.
+   */
+  struct _Semaphore_Control Wakeup;
+} MPSC_ring_Control;
+
+/**
+ * @brief Initializes an MPSC ring.
+ *
+ * @param[in] ring The MPSC ring to initialize.
+ * @param[in] slots The slot table.
+ * @param[in] slot_count The slot count.  It must be a power of two.
+ */
+void _MPSC_ring_Initialize(
+  MPSC_ring_Control *ring,
+  MPSC_ring_Slot    *slots,
+  unsigned int       slot_count
+);
+
+/**
+ * @brief Destroys an MPSC ring.
+ *
+ * The consumer must not be blocked on the ring.
+ *
+ * @param[in] ring The MPSC ring to destroy.
+ */
+void _MPSC_ring_Destroy( MPSC_ring_Control *ring );
+
+/**
+ * @brief Wakes up the consumer of an MPSC ring.
+ *
+ * This is the slow path of the enqueue operation.  It is only used in case
+ * the consumer indicated that it waits for items.
+ *
+ * @param[in] ring The MPSC ring.
+ */
+void _MPSC_ring_Wake_up_consumer( MPSC_ring_Control *ring );
+
+/**
+ * @brief Dequeues an item from an MPSC ring and blocks the executing thread
+ * until an item is available.
+ *
+ * Only the consumer thread of the ring may call this function.
+ *
+ * @param[in] ring The MPSC ring.
+ *
+ * @return The dequeued item.
+ */
+void *_MPSC_ring_Dequeue( MPSC_ring_Control *ring );
+
+/**
+ * @brief Returns the slot count of an MPSC ring.
+ *
+ * @param[in] ring The MPSC ring.
+ *
+ * @return The slot count.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _MPSC_ring_Get_slot_count(
+  const MPSC_ring_Control *ring
+)
+{
+  return ring->mask + 1;
+}
+
+/**
+ * @brief Returns the count of items rejected due to a full MPSC ring.
+ *
+ * @param[in] ring The MPSC ring.
+ *
+ * @return The overrun count.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _MPSC_ring_Get_overruns(
+  const MPSC_ring_Control *ring
+)
+{
+  return _Atomic_Load_uint( &ring->overruns, ATOMIC_ORDER_RELAXED );
+}
+
+/**
+ * @brief Enqueues an item to an MPSC ring.
+ *
+ * This function may be called concurrently by threads and interrupt service
+ * routines on any processor.  It does not disable interrupts and does not
+ * acquire a lock unless the consumer must be woken up.
+ *
+ * @param[in] ring The MPSC ring.
+ * @param[in] item The item to enqueue.  It must not be NULL.
+ *
+ * @retval true Successful operation.
+ * @retval false The ring is full.  The overrun count is incremented.
+ */
+RTEMS_INLINE_ROUTINE bool _MPSC_ring_Enqueue(
+  MPSC_ring_Control *ring,
+  void              *item
+)
+{
+  MPSC_ring_Slot *slot;
+  unsigned int    position;
+
+  position = _Atomic_Load_uint(
+    &ring->enqueue_position,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  while ( true ) {
+    unsigned int sequence;
+    int          delta;
+
+    slot = &ring->slots[ position & ring->mask ];
+    sequence = _Atomic_Load_uint( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+    delta = (int) ( sequence - position );
+
+    if ( delta == 0 ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &ring->enqueue_position,
+          &position,
+          position + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( delta < 0 ) {
+      _Atomic_Fetch_add_uint( &ring->overruns, 1, ATOMIC_ORDER_RELAXED );
+      return false;
+    } else {
+      position = _Atomic_Load_uint(
+        &ring->enqueue_position,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  slot->item = item;
+  _Atomic_Store_uint( &slot->sequence, position + 1, ATOMIC_ORDER_RELEASE );
+
+  /*
+   * Pairs with the fence in _MPSC_ring_Dequeue() so that either the consumer
+   * observes the new item or we observe the waiting consumer.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if (
+    _Atomic_Load_uint( &ring->consumer_waiting, ATOMIC_ORDER_RELAXED ) != 0
+  ) {
+    _MPSC_ring_Wake_up_consumer( ring );
+  }
+
+  return true;
+}
+
+/**
+ * @brief Tries to dequeue an item from an MPSC ring.
+ *
+ * Only the consumer of the ring may call this function.  An item enqueued
+ * by a producer which is interrupted or preempted between the reservation
+ * and the publication of its slot is not visible before the publication.
+ * Items enqueued after it are also held back to preserve the ring order.
+ *
+ * @param[in] ring The MPSC ring.
+ *
+ * @retval NULL The ring is empty.
+ * @retval item The dequeued item.
+ */
+RTEMS_INLINE_ROUTINE void *_MPSC_ring_Try_dequeue( MPSC_ring_Control *ring )
+{
+  MPSC_ring_Slot *slot;
+  unsigned int    position;
+  unsigned int    sequence;
+  void           *item;
+
+  position = ring->dequeue_position;
+  slot = &ring->slots[ position & ring->mask ];
+  sequence = _Atomic_Load_uint( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+
+  if ( (int) ( sequence - ( position + 1 ) ) < 0 ) {
+    return NULL;
+  }
+
+  item = slot->item;
+  ring->dequeue_position = position + 1;
+  _Atomic_Store_uint(
+    &slot->sequence,
+    position + ring->mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+
+  return item;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -107,6 +107,8 @@ typedef uint8_t    Objects_Maximum;
 
 #define OBJECTS_UNLIMITED_OBJECTS 0x8000U
 
+#define OBJECTS_NAME_HASH_OBJECTS 0x4000U
+
 #define OBJECTS_ID_INITIAL_INDEX  (0)
 #define OBJECTS_ID_FINAL_INDEX    (0xff)
 
@@ -201,6 +203,12 @@ typedef uint16_t   Objects_Maximum;
  */
 #define OBJECTS_UNLIMITED_OBJECTS 0x80000000U
 
+/**
+ *  Mask to enable the name hash index.  This is used in the configuration
+ *  table when specifying the number of configured objects.
+ */
+#define OBJECTS_NAME_HASH_OBJECTS 0x40000000U
+
 /**
  *  This is the lowest value for the index portion of an object Id.
  */
@@ -450,12 +458,26 @@ RTEMS_INLINE_ROUTINE bool _Objects_Is_unlimited( uint32_t maximum )
   return (maximum & OBJECTS_UNLIMITED_OBJECTS) != 0;
 }
 
+/**
+ * Returns if the object maximum specifies a name hash index.
+ *
+ * @param[in] maximum The object maximum specification.
+ *
+ * @retval true The object names are indexed by a hash table.
+ * @retval false The object names are searched linearly.
+ */
+RTEMS_INLINE_ROUTINE bool _Objects_Has_name_hash( uint32_t maximum )
+{
+  return (maximum & OBJECTS_NAME_HASH_OBJECTS) != 0;
+}
+
 /*
  * We cannot use an inline function for this since it may be evaluated at
  * compile time.
  */
 #define _Objects_Maximum_per_allocation( maximum ) \
-  ((Objects_Maximum) ((maximum) & ~OBJECTS_UNLIMITED_OBJECTS))
+  ((Objects_Maximum) ((maximum) & \
+    ~(OBJECTS_UNLIMITED_OBJECTS | OBJECTS_NAME_HASH_OBJECTS)))
 
 /**@}*/
 /**@}*/
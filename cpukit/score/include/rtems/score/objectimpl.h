@@ -137,8 +137,31 @@ typedef struct {
   Objects_Maximum   allocation_size;
   /** This is the size in bytes of each object instance. */
   size_t            size;
-  /** This points to the table of local objects. */
-  Objects_Control **local_table;
+  /**
+   * @brief This is the two-level table of local objects.
+   *
+   * The first level is a directory of pages.  The page of an object index is
+   * the index shifted right by the local table page shift.  The pages are
+   * allocated on demand, so that an extension never copies the table.
+   */
+  Objects_Control ***local_table;
+  /** This is the binary logarithm of the local table page size. */
+  uint8_t           local_table_page_shift;
+  /** This is the count of blocks the block tables can hold. */
+  Objects_Maximum   block_capacity;
+  /**
+   * @brief This is the name hash index or NULL if there is none.
+   *
+   * The first half of the table contains the buckets and the second half
+   * contains the link to the next object for each object index.  A bucket
+   * and a link contain the index of an object or zero to terminate the
+   * bucket chain.  The objects of a bucket chain are sorted by index.
+   */
+  Objects_Maximum  *name_hash;
+  /** This is the binary logarithm of the count of name hash buckets. */
+  uint8_t           name_hash_order;
+  /** This is true if the object names are indexed by a name hash table. */
+  bool              has_name_hash;
   /** This is the chain of inactive control blocks. */
   Chain_Control     Inactive;
   /** This is the number of objects on the Inactive list. */
@@ -457,7 +480,8 @@ typedef enum {
  *  @brief Converts an object name to an Id.
  *
  *  This method converts an object name to an Id.  It performs a look up
- *  using the object information block for this object class.
+ *  using the object information block for this object class.  Object classes
+ *  with a name hash index obtain the object allocator lock for the look up.
  *
  *  @param[in] information points to an object class information block.
  *  @param[in] name is the name of the object to find.
@@ -704,6 +728,92 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 );
 
+/**
+ * @brief Extends the name hash index so that it covers the specified maximum
+ * object index.
+ *
+ * The count of buckets is the smallest power of two greater than the maximum
+ * object index.  In case the count of buckets changes, then all named local
+ * objects are moved to the new buckets.  This happens only for automatically
+ * extended object classes and the count of buckets at least doubles, so the
+ * amortized cost per object is constant.
+ *
+ * @param[in] information The object information.
+ * @param[in] maximum The new maximum object index.
+ *
+ * @retval true Successful operation or the class has no name hash index.
+ * @retval false Not enough memory to allocate the new index.
+ */
+bool _Objects_Name_hash_extend(
+  Objects_Information *information,
+  uint32_t             maximum
+);
+
+/**
+ * @brief Inserts the object into the name hash index.
+ *
+ * Objects without a name are not inserted.  The caller must own the object
+ * allocator lock.
+ *
+ * @param[in] information The object information with a name hash index.
+ * @param[in] the_object The object to insert.
+ */
+void _Objects_Name_hash_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
+/**
+ * @brief Removes the object from the name hash index.
+ *
+ * This function must be called before the object name changes.  The caller
+ * must own the object allocator lock.
+ *
+ * @param[in] information The object information with a name hash index.
+ * @param[in] the_object The object to remove.
+ */
+void _Objects_Name_hash_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
+/**
+ * @brief Gets the first object according to object index with the specified
+ * 32-bit name from the name hash index.
+ *
+ * The caller must own the object allocator lock.
+ *
+ * @param[in] information The object information.
+ * @param[in] name The object name.
+ *
+ * @retval NULL No object exists for this name.
+ * @retval other The object with this name.
+ */
+Objects_Control *_Objects_Name_hash_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+);
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+/**
+ * @brief Gets the first object according to object index with the specified
+ * string name from the name hash index.
+ *
+ * The caller must own the object allocator lock.
+ *
+ * @param[in] information The object information.
+ * @param[in] name The object name.  Its length must not exceed the maximum
+ *   name length of the object information.
+ *
+ * @retval NULL No object exists for this name.
+ * @retval other The object with this name.
+ */
+Objects_Control *_Objects_Name_hash_find_string(
+  const Objects_Information *information,
+  const char                *name
+);
+#endif
+
 /**
  *  @brief Close object.
  *
@@ -814,6 +924,42 @@ RTEMS_INLINE_ROUTINE bool _Objects_Are_ids_equal(
   return ( left == right );
 }
 
+/**
+ * @brief The local table page shift of object classes without automatic
+ * extension.
+ *
+ * The local table of these object classes consists of one page which covers
+ * all valid object indices.
+ */
+#define OBJECTS_LOCAL_TABLE_SINGLE_PAGE_SHIFT 16
+
+/**
+ * This function returns the pointer to the local_table object
+ * referenced by the index.
+ *
+ * @param[in] information points to an Object Information Table
+ * @param[in] index is the index of the object the caller wants to access
+ *
+ * @retval NULL The object index is not in use.
+ * @retval object The local object pointer.
+ *
+ * @note The index must be less than or equal to the maximum of the object
+ *       information.
+ */
+RTEMS_INLINE_ROUTINE Objects_Control *_Objects_Get_local_object(
+  const Objects_Information *information,
+  uint32_t                   index
+)
+{
+  uint32_t shift;
+  uint32_t offset;
+
+  shift = information->local_table_page_shift;
+  offset = index & ( ( UINT32_C( 1 ) << shift ) - 1 );
+
+  return information->local_table[ index >> shift ][ offset ];
+}
+
 /**
  * This function sets the pointer to the local_table object
  * referenced by the index.
@@ -834,6 +980,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Set_local_object(
   Objects_Control     *the_object
 )
 {
+  uint32_t shift;
+  uint32_t offset;
+
   /*
    *  This routine is ONLY to be called from places in the code
    *  where the Id is known to be good.  Therefore, this should NOT
@@ -844,7 +993,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Set_local_object(
       return;
   #endif
 
-  information->local_table[ index ] = the_object;
+  shift = information->local_table_page_shift;
+  offset = index & ( ( UINT32_C( 1 ) << shift ) - 1 );
+
+  information->local_table[ index >> shift ][ offset ] = the_object;
 }
 
 /**
@@ -900,6 +1052,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_insert( information, the_object );
+  }
 }
 
 /**
@@ -924,6 +1080,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_insert( information, the_object );
+  }
 }
 
 /**
@@ -950,6 +1110,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_insert( information, the_object );
+  }
 }
 
 /**
@@ -403,6 +403,16 @@ typedef struct Per_CPU_Control {
      */
     uint64_t ticks;
 
+    /**
+     * @brief Watchdog ticks value of the next clock interrupt in tickless
+     * mode.
+     *
+     * It is zero in case the clock driver uses periodic clock interrupts.
+     *
+     * @see _Watchdog_Tickless_enable().
+     */
+    uint64_t next_tick;
+
     /**
      * @brief Header for watchdogs.
      *
@@ -449,6 +459,29 @@ typedef struct Per_CPU_Control {
      */
     Atomic_Ulong message;
 
+    /**
+     * @brief The multicast jobs of this processor.
+     *
+     * @see _SMP_Multicast_batch_add().
+     */
+    struct {
+      /**
+       * @brief Lock to protect the job list.
+       */
+      ISR_LOCK_MEMBER( Lock )
+
+      /**
+       * @brief The first job to perform or NULL.
+       */
+      struct SMP_Multicast_job *head;
+
+      /**
+       * @brief The last job to perform.  It is valid only if the head is not
+       * NULL.
+       */
+      struct SMP_Multicast_job *tail;
+    } Multicast;
+
     struct {
       /**
        * @brief The scheduler control of the scheduler owning this processor.
@@ -0,0 +1,238 @@
+/**
+ * @file
+ *
+ * @brief Clustered EDF SMP Scheduler API
+ *
+ * @ingroup ScoreSchedulerSMPEDFCluster
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULEREDFCLUSTERSMP_H
+#define _RTEMS_SCORE_SCHEDULEREDFCLUSTERSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/scheduleredf.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ScoreSchedulerSMPEDFCluster Clustered EDF SMP Scheduler
+ *
+ * @ingroup ScoreSchedulerSMP
+ *
+ * @brief Clustered EDF SMP Scheduler
+ *
+ * The processors of a scheduler instance are partitioned into clusters.  A
+ * processor added to the scheduler instance is assigned to the first cluster
+ * with less processors than the cluster size.  Since the processors are
+ * added in ascending order during system initialization, a cluster consists
+ * of consecutive processors of the scheduler instance.  This is independent
+ * of the processor index of the first processor of the scheduler instance.
+ * Each cluster has its own EDF ready queues.
+ *
+ * Threads with a processor affinity which covers all processors of the
+ * scheduler instance are migratable.  Threads with a processor affinity
+ * which is equal to the processors of the scheduler instance in one cluster
+ * are pinned to this cluster and may execute on all processors of it.  Other
+ * processor affinities, e.g. a single processor of a cluster, are rejected.
+ * Threads pinned to a cluster without processors do not execute until a
+ * processor is added to this cluster.
+ *
+ * A pinned thread may only preempt a thread executing in its cluster.  A
+ * processor which is about to select a new heir takes the highest priority
+ * thread of its own cluster or pulls the highest priority migratable thread
+ * from one of the other clusters.  This lets migratable threads use the idle
+ * capacity of all clusters.  Migratable threads are queued in the cluster of
+ * the processor they executed on last and prefer this cluster in case of
+ * equal priorities.
+ *
+ * @{
+ */
+
+typedef struct {
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief Generation number to ensure FIFO/LIFO order for threads of the same
+   * priority across different ready queues.
+   */
+  int64_t generation;
+
+  /**
+   * @brief The cluster index of the ready queue of this node.
+   *
+   * For pinned nodes, this is the cluster of the processor affinity.  For
+   * migratable nodes, this is the cluster of the processor used last.
+   */
+  uint32_t cluster_index;
+
+  /**
+   * @brief Indicates if this node is pinned to its cluster.
+   */
+  bool pinned;
+} Scheduler_EDF_cluster_SMP_Node;
+
+typedef struct {
+  /**
+   * @brief The ready nodes pinned to this cluster.
+   */
+  RBTree_Control Pinned;
+
+  /**
+   * @brief The ready migratable nodes which executed last in this cluster.
+   */
+  RBTree_Control Migratable;
+
+  /**
+   * @brief Count of processors of this cluster owned by the scheduler
+   * instance.
+   */
+  uint32_t processor_count;
+} Scheduler_EDF_cluster_SMP_Cluster;
+
+typedef struct {
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief Current generation for FIFO/LIFO ordering.
+   */
+  int64_t generations[ 2 ];
+
+  /**
+   * @brief Count of processors per cluster.
+   */
+  uint32_t cluster_size;
+
+  /**
+   * @brief Count of clusters.
+   */
+  uint32_t cluster_count;
+
+  /**
+   * @brief The cluster index of each processor owned by the scheduler
+   * instance.
+   */
+  uint32_t cluster_of_processor[ CPU_MAXIMUM_PROCESSORS ];
+
+  /**
+   * @brief A table with one entry per cluster.
+   */
+  Scheduler_EDF_cluster_SMP_Cluster Clusters[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_EDF_cluster_SMP_Context;
+
+#define SCHEDULER_EDF_CLUSTER_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_EDF_cluster_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_EDF_cluster_SMP_Yield, \
+    _Scheduler_EDF_cluster_SMP_Block, \
+    _Scheduler_EDF_cluster_SMP_Unblock, \
+    _Scheduler_EDF_cluster_SMP_Update_priority, \
+    _Scheduler_EDF_Map_priority, \
+    _Scheduler_EDF_Unmap_priority, \
+    _Scheduler_EDF_cluster_SMP_Ask_for_help, \
+    _Scheduler_EDF_cluster_SMP_Reconsider_help_request, \
+    _Scheduler_EDF_cluster_SMP_Withdraw_node, \
+    _Scheduler_EDF_cluster_SMP_Add_processor, \
+    _Scheduler_EDF_cluster_SMP_Remove_processor, \
+    _Scheduler_EDF_cluster_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_EDF_Release_job, \
+    _Scheduler_EDF_Cancel_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_EDF_cluster_SMP_Start_idle, \
+    _Scheduler_EDF_cluster_SMP_Set_affinity \
+  }
+
+void _Scheduler_EDF_cluster_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+void _Scheduler_EDF_cluster_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+void _Scheduler_EDF_cluster_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_EDF_cluster_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_EDF_cluster_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+bool _Scheduler_EDF_cluster_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_EDF_cluster_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_EDF_cluster_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+void _Scheduler_EDF_cluster_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+Thread_Control *_Scheduler_EDF_cluster_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+void _Scheduler_EDF_cluster_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_EDF_cluster_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  struct Per_CPU_Control  *cpu
+);
+
+bool _Scheduler_EDF_cluster_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_SCHEDULEREDFCLUSTERSMP_H */
@@ -0,0 +1,242 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerPriorityLocalSMP
+ *
+ * @brief Deterministic Priority SMP Scheduler with Per-Processor Ready
+ * Queues API
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERPRIORITYLOCALSMP_H
+#define _RTEMS_SCORE_SCHEDULERPRIORITYLOCALSMP_H
+
+#include <rtems/score/processormask.h>
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup ScoreSchedulerPriorityLocalSMP Deterministic Priority SMP Scheduler with Per-Processor Ready Queues
+ *
+ * @ingroup ScoreSchedulerSMP
+ *
+ * This is a variant of the global fixed priority scheduler (G-FP), see
+ * @ref ScoreSchedulerPrioritySMP.  Each processor of the scheduler instance
+ * has its own priority bit map and ready chains.  A ready thread is queued on
+ * the processor it executed on last, so that insert and extract operations
+ * only touch the ready queue data of one processor.
+ *
+ * A processor which selects a new heir uses the highest priority thread of
+ * its own ready queue unless the ready queue of another processor contains a
+ * thread of a strictly higher priority.  In this case the thread migrates.
+ * A thread to schedule preempts the lowest priority scheduled thread and
+ * prefers the processor it executed on last in case several scheduled
+ * threads have the lowest priority.
+ *
+ * A summary priority bit map and a set of ready queues for each priority
+ * cover all ready queues, so the selection of the highest priority ready
+ * thread does not depend on the processor count.  The summary is only
+ * updated if a ready chain becomes empty or non-empty.
+ *
+ * The FIFO order of threads with equal priority is only maintained per ready
+ * queue.  In contrast to @ref ScoreSchedulerPrioritySMP, there is no global
+ * FIFO order of equal priority threads.  A processor prefers the threads of
+ * its own ready queue, so a ready thread may wait on the ready queue of
+ * another processor as long as threads of equal priority are ready on the
+ * processors which become available.  Applications which rely on round-robin
+ * fairness of equal priority threads across processors should use the
+ * Deterministic Priority SMP Scheduler.
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief The ready queue of one processor.
+ */
+typedef struct {
+  /**
+   * @brief The priority bit map of this ready queue.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The ready chains of this ready queue, one chain per priority.
+   */
+  Chain_Control *Ready;
+} Scheduler_priority_local_SMP_Ready_queue;
+
+/**
+ * @brief Scheduler context specialization for Deterministic Priority SMP
+ * schedulers with per-processor ready queues.
+ */
+typedef struct {
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief The summary priority bit map of all ready queues.
+   *
+   * A priority is set in this bit map if at least one ready queue has a ready
+   * node of this priority.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The set of ready queues with a ready node for each priority.
+   */
+  Processor_mask *Ready_queues_of_priority;
+
+  /**
+   * @brief The storage of the ready chains of all processors.
+   */
+  Chain_Control *Ready;
+
+  /**
+   * @brief The count of ready queues.
+   */
+  uint32_t ready_queue_count;
+
+  /**
+   * @brief The ready queues, one for each processor.
+   */
+  Scheduler_priority_local_SMP_Ready_queue
+    Ready_queues[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_priority_local_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for Deterministic Priority SMP
+ * schedulers with per-processor ready queues.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready queue of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief The priority bit map information of this node with respect to the
+   * summary priority bit map.
+   */
+  Priority_bit_map_Information Summary_map;
+
+  /**
+   * @brief The index of the processor ready queue of this node.
+   */
+  uint32_t ready_queue_index;
+} Scheduler_priority_local_SMP_Node;
+
+/**
+ * @brief Entry points for the Priority SMP Scheduler with per-processor
+ * ready queues.
+ */
+#define SCHEDULER_PRIORITY_LOCAL_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_priority_local_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_priority_local_SMP_Yield, \
+    _Scheduler_priority_local_SMP_Block, \
+    _Scheduler_priority_local_SMP_Unblock, \
+    _Scheduler_priority_local_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_priority_local_SMP_Ask_for_help, \
+    _Scheduler_priority_local_SMP_Reconsider_help_request, \
+    _Scheduler_priority_local_SMP_Withdraw_node, \
+    _Scheduler_priority_local_SMP_Add_processor, \
+    _Scheduler_priority_local_SMP_Remove_processor, \
+    _Scheduler_priority_local_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_SMP_Start_idle \
+    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
+  }
+
+void _Scheduler_priority_local_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+void _Scheduler_priority_local_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+void _Scheduler_priority_local_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_priority_local_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_priority_local_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+bool _Scheduler_priority_local_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_priority_local_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+void _Scheduler_priority_local_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+void _Scheduler_priority_local_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+Thread_Control *_Scheduler_priority_local_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+void _Scheduler_priority_local_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERPRIORITYLOCALSMP_H */
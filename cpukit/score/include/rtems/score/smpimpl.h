@@ -250,7 +250,8 @@ typedef void ( *SMP_Action_handler )( void *arg );
 /**
  *  @brief Initiates an SMP multicast action to a set of processors.
  *
- *  The current processor may be part of the set.
+ *  The current processor may be part of the set.  This function may be called
+ *  with interrupts disabled and from within a multicast action handler.
  *
  *  @param[in] setsize The size of the set of target processors of the message.
  *  @param[in] cpus The set of target processors of the message.
@@ -264,6 +265,123 @@ void _SMP_Multicast_action(
   void *arg
 );
 
+struct SMP_Multicast_batch;
+
+/**
+ * @brief A multicast job to perform by one processor.
+ *
+ * The job storage is provided by the caller.  It must stay valid until the
+ * batch of the job is done.
+ */
+typedef struct SMP_Multicast_job {
+  /**
+   * @brief The next job in the job list of the target processor.
+   */
+  struct SMP_Multicast_job *next;
+
+  /**
+   * @brief The job handler.
+   */
+  SMP_Action_handler handler;
+
+  /**
+   * @brief The job handler argument.
+   */
+  void *arg;
+
+  /**
+   * @brief The batch of this job.
+   */
+  struct SMP_Multicast_batch *batch;
+} SMP_Multicast_job;
+
+/**
+ * @brief A batch of multicast jobs.
+ *
+ * Jobs are added to the job lists of their target processors immediately.
+ * The inter-processor interrupts are sent by _SMP_Multicast_batch_issue().
+ * One inter-processor interrupt performs all jobs of a target processor.
+ */
+typedef struct SMP_Multicast_batch {
+  /**
+   * @brief The processors which need an inter-processor interrupt to perform
+   * the jobs of this batch.
+   */
+  Processor_mask targets;
+
+  /**
+   * @brief The count of jobs of this batch not yet performed.
+   */
+  Atomic_Ulong pending;
+} SMP_Multicast_batch;
+
+/**
+ * @brief Initializes a batch of multicast jobs.
+ *
+ * @param[out] batch The batch.
+ */
+void _SMP_Multicast_batch_initialize( SMP_Multicast_batch *batch );
+
+/**
+ * @brief Adds a job to a batch of multicast jobs.
+ *
+ * The jobs of a target processor are performed in the order they were added.
+ * The job may be performed before the batch is issued, for example by an
+ * inter-processor interrupt sent on behalf of another batch.
+ *
+ * In case the system is not up, then the job is performed immediately by the
+ * current processor.
+ *
+ * @param[in] batch The batch.
+ * @param[in] job The job storage.
+ * @param[in] cpu_index The index of the processor to perform the job.
+ * @param[in] handler The job handler.
+ * @param[in] arg The job handler argument.
+ */
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch *batch,
+  SMP_Multicast_job   *job,
+  uint32_t             cpu_index,
+  SMP_Action_handler   handler,
+  void                *arg
+);
+
+/**
+ * @brief Issues a batch of multicast jobs.
+ *
+ * Exactly one inter-processor interrupt is sent to each target processor of
+ * the batch regardless of the count of jobs for this processor.  A target
+ * processor performs all its pending jobs in the course of one
+ * inter-processor interrupt.
+ *
+ * @param[in] batch The batch.
+ */
+void _SMP_Multicast_batch_issue( SMP_Multicast_batch *batch );
+
+/**
+ * @brief Checks if all jobs of a batch of multicast jobs are done.
+ *
+ * @param[in] batch The batch.
+ *
+ * @retval true All jobs of the batch are done.
+ * @retval false Otherwise.
+ */
+static inline bool _SMP_Multicast_batch_is_done(
+  const SMP_Multicast_batch *batch
+)
+{
+  return _Atomic_Load_ulong( &batch->pending, ATOMIC_ORDER_ACQUIRE ) == 0;
+}
+
+/**
+ * @brief Waits until all jobs of a batch of multicast jobs are done.
+ *
+ * The jobs of the current processor are performed while waiting.
+ *
+ * @param[in] batch The batch.
+ */
+void _SMP_Multicast_batch_wait( SMP_Multicast_batch *batch );
+
 /**
  * @brief Executes a handler with argument on the specified processor on behalf
  * of the boot processor.
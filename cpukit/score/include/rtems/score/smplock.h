@@ -25,6 +25,7 @@
 #if defined(RTEMS_SMP)
 
 #include <rtems/score/smplockstats.h>
+#include <rtems/score/smplockmcs.h>
 #include <rtems/score/smplockticket.h>
 #include <rtems/score/isrlevel.h>
 
@@ -45,12 +46,16 @@ extern "C" {
  * @brief The SMP lock provides mutual exclusion for SMP systems at the lowest
  * level.
  *
- * The SMP lock is implemented as a ticket lock.  This provides fairness in
- * case of concurrent lock attempts.
+ * The SMP lock is implemented as a ticket lock by default.  This provides
+ * fairness in case of concurrent lock attempts.  In case RTEMS_SMP_MCS_LOCKS
+ * is defined (configure option --enable-smp-mcs-locks), then the SMP lock is
+ * implemented as a Mellor-Crummey and Scott (MCS) lock.  This provides
+ * fairness as well, however, each waiting processor spins on its own lock
+ * context.  Under high contention this avoids the cache line transfers of the
+ * ticket lock to all waiting processors for each release.
  *
- * This SMP lock API uses a local context for acquire and release pairs.  Such
- * a context may be used to implement for example the Mellor-Crummey and Scott
- * (MCS) locks in the future.
+ * This SMP lock API uses a local context for acquire and release pairs.  The
+ * context must not be moved or re-used while the lock is owned.
  *
  * @{
  */
@@ -63,7 +68,11 @@ extern "C" {
  * @brief SMP lock control.
  */
 typedef struct {
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  SMP_MCS_lock_Control MCS_lock;
+#else
   SMP_ticket_lock_Control Ticket_lock;
+#endif
 #if defined(RTEMS_DEBUG)
   /**
    * @brief The index of the owning processor of this lock.
@@ -92,7 +101,9 @@ typedef struct {
 #if defined(RTEMS_DEBUG)
   SMP_lock_Control *lock_used_for_acquire;
 #endif
-#if defined(RTEMS_PROFILING)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  SMP_MCS_lock_Context MCS_context;
+#elif defined(RTEMS_PROFILING)
   SMP_lock_Stats_context Stats_context;
 #endif
 } SMP_lock_Context;
@@ -101,24 +112,30 @@ typedef struct {
 #define SMP_LOCK_NO_OWNER 0
 #endif
 
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  #define SMP_LOCK_IMPLEMENTATION_INITIALIZER SMP_MCS_LOCK_INITIALIZER
+#else
+  #define SMP_LOCK_IMPLEMENTATION_INITIALIZER SMP_TICKET_LOCK_INITIALIZER
+#endif
+
 /**
  * @brief SMP lock control initializer for static initialization.
  */
 #if defined(RTEMS_DEBUG) && defined(RTEMS_PROFILING)
   #define SMP_LOCK_INITIALIZER( name ) \
     { \
-      SMP_TICKET_LOCK_INITIALIZER, \
+      SMP_LOCK_IMPLEMENTATION_INITIALIZER, \
       SMP_LOCK_NO_OWNER, \
       SMP_LOCK_STATS_INITIALIZER( name ) \
     }
 #elif defined(RTEMS_DEBUG)
   #define SMP_LOCK_INITIALIZER( name ) \
-    { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_NO_OWNER }
+    { SMP_LOCK_IMPLEMENTATION_INITIALIZER, SMP_LOCK_NO_OWNER }
 #elif defined(RTEMS_PROFILING)
   #define SMP_LOCK_INITIALIZER( name ) \
-    { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
+    { SMP_LOCK_IMPLEMENTATION_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
 #else
-  #define SMP_LOCK_INITIALIZER( name ) { SMP_TICKET_LOCK_INITIALIZER }
+  #define SMP_LOCK_INITIALIZER( name ) { SMP_LOCK_IMPLEMENTATION_INITIALIZER }
 #endif
 
 static inline void _SMP_lock_Initialize_inline(
@@ -126,7 +143,11 @@ static inline void _SMP_lock_Initialize_inline(
   const char       *name
 )
 {
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Initialize( &lock->MCS_lock );
+#else
   _SMP_ticket_lock_Initialize( &lock->Ticket_lock );
+#endif
 #if defined(RTEMS_DEBUG)
   lock->owner = SMP_LOCK_NO_OWNER;
 #endif
@@ -158,7 +179,11 @@ void _SMP_lock_Initialize(
 
 static inline void _SMP_lock_Destroy_inline( SMP_lock_Control *lock )
 {
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Destroy( &lock->MCS_lock );
+#else
   _SMP_ticket_lock_Destroy( &lock->Ticket_lock );
+#endif
   _SMP_lock_Stats_destroy( &lock->Stats );
 }
 
@@ -197,11 +222,19 @@ static inline void _SMP_lock_Acquire_inline(
 #else
   (void) context;
 #endif
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Acquire(
+    &lock->MCS_lock,
+    &context->MCS_context,
+    &lock->Stats
+  );
+#else
   _SMP_ticket_lock_Acquire(
     &lock->Ticket_lock,
     &lock->Stats,
     &context->Stats_context
   );
+#endif
 #if defined(RTEMS_DEBUG)
   lock->owner = _SMP_lock_Who_am_I();
 #endif
@@ -236,10 +269,14 @@ static inline void _SMP_lock_Release_inline(
 #else
   (void) context;
 #endif
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Release( &lock->MCS_lock, &context->MCS_context );
+#else
   _SMP_ticket_lock_Release(
     &lock->Ticket_lock,
     &context->Stats_context
   );
+#endif
 }
 
 /**
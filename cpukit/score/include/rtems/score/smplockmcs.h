@@ -127,6 +127,19 @@ static inline void _SMP_MCS_lock_Destroy( SMP_MCS_lock_Control *lock )
   (void) lock;
 }
 
+/**
+ * @brief Returns true, if the SMP MCS lock is locked, otherwise false.
+ *
+ * The result is only a snapshot of the lock state.  In case the lock is not
+ * locked, then the memory changes of the previous lock owner are visible.
+ *
+ * @param lock The SMP MCS lock control.
+ */
+static inline bool _SMP_MCS_lock_Is_locked( const SMP_MCS_lock_Control *lock )
+{
+  return _Atomic_Load_uintptr( &lock->queue.atomic, ATOMIC_ORDER_ACQUIRE ) != 0;
+}
+
 static inline void _SMP_MCS_lock_Do_acquire(
   SMP_MCS_lock_Control   *lock,
   SMP_MCS_lock_Context   *context
@@ -258,6 +258,15 @@ void _SMP_lock_Stats_iteration_stop(
   SMP_lock_Stats_iteration_context *iteration_context
 );
 
+/**
+ * @brief Resets the statistics of all registered SMP lock statistics blocks.
+ *
+ * The names and the registration of the statistics blocks are preserved.  The
+ * statistics are updated without the corresponding SMP lock, so updates
+ * carried out concurrently by lock owners may survive the reset.
+ */
+void _SMP_lock_Stats_reset( void );
+
 #else /* RTEMS_PROFILING */
 
 #define _SMP_lock_Stats_initialize( stats, name ) do { } while ( 0 )
@@ -78,6 +78,27 @@ static inline void _SMP_ticket_lock_Destroy( SMP_ticket_lock_Control *lock )
   (void) lock;
 }
 
+/**
+ * @brief Returns true, if the SMP ticket lock is locked, otherwise false.
+ *
+ * The result is only a snapshot of the lock state.  In case the lock is not
+ * locked, then the memory changes of the previous lock owner are visible.
+ *
+ * @param[in] lock The SMP ticket lock control.
+ */
+static inline bool _SMP_ticket_lock_Is_locked(
+  const SMP_ticket_lock_Control *lock
+)
+{
+  unsigned int next_ticket;
+  unsigned int now_serving;
+
+  next_ticket = _Atomic_Load_uint( &lock->next_ticket, ATOMIC_ORDER_RELAXED );
+  now_serving = _Atomic_Load_uint( &lock->now_serving, ATOMIC_ORDER_ACQUIRE );
+
+  return next_ticket != now_serving;
+}
+
 static inline void _SMP_ticket_lock_Do_acquire(
   SMP_ticket_lock_Control *lock
 #if defined(RTEMS_PROFILING)
@@ -610,6 +610,14 @@ struct Thread_Action {
   Thread_Action_handler handler;
 };
 
+/**
+ * @brief Count of POSIX keys with a direct mapped key value pair slot.
+ *
+ * The key value pairs of the keys with an object index less than or equal to
+ * this count are available via Thread_Keys_information::Slots.
+ */
+#define THREAD_KEYS_SLOT_COUNT 8
+
 /**
  * @brief Per-thread information for POSIX Keys.
  */
@@ -619,6 +627,16 @@ typedef struct {
    */
   RBTree_Control Key_value_pairs;
 
+  /**
+   * @brief Direct mapped lookup tree nodes of the key value pairs for the
+   * first keys.
+   *
+   * The slot index is the key object index minus one.  A slot is NULL if no
+   * key value pair with this index exists for this thread.  This avoids the
+   * tree search for the commonly used first keys.
+   */
+  RBTree_Node *Slots[ THREAD_KEYS_SLOT_COUNT ];
+
   /**
    * @brief Lock to protect the tree operations.
    */
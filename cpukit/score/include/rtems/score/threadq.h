@@ -414,7 +414,18 @@ struct Thread_queue_Queue {
    * @see _Thread_queue_Acquire(), _Thread_queue_Acquire_critical() and
    * _Thread_queue_Release().
    */
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  union {
+    SMP_MCS_lock_Control MCS_lock;
+
+    /*
+     * The storage space of struct _Thread_queue_Queue is defined by the
+     * ticket lock of Newlib <sys/lock.h>.  The zero initialized MCS lock is
+     * free, so statically initialized Newlib objects work.
+     */
+    unsigned int reserved[ 2 ];
+  } Lock;
+#elif defined(RTEMS_SMP)
   SMP_ticket_lock_Control Lock;
 #endif
 
@@ -429,7 +429,9 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Queue_initialize(
   const char         *name
 )
 {
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Initialize( &queue->Lock.MCS_lock );
+#elif defined(RTEMS_SMP)
   _SMP_ticket_lock_Initialize( &queue->Lock );
 #endif
   queue->heads = NULL;
@@ -445,7 +447,13 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Queue_do_acquire_critical(
   ISR_lock_Context   *lock_context
 )
 {
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Acquire(
+    &queue->Lock.MCS_lock,
+    &lock_context->Lock_context.MCS_context,
+    lock_stats
+  );
+#elif defined(RTEMS_SMP)
   _SMP_ticket_lock_Acquire(
     &queue->Lock,
     lock_stats,
@@ -472,7 +480,12 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Queue_release_critical(
   ISR_lock_Context   *lock_context
 )
 {
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Release(
+    &queue->Lock.MCS_lock,
+    &lock_context->Lock_context.MCS_context
+  );
+#elif defined(RTEMS_SMP)
   _SMP_ticket_lock_Release(
     &queue->Lock,
     &lock_context->Lock_context.Stats_context
@@ -492,6 +505,146 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Queue_release(
   _ISR_lock_ISR_enable( lock_context );
 }
 
+#if defined(RTEMS_SMP)
+RTEMS_STATIC_ASSERT(
+  sizeof( ( (Thread_queue_Queue *) 0 )->owner ) == sizeof( Atomic_Uintptr ),
+  THREAD_QUEUE_QUEUE_OWNER_ATOMIC
+);
+
+RTEMS_INLINE_ROUTINE Atomic_Uintptr *_Thread_queue_Queue_owner_atomic(
+  Thread_queue_Queue *queue
+)
+{
+  return (Atomic_Uintptr *) &queue->owner;
+}
+
+/**
+ * @brief Returns true, if the thread queue lock is currently locked,
+ * otherwise false.
+ *
+ * In case the lock is not locked, then the memory changes of the previous
+ * lock owner are visible to the caller.
+ *
+ * @param[in] queue The actual thread queue.
+ */
+RTEMS_INLINE_ROUTINE bool _Thread_queue_Queue_is_locked(
+  const Thread_queue_Queue *queue
+)
+{
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  return _SMP_MCS_lock_Is_locked( &queue->Lock.MCS_lock );
+#else
+  return _SMP_ticket_lock_Is_locked( &queue->Lock );
+#endif
+}
+
+/**
+ * @brief Tries to make the thread the owner of the thread queue without the
+ * thread queue lock.
+ *
+ * This is the uncontended fast path of mutex obtain operations.  It must not
+ * be used for thread queues which need actions on owner changes, e.g. priority
+ * ceiling mutexes.
+ *
+ * @param[in] queue The actual thread queue.
+ * @param[in] new_owner The new owner.
+ *
+ * @retval true The thread queue had no owner and the thread is now the owner.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Thread_queue_Queue_try_set_owner(
+  Thread_queue_Queue *queue,
+  Thread_Control     *new_owner
+)
+{
+  uintptr_t owner;
+
+  owner = 0;
+  return _Atomic_Compare_exchange_uintptr(
+    _Thread_queue_Queue_owner_atomic( queue ),
+    &owner,
+    (uintptr_t) new_owner,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+#endif
+
+/**
+ * @brief Makes the thread the owner of the thread queue if it has no owner.
+ *
+ * The caller must be the owner of the thread queue lock.  Threads obtaining
+ * the thread queue via _Thread_queue_Queue_try_set_owner() may change the
+ * owner concurrently, so the owner is claimed with an atomic operation on SMP
+ * configurations.
+ *
+ * @param[in] queue The actual thread queue.
+ * @param[in] new_owner The new owner.
+ *
+ * @return The owner of the thread queue before this call.  In case it is
+ *   NULL, then the new owner is now the owner of the thread queue.
+ */
+RTEMS_INLINE_ROUTINE Thread_Control *_Thread_queue_Queue_claim_owner_critical(
+  Thread_queue_Queue *queue,
+  Thread_Control     *new_owner
+)
+{
+#if defined(RTEMS_SMP)
+  uintptr_t owner;
+
+  /*
+   * Pairs with the fence in _Thread_queue_Queue_release_owner_fast().  Either
+   * we observe the release of the owner, or the owner observes our thread
+   * queue lock acquire and hands the thread queue over to us.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  owner = 0;
+  _Atomic_Compare_exchange_uintptr(
+    _Thread_queue_Queue_owner_atomic( queue ),
+    &owner,
+    (uintptr_t) new_owner,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  return (Thread_Control *) owner;
+#else
+  Thread_Control *owner;
+
+  owner = queue->owner;
+
+  if ( owner == NULL ) {
+    queue->owner = new_owner;
+  }
+
+  return owner;
+#endif
+}
+
+/**
+ * @brief Clears the owner of the thread queue.
+ *
+ * The caller must be the owner of the thread queue lock and the owner of the
+ * thread queue.
+ *
+ * @param[in] queue The actual thread queue.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Queue_clear_owner_critical(
+  Thread_queue_Queue *queue
+)
+{
+#if defined(RTEMS_SMP)
+  _Atomic_Store_uintptr(
+    _Thread_queue_Queue_owner_atomic( queue ),
+    0,
+    ATOMIC_ORDER_RELEASE
+  );
+#else
+  queue->owner = NULL;
+#endif
+}
+
 /**
  * @brief Copies the thread queue name to the specified buffer.
  *
@@ -897,7 +1050,10 @@ void _Thread_queue_Extract_with_proxy(
  * @brief Surrenders the thread queue previously owned by the thread to the
  * first enqueued thread.
  *
- * The owner of the thread queue must be set to NULL by the caller.
+ * This function sets the owner of the thread queue to the new owner.  The
+ * caller must not clear the owner before, in case the owner of the thread
+ * queue may be claimed without the thread queue lock, see
+ * _Thread_queue_Queue_try_set_owner().
  *
  * This function releases the thread queue lock.  In addition it performs a
  * thread dispatch if necessary.
@@ -945,6 +1101,89 @@ void _Thread_queue_Surrender_sticky(
   Thread_queue_Context          *queue_context,
   const Thread_queue_Operations *operations
 );
+
+/**
+ * @brief Surrenders a thread queue without owner to the first enqueued
+ * thread.
+ *
+ * This function acquires the thread queue lock.  In case the thread queue has
+ * still no owner and a thread is enqueued, then the first enqueued thread
+ * becomes the new owner and is extracted from the thread queue.  The thread
+ * queue lock is released and interrupts are enabled according to the thread
+ * queue context.
+ *
+ * @param[in] queue The actual thread queue.
+ * @param[in] operations The thread queue operations.
+ * @param[in] queue_context The thread queue context with interrupts disabled.
+ */
+void _Thread_queue_Surrender_no_owner(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Context          *queue_context
+);
+
+/**
+ * @brief Tries to release the thread queue owned by the thread without the
+ * thread queue lock.
+ *
+ * This is the uncontended fast path of mutex release operations.  It may only
+ * be used for thread queues with operations which do not use the thread queue
+ * owner, so no priority inheritance, and which are obtained via
+ * _Thread_queue_Queue_try_set_owner() and
+ * _Thread_queue_Queue_claim_owner_critical().
+ *
+ * A thread which acquired the thread queue lock concurrently may have observed
+ * the previous owner and may enqueue itself.  In this case, the thread queue
+ * is surrendered to the first enqueued thread via
+ * _Thread_queue_Surrender_no_owner().
+ *
+ * @param[in] queue The actual thread queue.
+ * @param[in] owner The owner of the thread queue.
+ * @param[in] operations The thread queue operations.
+ * @param[in] queue_context The thread queue context with interrupts disabled.
+ *
+ * @retval true The thread queue was released and interrupts are enabled.
+ * @retval false Threads are enqueued, so the caller must surrender the thread
+ *   queue with the thread queue lock.  Interrupts are still disabled.
+ */
+RTEMS_INLINE_ROUTINE bool _Thread_queue_Queue_release_owner_fast(
+  Thread_queue_Queue            *queue,
+  Thread_Control                *owner,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Context          *queue_context
+)
+{
+  uintptr_t expected;
+
+  if ( queue->heads != NULL ) {
+    return false;
+  }
+
+  expected = (uintptr_t) owner;
+
+  if (
+    !_Atomic_Compare_exchange_uintptr(
+      _Thread_queue_Queue_owner_atomic( queue ),
+      &expected,
+      0,
+      ATOMIC_ORDER_SEQ_CST,
+      ATOMIC_ORDER_RELAXED
+    )
+  ) {
+    return false;
+  }
+
+  /* Pairs with the fence in _Thread_queue_Queue_claim_owner_critical() */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _Thread_queue_Queue_is_locked( queue ) || queue->heads != NULL ) {
+    _Thread_queue_Surrender_no_owner( queue, operations, queue_context );
+  } else {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+  }
+
+  return true;
+}
 #endif
 
 RTEMS_INLINE_ROUTINE bool _Thread_queue_Is_empty(
@@ -1107,13 +1346,19 @@ void _Thread_queue_Initialize(
   const char           *name
 );
 
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  #define THREAD_QUEUE_LOCK_INITIALIZER { SMP_MCS_LOCK_INITIALIZER }
+#elif defined(RTEMS_SMP)
+  #define THREAD_QUEUE_LOCK_INITIALIZER SMP_TICKET_LOCK_INITIALIZER
+#endif
+
 #if defined(RTEMS_SMP) && defined(RTEMS_DEBUG) && defined(RTEMS_PROFILING)
   #define THREAD_QUEUE_INITIALIZER( _name ) \
     { \
       .Lock_stats = SMP_LOCK_STATS_INITIALIZER( _name ), \
       .owner = SMP_LOCK_NO_OWNER, \
       .Queue = { \
-        .Lock = SMP_TICKET_LOCK_INITIALIZER, \
+        .Lock = THREAD_QUEUE_LOCK_INITIALIZER, \
         .heads = NULL, \
         .owner = NULL, \
         .name = _name \
@@ -1124,7 +1369,7 @@ void _Thread_queue_Initialize(
     { \
       .owner = SMP_LOCK_NO_OWNER, \
       .Queue = { \
-        .Lock = SMP_TICKET_LOCK_INITIALIZER, \
+        .Lock = THREAD_QUEUE_LOCK_INITIALIZER, \
         .heads = NULL, \
         .owner = NULL, \
         .name = _name \
@@ -1135,7 +1380,7 @@ void _Thread_queue_Initialize(
     { \
       .Lock_stats = SMP_LOCK_STATS_INITIALIZER( _name ), \
       .Queue = { \
-        .Lock = SMP_TICKET_LOCK_INITIALIZER, \
+        .Lock = THREAD_QUEUE_LOCK_INITIALIZER, \
         .heads = NULL, \
         .owner = NULL, \
         .name = _name \
@@ -1145,7 +1390,7 @@ void _Thread_queue_Initialize(
   #define THREAD_QUEUE_INITIALIZER( _name ) \
     { \
       .Queue = { \
-        .Lock = SMP_TICKET_LOCK_INITIALIZER, \
+        .Lock = THREAD_QUEUE_LOCK_INITIALIZER, \
         .heads = NULL, \
         .owner = NULL, \
         .name = _name \
@@ -1167,7 +1412,11 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Destroy(
 )
 {
 #if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  _SMP_MCS_lock_Destroy( &the_thread_queue->Queue.Lock.MCS_lock );
+#else
   _SMP_ticket_lock_Destroy( &the_thread_queue->Queue.Lock );
+#endif
   _SMP_lock_Stats_destroy( &the_thread_queue->Lock_stats );
 #endif
 }
@@ -184,6 +184,14 @@ void _Timecounter_Install( struct timecounter *tc );
  */
 void _Timecounter_Tick( void );
 
+/**
+ * @brief Performs a timecounter tick in tickless mode.
+ *
+ * The clock driver must have enabled the tickless mode via
+ * _Watchdog_Tickless_enable() before it calls this function.
+ */
+void _Timecounter_Tick_tickless( void );
+
 /**
  * @brief Lock to protect the timecounter mechanic.
  */
@@ -74,10 +74,59 @@ typedef struct {
 extern User_extensions_List _User_extensions_List;
 
 /**
- * @brief List of active task switch extensions.
+ * @brief List of active task switch extensions of the dynamically added user
+ * extensions.
  */
 extern Chain_Control _User_extensions_Switches_list;
 
+/**
+ * @brief The thread switch, create and delete callouts of the initial user
+ * extensions.
+ *
+ * The callouts are resolved from the initial extension table of the
+ * application configuration during system initialization.  The tables contain
+ * only the callouts which are not NULL in the order of the initial extension
+ * table.  This avoids the extension table iteration and the lock acquisition
+ * for these frequent events in case there are no dynamically added user
+ * extensions.
+ */
+typedef struct {
+  /**
+   * @brief The thread switch callouts.
+   */
+  User_extensions_thread_switch_extension *thread_switch;
+
+  /**
+   * @brief The thread create callouts.
+   */
+  User_extensions_thread_create_extension *thread_create;
+
+  /**
+   * @brief The thread delete callouts.
+   */
+  User_extensions_thread_delete_extension *thread_delete;
+
+  /**
+   * @brief Count of thread switch callouts.
+   */
+  uint32_t thread_switch_count;
+
+  /**
+   * @brief Count of thread create callouts.
+   */
+  uint32_t thread_create_count;
+
+  /**
+   * @brief Count of thread delete callouts.
+   */
+  uint32_t thread_delete_count;
+} User_extensions_Initial_callouts;
+
+/**
+ * @brief The callouts of the initial user extensions.
+ */
+extern User_extensions_Initial_callouts _User_extensions_Initial_callouts;
+
 /**
  * @name Extension Maintainance
  */
@@ -194,6 +243,32 @@ void _User_extensions_Iterate(
   Chain_Iterator_direction  direction
 );
 
+/**
+ * @brief Iterates through the dynamically added user extensions and calls the
+ * visitor for each.
+ *
+ * @param[in, out] arg The argument passed to the visitor.
+ * @param[in] visitor The visitor for each extension.
+ * @param[in] direction The iteration direction.
+ */
+void _User_extensions_Iterate_dynamic(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  Chain_Iterator_direction  direction
+);
+
+/**
+ * @brief Returns true if there are dynamically added user extensions, otherwise
+ * false.
+ *
+ * The list is read without a lock.  Extensions added concurrently are
+ * therefore not necessarily visible to the caller.
+ */
+RTEMS_INLINE_ROUTINE bool _User_extensions_Has_dynamic( void )
+{
+  return !_Chain_Is_empty( &_User_extensions_List.Active );
+}
+
 /** @} */
 
 /**
@@ -203,24 +278,53 @@ void _User_extensions_Iterate(
 
 static inline bool _User_extensions_Thread_create( Thread_Control *created )
 {
-  User_extensions_Thread_create_context ctx = { created, true };
+  User_extensions_Thread_create_context   ctx = { created, true };
+  Thread_Control                         *executing;
+  const User_extensions_Initial_callouts *initial;
+  uint32_t                                i;
 
-  _User_extensions_Iterate(
-    &ctx,
-    _User_extensions_Thread_create_visitor,
-    CHAIN_ITERATOR_FORWARD
-  );
+  executing = _Thread_Get_executing();
+  initial = &_User_extensions_Initial_callouts;
+
+  for ( i = 0 ; i < initial->thread_create_count ; ++i ) {
+    if ( !( *initial->thread_create[ i ] )( executing, created ) ) {
+      return false;
+    }
+  }
+
+  if ( _User_extensions_Has_dynamic() ) {
+    _User_extensions_Iterate_dynamic(
+      &ctx,
+      _User_extensions_Thread_create_visitor,
+      CHAIN_ITERATOR_FORWARD
+    );
+  }
 
   return ctx.ok;
 }
 
 static inline void _User_extensions_Thread_delete( Thread_Control *deleted )
 {
-  _User_extensions_Iterate(
-    deleted,
-    _User_extensions_Thread_delete_visitor,
-    CHAIN_ITERATOR_BACKWARD
-  );
+  Thread_Control                         *executing;
+  const User_extensions_Initial_callouts *initial;
+  uint32_t                                i;
+
+  if ( _User_extensions_Has_dynamic() ) {
+    _User_extensions_Iterate_dynamic(
+      deleted,
+      _User_extensions_Thread_delete_visitor,
+      CHAIN_ITERATOR_BACKWARD
+    );
+  }
+
+  executing = _Thread_Get_executing();
+  initial = &_User_extensions_Initial_callouts;
+  i = initial->thread_delete_count;
+
+  while ( i > 0 ) {
+    --i;
+    ( *initial->thread_delete[ i ] )( executing, deleted );
+  }
 }
 
 static inline void _User_extensions_Thread_start( Thread_Control *started )
@@ -255,33 +359,55 @@ static inline void _User_extensions_Thread_switch(
   Thread_Control *heir
 )
 {
-  const Chain_Control *chain = &_User_extensions_Switches_list;
-  const Chain_Node    *tail = _Chain_Immutable_tail( chain );
-  const Chain_Node    *node = _Chain_Immutable_first( chain );
-
-  if ( node != tail ) {
-    Per_CPU_Control *cpu_self;
+  const User_extensions_thread_switch_extension *initial_current;
+  const User_extensions_thread_switch_extension *initial_end;
+  const Chain_Control                           *chain;
+  const Chain_Node                              *tail;
+  const Chain_Node                              *node;
+
+  initial_current = _User_extensions_Initial_callouts.thread_switch;
+  initial_end = initial_current
+    + _User_extensions_Initial_callouts.thread_switch_count;
+  chain = &_User_extensions_Switches_list;
+  tail = _Chain_Immutable_tail( chain );
+  node = _Chain_Immutable_first( chain );
+
+  if ( initial_current != initial_end || node != tail ) {
 #if defined(RTEMS_SMP)
-    ISR_Level        level;
-#endif
+    ISR_Level level;
 
-    cpu_self = _Per_CPU_Get();
-
-#if defined(RTEMS_SMP)
     _ISR_Local_disable( level );
 #endif
-    _Per_CPU_Acquire( cpu_self );
 
-    while ( node != tail ) {
-      const User_extensions_Switch_control *extension =
-        (const User_extensions_Switch_control *) node;
+    /*
+     * The initial callouts are immutable after system initialization, so no
+     * lock is necessary to call them.
+     */
+    while ( initial_current != initial_end ) {
+      ( *initial_current )( executing, heir );
+      ++initial_current;
+    }
+
+    if ( node != tail ) {
+      Per_CPU_Control *cpu_self;
+
+      cpu_self = _Per_CPU_Get();
+      _Per_CPU_Acquire( cpu_self );
+
+      node = _Chain_Immutable_first( chain );
+
+      while ( node != tail ) {
+        const User_extensions_Switch_control *extension =
+          (const User_extensions_Switch_control *) node;
+
+        (*extension->thread_switch)( executing, heir );
 
-      (*extension->thread_switch)( executing, heir );
+        node = _Chain_Immutable_next( node );
+      }
 
-      node = _Chain_Immutable_next( node );
+      _Per_CPU_Release( cpu_self );
     }
 
-    _Per_CPU_Release( cpu_self );
 #if defined(RTEMS_SMP)
     _ISR_Local_enable( level );
 #endif
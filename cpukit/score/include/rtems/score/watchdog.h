@@ -72,6 +72,56 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of levels of a watchdog timing wheel.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief The binary logarithm of the count of slots per level of a watchdog
+ * timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief The count of slots per level of a watchdog timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1U << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief A hierarchical timing wheel for watchdogs.
+ *
+ * The slot of level @a k contains the watchdogs with an expiration time of
+ * less than 2**(6 * (k + 1)) ticks in the future.  The slots of level zero
+ * are processed tick by tick.  The slots of the other levels are cascaded to
+ * the lower levels once the wheel time reaches their range.  Watchdogs with an
+ * expiration time beyond the range of the wheel are scheduled in the
+ * red-black tree of the watchdog header.
+ */
+typedef struct {
+  /**
+   * @brief The time of the last processed wheel tick.
+   */
+  uint64_t now;
+
+  /**
+   * @brief The count of watchdogs scheduled in the slots and the expired
+   * chain.
+   */
+  uint32_t count;
+
+  /**
+   * @brief Chain of expired watchdogs which wait for the invocation of their
+   * service routine.
+   */
+  Chain_Control Expired;
+
+  /**
+   * @brief The slots of the wheel levels.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -86,6 +136,14 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The optional timing wheel of this header.
+   *
+   * In case it is NULL, then all watchdogs are scheduled in the red-black
+   * tree.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -107,7 +165,8 @@ struct Watchdog_Control {
 
     /**
      * @brief this field is a chain node structure and allows this to be placed
-     * on a chain used to manage pending watchdogs by the timer server.
+     * on a chain used to manage pending watchdogs by the timer server or on a
+     * slot of a timing wheel.
      */
     Chain_Node Chain;
   } Node;
@@ -131,6 +190,40 @@ struct Watchdog_Control {
  */
 extern volatile Watchdog_Interval _Watchdog_Ticks_since_boot;
 
+struct Watchdog_Tickless_operations;
+
+/**
+ * @brief The clock driver operations for the tickless mode.
+ *
+ * It is NULL in case the clock driver uses periodic clock interrupts.
+ *
+ * @see _Watchdog_Tickless_enable().
+ */
+extern const struct Watchdog_Tickless_operations *_Watchdog_Tickless;
+
+/**
+ * @brief Returns the watchdog ticks counter in tickless mode.
+ *
+ * The clock tick intervals elapsed since the last clock interrupt of the boot
+ * processor are accounted first.
+ */
+Watchdog_Interval _Watchdog_Tickless_get_ticks_since_boot( void );
+
+/**
+ * @brief Returns the watchdog ticks counter.
+ *
+ * In tickless mode, the watchdog ticks counter is not incremented by each
+ * clock tick, so it must not be read directly.
+ */
+RTEMS_INLINE_ROUTINE Watchdog_Interval _Watchdog_Get_ticks_since_boot( void )
+{
+  if ( _Watchdog_Tickless != NULL ) {
+    return _Watchdog_Tickless_get_ticks_since_boot();
+  }
+
+  return _Watchdog_Ticks_since_boot;
+}
+
 /**
  * @brief The watchdog nanoseconds per tick.
  *
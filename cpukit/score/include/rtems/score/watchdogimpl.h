@@ -21,6 +21,7 @@
 
 #include <rtems/score/watchdog.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/rbtreeimpl.h>
@@ -51,6 +52,12 @@ typedef enum {
    */
   WATCHDOG_SCHEDULED_RED,
 
+  /**
+   * @brief The watchdog is scheduled in a slot or the expired chain of a
+   * timing wheel.
+   */
+  WATCHDOG_SCHEDULED_WHEEL,
+
   /**
    * @brief The watchdog is inactive.
    */
@@ -94,8 +101,42 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
+/**
+ * @brief Initializes a watchdog header with a timing wheel.
+ *
+ * Watchdogs with an expiration time within the range of the timing wheel are
+ * inserted and removed in constant time.
+ *
+ * @param[in] header The watchdog header to initialize.
+ * @param[in] wheel The timing wheel for the watchdog header.
+ * @param[in] now The current time of the watchdog header.
+ */
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+);
+
+/**
+ * @brief Initializes the timing wheels of the monotonic watchdog headers of
+ * all configured processors.
+ *
+ * This function is registered as a system initialization handler by
+ * <rtems/confdefs.h> in case CONFIGURE_WATCHDOG_TIMING_WHEEL is defined.
+ */
+void _Watchdog_Wheel_initialize( void );
+
+/**
+ * @brief The timing wheels of the monotonic watchdog headers.
+ *
+ * This table is defined by the application configuration via
+ * <rtems/confdefs.h>.  There is one timing wheel per configured processor.
+ */
+extern Watchdog_Wheel _Watchdog_Wheel_table[];
+
 RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
   Watchdog_Header *header
 )
@@ -111,6 +152,119 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Clock driver operations for the tickless mode.
+ *
+ * @see _Watchdog_Tickless_enable().
+ */
+typedef struct Watchdog_Tickless_operations {
+  /**
+   * @brief Returns the count of clock tick intervals elapsed since the last
+   * call of this operation.
+   *
+   * It is called with the watchdog lock of the processor owned.
+   */
+  uint32_t ( *elapsed_ticks )( Per_CPU_Control *cpu );
+
+  /**
+   * @brief Programs the next clock interrupt of the processor to happen at
+   * the specified watchdog ticks value.
+   *
+   * It is called with the watchdog lock of the processor owned.  The watchdog
+   * ticks value is greater than the current watchdog ticks value of the
+   * processor.
+   */
+  void ( *set_next_tick )( Per_CPU_Control *cpu, uint64_t next_tick );
+
+  /**
+   * @brief Maximum count of clock tick intervals between two clock
+   * interrupts.
+   *
+   * The clock driver must limit this value so that the timecounter does not
+   * overflow.
+   */
+  uint32_t max_ticks;
+} Watchdog_Tickless_operations;
+
+/**
+ * @brief Enables the tickless mode for a processor.
+ *
+ * In tickless mode the clock interrupt of the processor is programmed to
+ * happen at the next expiration time of its watchdogs.  The clock interrupt
+ * must call _Watchdog_Tickless_tick() instead of _Watchdog_Tick().  Clock
+ * interrupts are periodic as long as the executing or heir thread of the
+ * processor uses a CPU budget algorithm.  The watchdog ticks value of the
+ * processor is synchronized with the elapsed clock tick intervals each time
+ * the watchdog lock of the processor is acquired via
+ * _Watchdog_Per_CPU_acquire_critical().
+ *
+ * @param[in] cpu The processor.
+ * @param[in] operations The clock driver operations.
+ */
+void _Watchdog_Tickless_enable(
+  Per_CPU_Control                    *cpu,
+  const Watchdog_Tickless_operations *operations
+);
+
+/**
+ * @brief Performs a watchdog tick in tickless mode.
+ *
+ * All elapsed clock tick intervals are accounted, the expired watchdogs are
+ * served, and the next clock interrupt is programmed.
+ *
+ * @param[in] cpu The processor for this watchdog tick.
+ */
+void _Watchdog_Tickless_tick( Per_CPU_Control *cpu );
+
+/**
+ * @brief Accounts the clock tick intervals elapsed since the last clock
+ * interrupt in the watchdog ticks value of the processor.
+ *
+ * The watchdog lock of the processor must be owned by the caller.
+ */
+void _Watchdog_Tickless_synchronize_critical( Per_CPU_Control *cpu );
+
+/**
+ * @brief Programs the next clock interrupt of the processor.
+ *
+ * The watchdog lock of the processor must be owned by the caller.
+ */
+void _Watchdog_Tickless_reprogram_critical( Per_CPU_Control *cpu );
+
+/**
+ * @brief Ensures periodic clock interrupts for the heir thread of a thread
+ * dispatch in tickless mode.
+ *
+ * The scheduler tick operation consumes the CPU budget of the executing
+ * thread.  A thread with a CPU budget algorithm may become the heir long
+ * after the last clock interrupt was programmed, so the next clock interrupt
+ * is reprogrammed to happen with the next clock tick if necessary.
+ *
+ * Interrupts must be disabled by the caller.
+ *
+ * @param[in] cpu The processor of the thread dispatch.
+ * @param[in] heir The heir thread.
+ */
+void _Watchdog_Tickless_dispatch(
+  Per_CPU_Control              *cpu,
+  const struct _Thread_Control *heir
+);
+
+/**
+ * @brief Returns the watchdog ticks value of the next clock tick necessary to
+ * serve the watchdogs of the processor.
+ *
+ * The watchdog lock of the processor must be owned by the caller.
+ *
+ * @param[in] cpu The processor.
+ * @param[in] max_ticks The maximum count of ticks from now.
+ *
+ * @return The next watchdog ticks value.  It is at least the current watchdog
+ * ticks value plus one and at most the current watchdog ticks value plus
+ * @a max_ticks.
+ */
+uint64_t _Watchdog_Next_tick( const Per_CPU_Control *cpu, uint32_t max_ticks );
+
 RTEMS_INLINE_ROUTINE Watchdog_State _Watchdog_Get_state(
   const Watchdog_Control *the_watchdog
 )
@@ -185,6 +339,47 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Initialize(
   the_watchdog->routine = routine;
 }
 
+/**
+ * @brief Inserts a watchdog into a timing wheel.
+ *
+ * @retval true The watchdog was inserted into the timing wheel.
+ * @retval false The expiration time is beyond the range of the timing wheel.
+ */
+bool _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Removes a watchdog scheduled in a timing wheel.
+ */
+RTEMS_INLINE_ROUTINE void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  _Assert( wheel->count > 0 );
+  --wheel->count;
+  _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+}
+
+/**
+ * @brief Advances the timing wheel to the specified time.
+ *
+ * All watchdogs with an expiration time less than or equal to the now time
+ * are moved to the expired chain of the timing wheel at once.
+ */
+void _Watchdog_Wheel_advance( Watchdog_Wheel *wheel, uint64_t now );
+
+/**
+ * @brief Returns a lower bound of the next expiration time of the watchdogs
+ * of a timing wheel.
+ *
+ * @retval UINT64_MAX The timing wheel is empty.
+ */
+uint64_t _Watchdog_Wheel_next_expire( const Watchdog_Wheel *wheel );
+
 void _Watchdog_Do_tickle(
   Watchdog_Header  *header,
   uint64_t          now,
@@ -429,6 +624,10 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Per_CPU_acquire_critical(
 )
 {
   _ISR_lock_Acquire( &cpu->Watchdog.Lock, lock_context );
+
+  if ( cpu->Watchdog.next_tick != 0 ) {
+    _Watchdog_Tickless_synchronize_critical( cpu );
+  }
 }
 
 RTEMS_INLINE_ROUTINE void _Watchdog_Per_CPU_release_critical(
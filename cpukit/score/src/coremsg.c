@@ -46,7 +46,8 @@ bool _CORE_message_queue_Initialize(
   CORE_message_queue_Control     *the_message_queue,
   CORE_message_queue_Disciplines  discipline,
   uint32_t                        maximum_pending_messages,
-  size_t                          maximum_message_size
+  size_t                          maximum_message_size,
+  bool                            zero_copy
 )
 {
   size_t message_buffering_required = 0;
@@ -56,6 +57,7 @@ bool _CORE_message_queue_Initialize(
   the_message_queue->maximum_pending_messages   = maximum_pending_messages;
   the_message_queue->number_of_pending_messages = 0;
   the_message_queue->maximum_message_size       = maximum_message_size;
+  the_message_queue->zero_copy                  = zero_copy;
   _CORE_message_queue_Set_notify( the_message_queue, NULL );
 
   /*
@@ -103,6 +105,9 @@ bool _CORE_message_queue_Initialize(
   );
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  _RBTree_Initialize_empty( &the_message_queue->Pending_priorities );
+#endif
 
   _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
 
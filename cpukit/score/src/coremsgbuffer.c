@@ -0,0 +1,168 @@
+/**
+ * @file
+ *
+ * @brief Zero-Copy Message Buffer Operations
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+Status_Control _CORE_message_queue_Get_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  CORE_message_queue_Buffer_control **the_message_p,
+  Thread_queue_Context               *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( !the_message_queue->zero_copy ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_NOT_DEFINED;
+  }
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+
+  if ( the_message == NULL ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_TOO_MANY;
+  }
+
+  _Chain_Set_off_chain( &the_message->Node );
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+
+  *the_message_p = the_message;
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  if ( !the_message_queue->zero_copy ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_NOT_DEFINED;
+  }
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  /*
+   *  Threads wait on zero-copy message queues only to receive a message, see
+   *  _CORE_message_queue_Submit().  If there are pending messages, then there
+   *  can't be threads waiting for us to send them a message.
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+  } else {
+    the_thread = NULL;
+  }
+
+  if ( the_thread != NULL ) {
+    the_message->Contents.size = size;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    the_message->priority = submit_type;
+#endif
+    *(CORE_message_queue_Buffer_control **)
+      the_thread->Wait.return_argument_second.mutable_object = the_message;
+    the_thread->Wait.count = (uint32_t) submit_type;
+
+    _Thread_queue_Extract_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      the_thread,
+      queue_context
+    );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Insert_buffer(
+    the_message_queue,
+    the_message,
+    size,
+    submit_type
+  );
+  _CORE_message_queue_Release_and_notify( the_message_queue, queue_context );
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( !the_message_queue->zero_copy ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_NOT_DEFINED;
+  }
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    *the_message_p = the_message;
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  executing->Wait.return_argument_second.mutable_object = the_message_p;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+)
+{
+  _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+}
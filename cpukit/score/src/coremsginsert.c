@@ -21,19 +21,92 @@
 #include <rtems/score/coremsgimpl.h>
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
-static bool _CORE_message_queue_Order(
-  const void       *left,
-  const Chain_Node *right
+static CORE_message_queue_Buffer_control *_CORE_message_queue_Priority_node(
+  RBTree_Node *node
 )
 {
-   const int                               *left_priority;
-   const CORE_message_queue_Buffer_control *right_message;
+  return RTEMS_CONTAINER_OF(
+    node,
+    CORE_message_queue_Buffer_control,
+    Priority_node
+  );
+}
+
+static void _CORE_message_queue_Insert_ordered(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  int                                priority
+)
+{
+  RBTree_Control                    *priorities;
+  RBTree_Node                      **link;
+  RBTree_Node                       *parent;
+  CORE_message_queue_Buffer_control *previous;
 
-   left_priority = (const int *) left;
-   right_message = (const CORE_message_queue_Buffer_control *) right;
+  priorities = &the_message_queue->Pending_priorities;
+  link = _RBTree_Root_reference( priorities );
+  parent = NULL;
+  previous = NULL;
 
-   return *left_priority <
-     _CORE_message_queue_Get_message_priority( right_message );
+  while ( *link != NULL ) {
+    CORE_message_queue_Buffer_control *last;
+
+    parent = *link;
+    last = _CORE_message_queue_Priority_node( parent );
+
+    if ( priority == last->priority ) {
+      /*
+       *  Append to the existing group of this priority.  The new message is
+       *  now the last one of the group and takes over its index node.
+       */
+      _Chain_Insert_unprotected( &last->Node, &the_message->Node );
+      _RBTree_Replace_node(
+        priorities,
+        &last->Priority_node,
+        &the_message->Priority_node
+      );
+      return;
+    }
+
+    if ( priority < last->priority ) {
+      link = _RBTree_Left_reference( parent );
+    } else {
+      previous = last;
+      link = _RBTree_Right_reference( parent );
+    }
+  }
+
+  /*
+   *  This is a new priority group.  It starts right after the group with the
+   *  next higher priority (lower value) or at the queue head.
+   */
+  if ( previous != NULL ) {
+    _Chain_Insert_unprotected( &previous->Node, &the_message->Node );
+  } else {
+    _Chain_Prepend_unprotected(
+      &the_message_queue->Pending_messages,
+      &the_message->Node
+    );
+  }
+
+  _RBTree_Add_child( &the_message->Priority_node, parent, link );
+  _RBTree_Insert_color( priorities, &the_message->Priority_node );
+}
+
+static bool _CORE_message_queue_Priority_less(
+  const void        *left,
+  const RBTree_Node *right
+)
+{
+  const int                               *left_priority;
+  const CORE_message_queue_Buffer_control *right_message;
+
+  left_priority = (const int *) left;
+  right_message = _CORE_message_queue_Priority_node(
+    RTEMS_DECONST( RBTree_Node *, right )
+  );
+
+  return *left_priority < right_message->priority;
 }
 #endif
 
@@ -45,15 +118,29 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 )
 {
-  Chain_Control *pending_messages;
-
-  the_message->Contents.size = content_size;
-
   _CORE_message_queue_Copy_buffer(
     content_source,
     the_message->Contents.buffer,
     content_size
   );
+  _CORE_message_queue_Insert_buffer(
+    the_message_queue,
+    the_message,
+    content_size,
+    submit_type
+  );
+}
+
+void _CORE_message_queue_Insert_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             content_size,
+  CORE_message_queue_Submit_types    submit_type
+)
+{
+  Chain_Control *pending_messages;
+
+  the_message->Contents.size = content_size;
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   the_message->priority = submit_type;
@@ -62,21 +149,43 @@ void _CORE_message_queue_Insert_message(
   pending_messages = &the_message_queue->Pending_messages;
   ++the_message_queue->number_of_pending_messages;
 
-  if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
-    _Chain_Append_unprotected( pending_messages, &the_message->Node );
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
-  } else  if ( submit_type != CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
-    int priority;
-
-    priority = _CORE_message_queue_Get_message_priority( the_message );
-    _Chain_Insert_ordered_unprotected(
-      pending_messages,
-      &the_message->Node,
-      &priority,
-      _CORE_message_queue_Order
+  if ( submit_type == CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
+    /*
+     *  Urgent messages are in LIFO order at the queue head.  Only the first
+     *  urgent message becomes the last one of its group and thus indexed.
+     */
+    if (
+      _Chain_Is_empty( pending_messages )
+        || _CORE_message_queue_Get_message_priority(
+          (const CORE_message_queue_Buffer_control *)
+            _Chain_Immutable_first( pending_messages )
+        ) != CORE_MESSAGE_QUEUE_URGENT_REQUEST
+    ) {
+      int priority;
+
+      priority = CORE_MESSAGE_QUEUE_URGENT_REQUEST;
+      _RBTree_Insert_inline(
+        &the_message_queue->Pending_priorities,
+        &the_message->Priority_node,
+        &priority,
+        _CORE_message_queue_Priority_less
+      );
+    }
+
+    _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
+  } else {
+    _CORE_message_queue_Insert_ordered(
+      the_message_queue,
+      the_message,
+      submit_type
     );
-#endif
+  }
+#else
+  if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
+    _Chain_Append_unprotected( pending_messages, &the_message->Node );
   } else {
     _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
   }
+#endif
 }
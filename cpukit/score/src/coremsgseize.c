@@ -36,6 +36,11 @@ Status_Control _CORE_message_queue_Seize(
 {
   CORE_message_queue_Buffer_control *the_message;
 
+  if ( the_message_queue->zero_copy ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_NOT_DEFINED;
+  }
+
   the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
   if ( the_message != NULL ) {
     the_message_queue->number_of_pending_messages -= 1;
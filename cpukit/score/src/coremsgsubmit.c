@@ -74,27 +74,7 @@ Status_Control _CORE_message_queue_Submit(
       submit_type
     );
 
-#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
-    /*
-     *  According to POSIX, does this happen before or after the message
-     *  is actually enqueued.  It is logical to think afterwards, because
-     *  the message is actually in the queue at this point.
-     */
-    if (
-      the_message_queue->number_of_pending_messages == 1
-        && the_message_queue->notify_handler != NULL
-    ) {
-      ( *the_message_queue->notify_handler )(
-        the_message_queue,
-        queue_context
-      );
-    } else {
-      _CORE_message_queue_Release( the_message_queue, queue_context );
-    }
-#else
-    _CORE_message_queue_Release( the_message_queue, queue_context );
-#endif
-
+    _CORE_message_queue_Release_and_notify( the_message_queue, queue_context );
     return STATUS_SUCCESSFUL;
   }
 
@@ -105,9 +85,11 @@ Status_Control _CORE_message_queue_Submit(
     /*
      *  No message buffers were available so we may need to return an
      *  overflow error or block the sender until the message is placed
-     *  on the queue.
+     *  on the queue.  Senders do not block on zero-copy message queues,
+     *  since receivers may wait on them while all message buffers are in
+     *  use by the application.
      */
-    if ( !wait ) {
+    if ( !wait || the_message_queue->zero_copy ) {
       _CORE_message_queue_Release( the_message_queue, queue_context );
       return STATUS_TOO_MANY;
     }
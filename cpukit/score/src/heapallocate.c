@@ -220,7 +220,7 @@ void *_Heap_Allocate_aligned_with_boundary(
   do {
     Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-    block = _Heap_Free_list_first( heap );
+    block = _Heap_Free_list_first_candidate( heap, block_size_floor );
     while ( block != free_list_tail ) {
       _HAssert( _Heap_Is_prev_used( block ) );
 
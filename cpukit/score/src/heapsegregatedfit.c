@@ -0,0 +1,229 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreHeap
+ *
+ * @brief Heap Handler Segregated Fit Free Block Index
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+/*
+ * The free list of the heap is sorted by the free block class.  A class is
+ * identified by the first level index fl and the second level index sl.  The
+ * first block of each non-empty class is stored in the index and the bitmaps
+ * indicate the non-empty classes.  Finding the next non-empty class greater
+ * than or equal to a given class needs at most two find first bit set
+ * operations.
+ */
+
+static bool _Heap_Segregated_find(
+  const Heap_Segregated_index *index,
+  unsigned int *fl,
+  unsigned int *sl
+)
+{
+  uint32_t sl_map = index->sl_bitmap[ *fl ] & ( UINT32_MAX << *sl );
+
+  if ( sl_map == 0 ) {
+    uint32_t fl_map;
+
+    if ( *fl + 1 >= HEAP_SEGREGATED_FL_COUNT ) {
+      return false;
+    }
+
+    fl_map = index->fl_bitmap & ( UINT32_MAX << ( *fl + 1 ) );
+
+    if ( fl_map == 0 ) {
+      return false;
+    }
+
+    *fl = (unsigned int) __builtin_ctz( fl_map );
+    sl_map = index->sl_bitmap[ *fl ];
+    _HAssert( sl_map != 0 );
+  }
+
+  *sl = (unsigned int) __builtin_ctz( sl_map );
+
+  return true;
+}
+
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated_index;
+  Heap_Block *next;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+  next = index->first[ fl ][ sl ];
+
+  if ( next == NULL ) {
+    unsigned int next_fl = fl;
+    unsigned int next_sl = sl;
+
+    if ( _Heap_Segregated_find( index, &next_fl, &next_sl ) ) {
+      next = index->first[ next_fl ][ next_sl ];
+    } else {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    index->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+    index->fl_bitmap |= UINT32_C( 1 ) << fl;
+  }
+
+  _Heap_Free_list_insert_before( next, block );
+  index->first[ fl ][ sl ] = block;
+}
+
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated_index;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block *const next = block->next;
+    bool same_class = false;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      unsigned int next_fl;
+      unsigned int next_sl;
+
+      _Heap_Segregated_mapping( _Heap_Block_size( next ), &next_fl, &next_sl );
+      same_class = next_fl == fl && next_sl == sl;
+    }
+
+    if ( same_class ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->sl_bitmap[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( index->sl_bitmap[ fl ] == 0 ) {
+        index->fl_bitmap &= ~( UINT32_C( 1 ) << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+void _Heap_Segregated_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  unsigned int old_fl;
+  unsigned int old_sl;
+  unsigned int new_fl;
+  unsigned int new_sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &old_fl, &old_sl );
+  _Heap_Segregated_mapping( size, &new_fl, &new_sl );
+
+  if ( old_fl == new_fl && old_sl == new_sl ) {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  } else {
+    _Heap_Segregated_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_insert( heap, block );
+  }
+}
+
+Heap_Block *_Heap_Segregated_first_candidate(
+  Heap_Control *heap,
+  uintptr_t size
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated_index;
+  unsigned int msb = _Heap_Segregated_fls( size );
+  unsigned int fl;
+  unsigned int sl;
+
+  /*
+   * Round up the size to the next class boundary.  All blocks of the class
+   * of the rounded up size are large enough.
+   */
+  if ( msb > HEAP_SEGREGATED_SL_COUNT_LOG2 ) {
+    uintptr_t const round_up =
+      ( (uintptr_t) 1 << ( msb - HEAP_SEGREGATED_SL_COUNT_LOG2 ) ) - 1;
+
+    if ( size + round_up > size ) {
+      _Heap_Segregated_mapping( size + round_up, &fl, &sl );
+
+      if ( _Heap_Segregated_find( index, &fl, &sl ) ) {
+        return index->first[ fl ][ sl ];
+      }
+    }
+  }
+
+  /*
+   * There is no class with blocks which are large enough for sure.  The
+   * blocks of the class of the size may be large enough.
+   */
+  _Heap_Segregated_mapping( size, &fl, &sl );
+
+  if ( _Heap_Segregated_find( index, &fl, &sl ) ) {
+    return index->first[ fl ][ sl ];
+  }
+
+  return _Heap_Free_list_tail( heap );
+}
+
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *heap_area_begin_ptr,
+  uintptr_t heap_area_size,
+  uintptr_t page_size
+)
+{
+  uintptr_t const heap_area_begin = (uintptr_t) heap_area_begin_ptr;
+  uintptr_t const index_begin = _Heap_Align_up( heap_area_begin, CPU_ALIGNMENT );
+  uintptr_t const index_end = index_begin + sizeof( Heap_Segregated_index );
+  Heap_Segregated_index *const index = (Heap_Segregated_index *) index_begin;
+  Heap_Block *first_block;
+  uintptr_t space_available;
+
+  if (
+    index_end < heap_area_begin
+      || index_end - heap_area_begin >= heap_area_size
+  ) {
+    /* Invalid area or area too small */
+    return 0;
+  }
+
+  space_available = _Heap_Initialize(
+    heap,
+    (void *) index_end,
+    heap_area_size - ( index_end - heap_area_begin ),
+    page_size
+  );
+  if ( space_available == 0 ) {
+    return 0;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+  heap->segregated_index = index;
+
+  first_block = _Heap_Free_list_first( heap );
+  _Heap_Free_list_remove( first_block );
+  _Heap_Segregated_insert( heap, first_block );
+
+  return space_available;
+}
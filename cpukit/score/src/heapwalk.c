@@ -53,6 +53,94 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
   va_end( ap );
 }
 
+static bool _Heap_Walk_check_segregated_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated_index;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  unsigned int prev_class = 0;
+  uint32_t class_count = 0;
+  uint32_t bit_count = 0;
+  unsigned int fl;
+
+  while ( free_block != free_list_tail ) {
+    unsigned int sl;
+    unsigned int current_class;
+
+    _Heap_Segregated_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+    current_class = fl * HEAP_SEGREGATED_SL_COUNT + sl + 1;
+
+    if ( current_class < prev_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: free list not sorted by class\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( current_class != prev_class ) {
+      if (
+        index->first[ fl ][ sl ] != free_block
+          || ( index->sl_bitmap[ fl ] & ( UINT32_C( 1 ) << sl ) ) == 0
+          || ( index->fl_bitmap & ( UINT32_C( 1 ) << fl ) ) == 0
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not the first block of its class\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      ++class_count;
+    }
+
+    prev_class = current_class;
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FL_COUNT; ++fl ) {
+    uint32_t const sl_map = index->sl_bitmap[ fl ];
+
+    if (
+      ( sl_map != 0 ) != ( ( index->fl_bitmap & ( UINT32_C( 1 ) << fl ) ) != 0 )
+    ) {
+      (*printer)(
+        source,
+        true,
+        "segregated index: inconsistent first level bitmap\n"
+      );
+
+      return false;
+    }
+
+    bit_count += (uint32_t) __builtin_popcount( sl_map );
+  }
+
+  if ( bit_count != class_count ) {
+    (*printer)(
+      source,
+      true,
+      "segregated index: %u non-empty classes, %u classes in free list\n",
+      bit_count,
+      class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
@@ -117,6 +205,10 @@ static bool _Heap_Walk_check_free_list(
     free_block = free_block->next;
   }
 
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Walk_check_segregated_index( source, printer, heap );
+  }
+
   return true;
 }
 
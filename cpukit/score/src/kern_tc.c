@@ -2132,6 +2132,18 @@ _Timecounter_Tick(void)
 	_Watchdog_Tick(cpu_self);
 }
 
+void
+_Timecounter_Tick_tickless(void)
+{
+	Per_CPU_Control *cpu_self = _Per_CPU_Get();
+
+	if (_Per_CPU_Is_boot_processor(cpu_self)) {
+		tc_windup(NULL);
+	}
+
+	_Watchdog_Tickless_tick(cpu_self);
+}
+
 void
 _Timecounter_Tick_simple(uint32_t delta, uint32_t offset,
     ISR_lock_Context *lock_context)
@@ -0,0 +1,94 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreMPSCRing
+ *
+ * @brief Multiple Producer Single Consumer Ring Implementation
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/mpscring.h>
+#include <rtems/score/assert.h>
+
+void _MPSC_ring_Initialize(
+  MPSC_ring_Control *ring,
+  MPSC_ring_Slot    *slots,
+  unsigned int       slot_count
+)
+{
+  unsigned int i;
+
+  _Assert( slot_count > 0 );
+  _Assert( ( slot_count & ( slot_count - 1 ) ) == 0 );
+
+  for ( i = 0; i < slot_count; ++i ) {
+    _Atomic_Init_uint( &slots[ i ].sequence, i );
+    slots[ i ].item = NULL;
+  }
+
+  _Atomic_Init_uint( &ring->enqueue_position, 0 );
+  _Atomic_Init_uint( &ring->consumer_waiting, 0 );
+  _Atomic_Init_uint( &ring->overruns, 0 );
+  ring->dequeue_position = 0;
+  ring->mask = slot_count - 1;
+  ring->slots = slots;
+  _Semaphore_Initialize( &ring->Wakeup, 0 );
+}
+
+void _MPSC_ring_Destroy( MPSC_ring_Control *ring )
+{
+  _Semaphore_Destroy( &ring->Wakeup );
+}
+
+void _MPSC_ring_Wake_up_consumer( MPSC_ring_Control *ring )
+{
+  /*
+   * Several producers may observe the waiting consumer.  Only the one which
+   * clears the indicator posts the semaphore.
+   */
+  if (
+    _Atomic_Exchange_uint( &ring->consumer_waiting, 0, ATOMIC_ORDER_ACQ_REL )
+      != 0
+  ) {
+    _Semaphore_Post( &ring->Wakeup );
+  }
+}
+
+void *_MPSC_ring_Dequeue( MPSC_ring_Control *ring )
+{
+  while ( true ) {
+    void *item;
+
+    item = _MPSC_ring_Try_dequeue( ring );
+    if ( item != NULL ) {
+      return item;
+    }
+
+    _Atomic_Store_uint( &ring->consumer_waiting, 1, ATOMIC_ORDER_RELAXED );
+
+    /* Pairs with the fence in _MPSC_ring_Enqueue() */
+    _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+    item = _MPSC_ring_Try_dequeue( ring );
+    if ( item != NULL ) {
+      /*
+       * In case a producer cleared the indicator in the meantime, then the
+       * semaphore has a surplus count.  This results only in a spurious
+       * wake-up in the next wait which is covered by the loop.
+       */
+      _Atomic_Store_uint( &ring->consumer_waiting, 0, ATOMIC_ORDER_RELAXED );
+      return item;
+    }
+
+    _Semaphore_Wait( &ring->Wakeup );
+  }
+}
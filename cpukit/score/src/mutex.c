@@ -90,6 +90,25 @@ static void _Mutex_Queue_release(
   _ISR_Local_enable( level );
 }
 
+#if defined(RTEMS_SMP)
+static bool _Mutex_Acquire_fast( Mutex_Control *mutex, ISR_Level level )
+{
+  Thread_Control *executing;
+
+  executing = _Thread_Executing;
+
+  if (
+    !_Thread_queue_Queue_try_set_owner( &mutex->Queue.Queue, executing )
+  ) {
+    return false;
+  }
+
+  _Thread_Resource_count_increment( executing );
+  _ISR_Local_enable( level );
+  return true;
+}
+#endif
+
 static void _Mutex_Acquire_slow(
   Mutex_Control        *mutex,
   Thread_Control       *owner,
@@ -125,10 +144,10 @@ static void _Mutex_Release_critical(
   Thread_queue_Heads *heads;
 
   heads = mutex->Queue.Queue.heads;
-  mutex->Queue.Queue.owner = NULL;
   _Thread_Resource_count_decrement( executing );
 
   if ( __predict_true( heads == NULL ) ) {
+    _Thread_queue_Queue_clear_owner_critical( &mutex->Queue.Queue );
     _Mutex_Queue_release( mutex, level, queue_context );
   } else {
     _Thread_queue_Context_set_ISR_level( queue_context, level );
@@ -153,12 +172,21 @@ void _Mutex_Acquire( struct _Mutex_Control *_mutex )
   mutex = _Mutex_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( mutex, level ) ) ) {
+    return;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( mutex, &queue_context );
 
-  owner = mutex->Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     _Mutex_Queue_release( mutex, level, &queue_context );
   } else {
@@ -181,12 +209,21 @@ int _Mutex_Acquire_timed(
   mutex = _Mutex_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( mutex, level ) ) ) {
+    return 0;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( mutex, &queue_context );
 
-  owner = mutex->Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     _Mutex_Queue_release( mutex, level, &queue_context );
 
@@ -214,12 +251,21 @@ int _Mutex_Try_acquire( struct _Mutex_Control *_mutex )
   mutex = _Mutex_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( mutex, level ) ) ) {
+    return 0;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( mutex, &queue_context );
 
-  owner = mutex->Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     eno = 0;
   } else {
@@ -266,12 +312,21 @@ void _Mutex_recursive_Acquire( struct _Mutex_recursive_Control *_mutex )
   mutex = _Mutex_recursive_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( &mutex->Mutex, level ) ) ) {
+    return;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( &mutex->Mutex, &queue_context );
 
-  owner = mutex->Mutex.Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Mutex.Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Mutex.Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     _Mutex_Queue_release( &mutex->Mutex, level, &queue_context );
   } else if ( owner == executing ) {
@@ -297,12 +352,21 @@ int _Mutex_recursive_Acquire_timed(
   mutex = _Mutex_recursive_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( &mutex->Mutex, level ) ) ) {
+    return 0;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( &mutex->Mutex, &queue_context );
 
-  owner = mutex->Mutex.Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Mutex.Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Mutex.Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     _Mutex_Queue_release( &mutex->Mutex, level, &queue_context );
 
@@ -335,12 +399,21 @@ int _Mutex_recursive_Try_acquire( struct _Mutex_recursive_Control *_mutex )
   mutex = _Mutex_recursive_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_ISR_disable( &queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if ( __predict_true( _Mutex_Acquire_fast( &mutex->Mutex, level ) ) ) {
+    return 0;
+  }
+#endif
+
   executing = _Mutex_Queue_acquire_critical( &mutex->Mutex, &queue_context );
 
-  owner = mutex->Mutex.Queue.Queue.owner;
+  owner = _Thread_queue_Queue_claim_owner_critical(
+    &mutex->Mutex.Queue.Queue,
+    executing
+  );
 
   if ( __predict_true( owner == NULL ) ) {
-    mutex->Mutex.Queue.Queue.owner = executing;
     _Thread_Resource_count_increment( executing );
     eno = 0;
   } else if ( owner == executing ) {
@@ -26,7 +26,191 @@
 #include <rtems/score/sysstate.h>
 #include <rtems/score/wkspace.h>
 
-#include <string.h>  /* for memcpy() */
+#include <string.h>  /* for memset() */
+
+/*
+ *  Grows the block tables so that they can hold at least the specified count
+ *  of blocks.  The capacity is doubled to keep the count of copy operations
+ *  logarithmic in the count of blocks.
+ */
+static bool _Objects_Extend_block_tables(
+  Objects_Information *information,
+  uint32_t             block_count
+)
+{
+  ISR_lock_Context   lock_context;
+  void             **object_blocks;
+  uint32_t          *inactive_per_block;
+  Objects_Control ***local_table;
+  void              *old_tables;
+  uint32_t           old_capacity;
+  uint32_t           capacity;
+  uint32_t           capacity_limit;
+  uint32_t           block;
+  size_t             block_size;
+  uintptr_t          object_blocks_size;
+  uintptr_t          inactive_per_block_size;
+
+  old_capacity = information->block_capacity;
+
+  if ( block_count <= old_capacity ) {
+    return true;
+  }
+
+  capacity_limit = OBJECTS_ID_FINAL_INDEX / information->allocation_size;
+  capacity = 2 * old_capacity;
+
+  if ( capacity > capacity_limit ) {
+    capacity = capacity_limit;
+  }
+
+  if ( capacity < block_count ) {
+    capacity = block_count;
+  }
+
+  /*
+   *  The allocation has :
+   *
+   *      void            *objects[capacity];
+   *      uint32_t         inactive_count[capacity];
+   *      Objects_Control **local_table[capacity];
+   *
+   *  The local table directory needs at most one page per block, since a page
+   *  covers more object indices than a block.
+   */
+  object_blocks_size = (uintptr_t)_Addresses_Align_up(
+      (void*)(capacity * sizeof(void*)),
+      CPU_ALIGNMENT
+  );
+  inactive_per_block_size =
+      (uintptr_t)_Addresses_Align_up(
+          (void*)(capacity * sizeof(uint32_t)),
+          CPU_ALIGNMENT
+      );
+  block_size = object_blocks_size + inactive_per_block_size +
+      (capacity * sizeof(Objects_Control **));
+  if ( information->auto_extend ) {
+    object_blocks = _Workspace_Allocate( block_size );
+    if ( !object_blocks ) {
+      return false;
+    }
+  } else {
+    object_blocks = _Workspace_Allocate_or_fatal_error( block_size );
+  }
+
+  /*
+   *  Break the block into the various sections.
+   */
+  inactive_per_block = (uint32_t *) _Addresses_Add_offset(
+      object_blocks,
+      object_blocks_size
+  );
+  local_table = (Objects_Control ***) _Addresses_Add_offset(
+      inactive_per_block,
+      inactive_per_block_size
+  );
+
+  /*
+   *  Copy the entries of the old tables and initialise the new entries.  The
+   *  local table pages are kept, only the page directory is copied.
+   */
+  for ( block = 0 ; block < old_capacity ; ++block ) {
+    object_blocks[ block ] = information->object_blocks[ block ];
+    inactive_per_block[ block ] = information->inactive_per_block[ block ];
+    local_table[ block ] = information->local_table[ block ];
+  }
+
+  for ( block = old_capacity ; block < capacity ; ++block ) {
+    object_blocks[ block ] = NULL;
+    inactive_per_block[ block ] = 0;
+    local_table[ block ] = NULL;
+  }
+
+  if ( old_capacity == 0 ) {
+    /* Keep the null page of the empty table */
+    local_table[ 0 ] = information->local_table[ 0 ];
+  }
+
+  /* FIXME: https://devel.rtems.org/ticket/2280 */
+  _ISR_lock_ISR_disable( &lock_context );
+
+  old_tables = information->object_blocks;
+
+  information->object_blocks = object_blocks;
+  information->inactive_per_block = inactive_per_block;
+  information->local_table = local_table;
+  information->block_capacity = (Objects_Maximum) capacity;
+
+  _ISR_lock_ISR_enable( &lock_context );
+
+  _Workspace_Free( old_tables );
+  return true;
+}
+
+/*
+ *  Allocates the local table pages for the object indices of a new block.
+ *  The pages up to the one of the current maximum are already present.  The
+ *  first page of an empty table replaces the null page.
+ */
+static bool _Objects_Extend_local_table(
+  Objects_Information *information,
+  uint32_t             index_end
+)
+{
+  Objects_Control **first_page;
+  uint32_t          shift;
+  uint32_t          page_begin;
+  uint32_t          page_end;
+  uint32_t          page;
+  size_t            page_size;
+
+  shift = information->local_table_page_shift;
+  page_end = ( ( index_end - 1 ) >> shift ) + 1;
+
+  if ( information->maximum == 0 ) {
+    page_begin = 0;
+  } else {
+    page_begin = ( information->maximum >> shift ) + 1;
+  }
+
+  if ( information->auto_extend ) {
+    page_size = ( (size_t) 1 << shift ) * sizeof( Objects_Control * );
+  } else {
+    page_size = index_end * sizeof( Objects_Control * );
+  }
+
+  first_page = information->local_table[ page_begin ];
+
+  for ( page = page_begin ; page < page_end ; ++page ) {
+    Objects_Control **local_page;
+
+    if ( information->auto_extend ) {
+      local_page = _Workspace_Allocate( page_size );
+    } else {
+      local_page = _Workspace_Allocate_or_fatal_error( page_size );
+    }
+
+    if ( !local_page ) {
+      while ( page > page_begin ) {
+        --page;
+        _Workspace_Free( information->local_table[ page ] );
+        information->local_table[ page ] = NULL;
+      }
+
+      information->local_table[ page_begin ] = first_page;
+      return false;
+    }
+
+    memset( local_page, 0, page_size );
+
+    /*
+     *  The new page is not used before the maximum covers its indices.
+     */
+    information->local_table[ page ] = local_page;
+  }
+
+  return true;
+}
 
 /*
  *  _Objects_Extend_information
@@ -110,129 +294,26 @@ void _Objects_Extend_information(
   }
 
   /*
-   *  Do we need to grow the tables?
+   *  Do we need to grow the tables?  The block tables grow geometrically and
+   *  the local table grows by pages, so the existing local table entries are
+   *  never copied.  The name hash index must be extended before the local
+   *  table, since it cannot roll back its pages.
    */
   if ( do_extend ) {
-    ISR_lock_Context  lock_context;
-    void            **object_blocks;
-    uint32_t         *inactive_per_block;
-    Objects_Control **local_table;
-    void             *old_tables;
-    size_t            block_size;
-    uintptr_t         object_blocks_size;
-    uintptr_t         inactive_per_block_size;
-
-    /*
-     *  Growing the tables means allocating a new area, doing a copy and
-     *  updating the information table.
-     *
-     *  If the maximum is minimum we do not have a table to copy. First
-     *  time through.
-     *
-     *  The allocation has :
-     *
-     *      void            *objects[block_count];
-     *      uint32_t         inactive_count[block_count];
-     *      Objects_Control *local_table[maximum];
-     *
-     *  This is the order in memory. Watch changing the order. See the memcpy
-     *  below.
-     */
-
-    /*
-     *  Up the block count and maximum
-     */
-    block_count++;
-
-    /*
-     *  Allocate the tables and break it up. The tables are:
-     *      1. object_blocks        : void*
-     *      2. inactive_per_blocks : uint32_t
-     *      3. local_table         : Objects_Name*
-     */
-    object_blocks_size = (uintptr_t)_Addresses_Align_up(
-        (void*)(block_count * sizeof(void*)),
-        CPU_ALIGNMENT
-    );
-    inactive_per_block_size =
-        (uintptr_t)_Addresses_Align_up(
-            (void*)(block_count * sizeof(uint32_t)),
-            CPU_ALIGNMENT
-        );
-    block_size = object_blocks_size + inactive_per_block_size +
-        ((maximum + minimum_index) * sizeof(Objects_Control *));
-    if ( information->auto_extend ) {
-      object_blocks = _Workspace_Allocate( block_size );
-      if ( !object_blocks ) {
-        _Workspace_Free( new_object_block );
-        return;
-      }
-    } else {
-      object_blocks = _Workspace_Allocate_or_fatal_error( block_size );
-    }
-
-    /*
-     *  Break the block into the various sections.
-     */
-    inactive_per_block = (uint32_t *) _Addresses_Add_offset(
-        object_blocks,
-        object_blocks_size
-    );
-    local_table = (Objects_Control **) _Addresses_Add_offset(
-        inactive_per_block,
-        inactive_per_block_size
-    );
-
-    /*
-     *  Take the block count down. Saves all the (block_count - 1)
-     *  in the copies.
-     */
-    block_count--;
-
-    if ( information->maximum > minimum_index ) {
-
-      /*
-       *  Copy each section of the table over. This has to be performed as
-       *  separate parts as size of each block has changed.
-       */
-
-      memcpy( object_blocks,
-              information->object_blocks,
-              block_count * sizeof(void*) );
-      memcpy( inactive_per_block,
-              information->inactive_per_block,
-              block_count * sizeof(uint32_t) );
-      memcpy( local_table,
-              information->local_table,
-              (information->maximum + minimum_index) * sizeof(Objects_Control *) );
-    } else {
-
-      /*
-       *  Deal with the special case of the 0 to minimum_index
-       */
-      for ( index = 0; index < minimum_index; index++ ) {
-        local_table[ index ] = NULL;
-      }
-    }
-
-    /*
-     *  Initialise the new entries in the table.
-     */
-    object_blocks[block_count] = NULL;
-    inactive_per_block[block_count] = 0;
-
-    for ( index = index_base ; index < index_end ; ++index ) {
-      local_table[ index ] = NULL;
+    ISR_lock_Context lock_context;
+
+    if (
+      !_Objects_Extend_block_tables( information, block_count + 1 )
+        || !_Objects_Name_hash_extend( information, maximum )
+        || !_Objects_Extend_local_table( information, index_end )
+    ) {
+      _Workspace_Free( new_object_block );
+      return;
     }
 
     /* FIXME: https://devel.rtems.org/ticket/2280 */
     _ISR_lock_ISR_disable( &lock_context );
 
-    old_tables = information->object_blocks;
-
-    information->object_blocks = object_blocks;
-    information->inactive_per_block = inactive_per_block;
-    information->local_table = local_table;
     information->maximum = (Objects_Maximum) maximum;
     information->maximum_id = _Objects_Build_id(
         information->the_api,
@@ -242,10 +323,6 @@ void _Objects_Extend_information(
       );
 
     _ISR_lock_ISR_enable( &lock_context );
-
-    _Workspace_Free( old_tables );
-
-    block_count++;
   }
 
   /*
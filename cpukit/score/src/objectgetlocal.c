@@ -40,7 +40,7 @@ Objects_Control *_Objects_Get(
 
     _ISR_lock_ISR_disable( lock_context );
 
-    the_object = information->local_table[ index ];
+    the_object = _Objects_Get_local_object( information, index );
     if ( the_object != NULL ) {
       /* ISR disabled on behalf of caller */
       return the_object;
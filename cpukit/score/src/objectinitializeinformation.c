@@ -38,7 +38,8 @@ void _Objects_Do_initialize_information(
 #endif
 )
 {
-  static Objects_Control *null_local_table = NULL;
+  static Objects_Control  *null_local_page[ 1 ];
+  static Objects_Control **null_local_table = &null_local_page[ 0 ];
   uint32_t                minimum_index;
   Objects_Maximum         maximum_per_allocation;
 
@@ -48,6 +49,10 @@ void _Objects_Do_initialize_information(
   information->local_table        = 0;
   information->inactive_per_block = 0;
   information->object_blocks      = 0;
+  information->block_capacity     = 0;
+  information->name_hash          = NULL;
+  information->name_hash_order    = 0;
+  information->has_name_hash      = _Objects_Has_name_hash( maximum );
   information->inactive           = 0;
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     information->is_string        = is_string;
@@ -87,6 +92,25 @@ void _Objects_Do_initialize_information(
    */
   information->local_table = &null_local_table;
 
+  /*
+   *  The local table pages of automatically extended classes cover at least
+   *  one block of objects.  Otherwise, there is only one page.
+   */
+  if ( information->auto_extend ) {
+    uint8_t shift;
+
+    shift = 0;
+
+    while ( ( UINT32_C( 1 ) << shift ) <= maximum_per_allocation ) {
+      ++shift;
+    }
+
+    information->local_table_page_shift = shift;
+  } else {
+    information->local_table_page_shift =
+      OBJECTS_LOCAL_TABLE_SINGLE_PAGE_SHIFT;
+  }
+
   /*
    *  Calculate minimum and maximum Id's
    */
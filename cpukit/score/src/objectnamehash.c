@@ -0,0 +1,287 @@
+/**
+ * @file
+ *
+ * @brief Object Name Hash Index
+ * @ingroup ScoreObject
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+static uint32_t _Objects_Name_hash_bucket( uint32_t hash, uint8_t order )
+{
+  /* Fibonacci hashing, the order is at least one */
+  return ( hash * UINT32_C( 0x9e3779b1 ) ) >> ( 32 - order );
+}
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+static uint32_t _Objects_Name_hash_string(
+  const char *name,
+  size_t      name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = UINT32_C( 2166136261 );
+
+  for ( i = 0 ; i < name_length && name[ i ] != '\0' ; ++i ) {
+    hash = ( hash ^ (unsigned char) name[ i ] ) * UINT32_C( 16777619 );
+  }
+
+  return hash;
+}
+#endif
+
+static bool _Objects_Name_hash_get_hash(
+  const Objects_Information *information,
+  const Objects_Control     *the_object,
+  uint32_t                  *hash
+)
+{
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+  if ( information->is_string ) {
+    if ( the_object->name.name_p == NULL ) {
+      return false;
+    }
+
+    *hash = _Objects_Name_hash_string(
+      the_object->name.name_p,
+      information->name_length
+    );
+    return true;
+  }
+#endif
+
+  *hash = the_object->name.name_u32;
+  return *hash != 0;
+}
+
+static Objects_Maximum *_Objects_Name_hash_links(
+  const Objects_Information *information
+)
+{
+  return &information->name_hash[
+    UINT32_C( 1 ) << information->name_hash_order
+  ];
+}
+
+bool _Objects_Name_hash_extend(
+  Objects_Information *information,
+  uint32_t             maximum
+)
+{
+  Objects_Maximum *old_name_hash;
+  Objects_Maximum *name_hash;
+  uint32_t         index;
+  uint8_t          order;
+  size_t           size;
+
+  if ( !information->has_name_hash ) {
+    return true;
+  }
+
+  order = information->name_hash_order;
+
+  if (
+    information->name_hash != NULL
+      && ( UINT32_C( 1 ) << order ) > maximum
+  ) {
+    return true;
+  }
+
+  if ( order == 0 ) {
+    order = 1;
+  }
+
+  while ( ( UINT32_C( 1 ) << order ) <= maximum ) {
+    ++order;
+  }
+
+  size = 2 * ( (size_t) 1 << order ) * sizeof( *name_hash );
+
+  if ( information->auto_extend ) {
+    name_hash = _Workspace_Allocate( size );
+    if ( name_hash == NULL ) {
+      return false;
+    }
+  } else {
+    name_hash = _Workspace_Allocate_or_fatal_error( size );
+  }
+
+  memset( name_hash, 0, size );
+
+  old_name_hash = information->name_hash;
+  information->name_hash = name_hash;
+  information->name_hash_order = order;
+
+  if ( old_name_hash != NULL ) {
+    for ( index = 1 ; index <= information->maximum ; ++index ) {
+      Objects_Control *the_object;
+
+      the_object = _Objects_Get_local_object( information, index );
+
+      if ( the_object != NULL ) {
+        _Objects_Name_hash_insert( information, the_object );
+      }
+    }
+
+    _Workspace_Free( old_name_hash );
+  }
+
+  return true;
+}
+
+void _Objects_Name_hash_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  Objects_Maximum *links;
+  Objects_Maximum *link;
+  uint32_t         hash;
+  uint32_t         index;
+
+  _Assert( information->name_hash != NULL );
+
+  if ( !_Objects_Name_hash_get_hash( information, the_object, &hash ) ) {
+    return;
+  }
+
+  links = _Objects_Name_hash_links( information );
+  link = &information->name_hash[
+    _Objects_Name_hash_bucket( hash, information->name_hash_order )
+  ];
+  index = _Objects_Get_index( the_object->id );
+
+  /*
+   *  Keep the bucket chain sorted by index, so that lookups find the same
+   *  object as a linear search of the local table.
+   */
+  while ( *link != 0 && *link < index ) {
+    link = &links[ *link ];
+  }
+
+  links[ index ] = *link;
+  *link = (Objects_Maximum) index;
+}
+
+void _Objects_Name_hash_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  Objects_Maximum *links;
+  Objects_Maximum *link;
+  uint32_t         hash;
+  uint32_t         index;
+
+  _Assert( information->name_hash != NULL );
+
+  if ( !_Objects_Name_hash_get_hash( information, the_object, &hash ) ) {
+    return;
+  }
+
+  links = _Objects_Name_hash_links( information );
+  link = &information->name_hash[
+    _Objects_Name_hash_bucket( hash, information->name_hash_order )
+  ];
+  index = _Objects_Get_index( the_object->id );
+
+  while ( *link != 0 ) {
+    if ( *link == index ) {
+      *link = links[ index ];
+      links[ index ] = 0;
+      break;
+    }
+
+    link = &links[ *link ];
+  }
+}
+
+Objects_Control *_Objects_Name_hash_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+)
+{
+  const Objects_Maximum *links;
+  uint32_t               index;
+
+  if ( information->name_hash == NULL ) {
+    return NULL;
+  }
+
+  links = _Objects_Name_hash_links( information );
+  index = information->name_hash[
+    _Objects_Name_hash_bucket( name, information->name_hash_order )
+  ];
+
+  while ( index != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Get_local_object( information, index );
+
+    if ( the_object != NULL && the_object->name.name_u32 == name ) {
+      return the_object;
+    }
+
+    index = links[ index ];
+  }
+
+  return NULL;
+}
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+Objects_Control *_Objects_Name_hash_find_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  const Objects_Maximum *links;
+  uint32_t               hash;
+  uint32_t               index;
+
+  if ( information->name_hash == NULL ) {
+    return NULL;
+  }
+
+  hash = _Objects_Name_hash_string( name, information->name_length );
+  links = _Objects_Name_hash_links( information );
+  index = information->name_hash[
+    _Objects_Name_hash_bucket( hash, information->name_hash_order )
+  ];
+
+  while ( index != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Get_local_object( information, index );
+
+    if (
+      the_object != NULL
+        && the_object->name.name_p != NULL
+        && strncmp( name, the_object->name.name_p, information->name_length )
+          == 0
+    ) {
+      return the_object;
+    }
+
+    index = links[ index ];
+  }
+
+  return NULL;
+}
+#endif
@@ -27,6 +27,10 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 )
 {
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_remove( information, the_object );
+  }
+
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     /*
      *  If this is a string format name, then free the memory.
@@ -51,9 +51,26 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
-  if ( search_local_node ) {
+  if ( search_local_node && information->has_name_hash ) {
+    /*
+     *  The name hash index may be reallocated by an extension, so it can
+     *  only be used by the owner of the allocator lock.
+     */
+    _Objects_Allocator_lock();
+    the_object = _Objects_Name_hash_find_u32( information, name );
+
+    if ( the_object != NULL ) {
+      *id = the_object->id;
+    }
+
+    _Objects_Allocator_unlock();
+
+    if ( the_object != NULL ) {
+      return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+    }
+  } else if ( search_local_node ) {
     for ( index = 1; index <= information->maximum; index++ ) {
-      the_object = information->local_table[ index ];
+      the_object = _Objects_Get_local_object( information, index );
       if ( !the_object )
         continue;
 
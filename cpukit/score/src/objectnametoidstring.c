@@ -53,10 +53,22 @@ Objects_Control *_Objects_Get_by_name(
     *name_length_p = name_length;
   }
 
+  if ( information->has_name_hash ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Name_hash_find_string( information, name );
+
+    if ( the_object == NULL ) {
+      *error = OBJECTS_GET_BY_NAME_NO_OBJECT;
+    }
+
+    return the_object;
+  }
+
   for ( index = 1; index <= information->maximum; index++ ) {
     Objects_Control *the_object;
 
-    the_object = information->local_table[ index ];
+    the_object = _Objects_Get_local_object( information, index );
 
     if ( the_object == NULL )
       continue;
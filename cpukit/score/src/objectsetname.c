@@ -35,13 +35,22 @@ bool _Objects_Set_name(
   s      = name;
   length = strnlen( name, information->name_length );
 
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_remove( information, the_object );
+  }
+
 #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
   if ( information->is_string ) {
     char *d;
 
     d = _Workspace_Allocate( length + 1 );
-    if ( !d )
+    if ( !d ) {
+      if ( information->name_hash != NULL ) {
+        _Objects_Name_hash_insert( information, the_object );
+      }
+
       return false;
+    }
 
     _Workspace_Free( (void *)the_object->name.name_p );
     the_object->name.name_p = NULL;
@@ -61,5 +70,9 @@ bool _Objects_Set_name(
 
   }
 
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_insert( information, the_object );
+  }
+
   return true;
 }
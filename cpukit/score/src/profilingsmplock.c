@@ -30,10 +30,14 @@ typedef struct {
 
 static SMP_lock_Stats_control _SMP_lock_Stats_control = {
   .Lock = {
+#if defined(RTEMS_SMP_MCS_LOCKS)
+    .MCS_lock = SMP_MCS_LOCK_INITIALIZER,
+#else
     .Ticket_lock = {
       .next_ticket = ATOMIC_INITIALIZER_UINT( 0U ),
       .now_serving = ATOMIC_INITIALIZER_UINT( 0U )
     },
+#endif
     .Stats = {
       .Node = CHAIN_NODE_INITIALIZER_ONE_NODE_CHAIN(
         &_SMP_lock_Stats_control.Stats_chain
@@ -164,4 +168,32 @@ void _SMP_lock_Stats_iteration_stop(
   _SMP_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
 }
 
+void _SMP_lock_Stats_reset( void )
+{
+  SMP_lock_Stats_control *control = &_SMP_lock_Stats_control;
+  SMP_lock_Context lock_context;
+  Chain_Node *node;
+  const Chain_Node *tail;
+
+  _SMP_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+
+  node = _Chain_First( &control->Stats_chain );
+  tail = _Chain_Immutable_tail( &control->Stats_chain );
+
+  while ( node != tail ) {
+    SMP_lock_Stats *stats = (SMP_lock_Stats *) node;
+
+    stats->max_acquire_time = 0;
+    stats->max_section_time = 0;
+    stats->usage_count = 0;
+    stats->total_acquire_time = 0;
+    memset( stats->contention_counts, 0, sizeof( stats->contention_counts ) );
+    stats->total_section_time = 0;
+
+    node = _Chain_Next( node );
+  }
+
+  _SMP_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+}
+
 #endif /* RTEMS_SMP && RTEMS_PROFILING */
@@ -0,0 +1,900 @@
+/**
+ * @file
+ *
+ * @brief Clustered EDF SMP Scheduler Implementation
+ *
+ * @ingroup ScoreSchedulerSMPEDFCluster
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/scheduleredfclustersmp.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static inline Scheduler_EDF_cluster_SMP_Context *
+_Scheduler_EDF_cluster_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_EDF_cluster_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static inline Scheduler_EDF_cluster_SMP_Context *
+_Scheduler_EDF_cluster_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_EDF_cluster_SMP_Context *) context;
+}
+
+static inline Scheduler_EDF_cluster_SMP_Node *
+_Scheduler_EDF_cluster_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_EDF_cluster_SMP_Node *) node;
+}
+
+static inline uint32_t _Scheduler_EDF_cluster_SMP_Cluster_of_processor(
+  const Scheduler_EDF_cluster_SMP_Context *self,
+  const Per_CPU_Control                   *cpu
+)
+{
+  return self->cluster_of_processor[ _Per_CPU_Get_index( cpu ) ];
+}
+
+/*
+ * Returns the cluster of the processor which is used by the node or which was
+ * used last by the node.
+ */
+static inline uint32_t _Scheduler_EDF_cluster_SMP_Cluster_of_node(
+  const Scheduler_EDF_cluster_SMP_Context *self,
+  Scheduler_Node                          *node
+)
+{
+  Thread_Control *user;
+
+  user = _Scheduler_Node_get_user( node );
+
+  return _Scheduler_EDF_cluster_SMP_Cluster_of_processor(
+    self,
+    _Thread_Get_CPU( user )
+  );
+}
+
+static inline RBTree_Control *_Scheduler_EDF_cluster_SMP_Ready_queue(
+  Scheduler_EDF_cluster_SMP_Context *self,
+  Scheduler_EDF_cluster_SMP_Node    *node
+)
+{
+  Scheduler_EDF_cluster_SMP_Cluster *cluster;
+
+  cluster = &self->Clusters[ node->cluster_index ];
+
+  if ( node->pinned ) {
+    return &cluster->Pinned;
+  }
+
+  return &cluster->Migratable;
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Less(
+  const void        *left,
+  const RBTree_Node *right
+)
+{
+  const Priority_Control   *the_left;
+  const Scheduler_SMP_Node *the_right;
+  Priority_Control          prio_left;
+  Priority_Control          prio_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, Scheduler_SMP_Node, Base.Node.RBTree );
+
+  prio_left = *the_left;
+  prio_right = the_right->priority;
+
+  return prio_left < prio_right;
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Less_or_equal(
+  const void        *left,
+  const RBTree_Node *right
+)
+{
+  const Priority_Control   *the_left;
+  const Scheduler_SMP_Node *the_right;
+  Priority_Control          prio_left;
+  Priority_Control          prio_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, Scheduler_SMP_Node, Base.Node.RBTree );
+
+  prio_left = *the_left;
+  prio_right = the_right->priority;
+
+  return prio_left <= prio_right;
+}
+
+void _Scheduler_EDF_cluster_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self =
+    _Scheduler_EDF_cluster_SMP_Get_context( scheduler );
+
+  _Assert( self->cluster_size > 0 );
+  _Scheduler_SMP_Initialize( &self->Base );
+  /* The clusters are zero initialized and thus empty */
+}
+
+void _Scheduler_EDF_cluster_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_EDF_cluster_SMP_Node *the_node;
+
+  the_node = _Scheduler_EDF_cluster_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+  the_node->cluster_index = 0;
+  the_node->pinned = false;
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *smp_node;
+
+  (void) context;
+
+  smp_node = _Scheduler_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  uint32_t                           i;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+
+  for ( i = 0; i < self->cluster_count; ++i ) {
+    const Scheduler_EDF_cluster_SMP_Cluster *cluster;
+
+    cluster = &self->Clusters[ i ];
+
+    if (
+      !_RBTree_Is_empty( &cluster->Pinned )
+        || !_RBTree_Is_empty( &cluster->Migratable )
+    ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Overall_less(
+  const Scheduler_EDF_cluster_SMP_Node *left,
+  const Scheduler_EDF_cluster_SMP_Node *right
+)
+{
+  Priority_Control lp;
+  Priority_Control rp;
+
+  lp = left->Base.priority;
+  rp = right->Base.priority;
+
+  return lp < rp || (lp == rp && left->generation < right->generation );
+}
+
+static inline Scheduler_EDF_cluster_SMP_Node *
+_Scheduler_EDF_cluster_SMP_Challenge_highest_ready(
+  Scheduler_EDF_cluster_SMP_Node *highest_ready,
+  RBTree_Control                 *ready_queue
+)
+{
+  Scheduler_EDF_cluster_SMP_Node *other;
+
+  other = (Scheduler_EDF_cluster_SMP_Node *) _RBTree_Minimum( ready_queue );
+
+  if (
+    other != NULL
+      && (
+        highest_ready == NULL
+          || _Scheduler_EDF_cluster_SMP_Overall_less( other, highest_ready )
+      )
+  ) {
+    return other;
+  }
+
+  return highest_ready;
+}
+
+/*
+ * The filter node is a scheduled node which is about to leave its processor or
+ * is no longer on the scheduled chain.  Select the highest priority node which
+ * may use this processor.  These are the nodes pinned to the cluster of the
+ * processor and all migratable nodes.  The migratable nodes of other clusters
+ * are pulled to this processor.
+ */
+static inline Scheduler_Node *_Scheduler_EDF_cluster_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  Scheduler_EDF_cluster_SMP_Node    *highest_ready;
+  uint32_t                           cluster_index;
+  uint32_t                           i;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  cluster_index = _Scheduler_EDF_cluster_SMP_Cluster_of_node( self, filter );
+  highest_ready = NULL;
+
+  for ( i = 0; i < self->cluster_count; ++i ) {
+    Scheduler_EDF_cluster_SMP_Cluster *cluster;
+
+    cluster = &self->Clusters[ i ];
+
+    if ( i == cluster_index ) {
+      highest_ready = _Scheduler_EDF_cluster_SMP_Challenge_highest_ready(
+        highest_ready,
+        &cluster->Pinned
+      );
+    }
+
+    highest_ready = _Scheduler_EDF_cluster_SMP_Challenge_highest_ready(
+      highest_ready,
+      &cluster->Migratable
+    );
+  }
+
+  _Assert( highest_ready != NULL );
+  return &highest_ready->Base.Base;
+}
+
+/*
+ * A pinned node may only replace a node scheduled in its cluster.  A
+ * migratable node replaces the lowest priority scheduled node and prefers the
+ * cluster of its last processor in case of equal priorities, e.g. for idle
+ * processors.
+ */
+static inline Scheduler_Node *_Scheduler_EDF_cluster_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  Scheduler_EDF_cluster_SMP_Node    *filter;
+  Chain_Control                     *scheduled;
+  const Chain_Node                  *head;
+  Scheduler_Node                    *lowest_scheduled;
+  Chain_Node                        *chain_node;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  filter = _Scheduler_EDF_cluster_SMP_Node_downcast( filter_base );
+  scheduled = &self->Base.Scheduled;
+  head = _Chain_Immutable_head( scheduled );
+  lowest_scheduled = (Scheduler_Node *) _Chain_Last( scheduled );
+
+  _Assert( &lowest_scheduled->Node.Chain != _Chain_Tail( scheduled ) );
+
+  if ( filter->pinned ) {
+    /*
+     * Each processor of the cluster has a scheduled node, see
+     * _Scheduler_EDF_cluster_SMP_Enqueue_ordered().
+     */
+    _Assert( self->Clusters[ filter->cluster_index ].processor_count > 0 );
+    chain_node = &lowest_scheduled->Node.Chain;
+
+    while ( chain_node != head ) {
+      Scheduler_Node *node;
+
+      node = (Scheduler_Node *) chain_node;
+
+      if (
+        _Scheduler_EDF_cluster_SMP_Cluster_of_node( self, node )
+          == filter->cluster_index
+      ) {
+        return node;
+      }
+
+      chain_node = _Chain_Previous( chain_node );
+    }
+  } else {
+    Priority_Control lowest_priority;
+    uint32_t         cluster_index;
+
+    lowest_priority = _Scheduler_SMP_Node_priority( lowest_scheduled );
+    cluster_index = _Scheduler_EDF_cluster_SMP_Cluster_of_node(
+      self,
+      filter_base
+    );
+    chain_node = &lowest_scheduled->Node.Chain;
+
+    while ( chain_node != head ) {
+      Scheduler_Node *node;
+
+      node = (Scheduler_Node *) chain_node;
+
+      if ( _Scheduler_SMP_Node_priority( node ) != lowest_priority ) {
+        break;
+      }
+
+      if (
+        _Scheduler_EDF_cluster_SMP_Cluster_of_node( self, node )
+          == cluster_index
+      ) {
+        return node;
+      }
+
+      chain_node = _Chain_Previous( chain_node );
+    }
+  }
+
+  return lowest_scheduled;
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  size_t             generation_index,
+  int                increment,
+  bool            ( *less )( const void *, const RBTree_Node * )
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  Scheduler_EDF_cluster_SMP_Node    *node;
+  int64_t                            generation;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  node = _Scheduler_EDF_cluster_SMP_Node_downcast( node_base );
+
+  if ( !node->pinned ) {
+    node->cluster_index =
+      _Scheduler_EDF_cluster_SMP_Cluster_of_node( self, node_base );
+  }
+
+  generation = self->generations[ generation_index ];
+  node->generation = generation;
+  self->generations[ generation_index ] = generation + increment;
+
+  _RBTree_Initialize_node( &node->Base.Base.Node.RBTree );
+  _RBTree_Insert_inline(
+    _Scheduler_EDF_cluster_SMP_Ready_queue( self, node ),
+    &node->Base.Base.Node.RBTree,
+    &node->Base.priority,
+    less
+  );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  Scheduler_EDF_cluster_SMP_Node    *node;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  node = _Scheduler_EDF_cluster_SMP_Node_downcast( node_to_extract );
+
+  _RBTree_Extract(
+    _Scheduler_EDF_cluster_SMP_Ready_queue( self, node ),
+    &node->Base.Base.Node.RBTree
+  );
+  _Chain_Initialize_node( &node->Base.Base.Node.Chain );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node.Chain );
+  _Scheduler_EDF_cluster_SMP_Insert_ready(
+    context,
+    scheduled_to_ready,
+    0,
+    1,
+    _Scheduler_EDF_cluster_SMP_Less
+  );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  _Scheduler_EDF_cluster_SMP_Extract_from_ready( context, ready_to_scheduled );
+  _Scheduler_SMP_Insert_scheduled_fifo( context, ready_to_scheduled );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Insert_ready_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  _Scheduler_EDF_cluster_SMP_Insert_ready(
+    context,
+    node_to_insert,
+    1,
+    -1,
+    _Scheduler_EDF_cluster_SMP_Less_or_equal
+  );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Insert_ready_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  _Scheduler_EDF_cluster_SMP_Insert_ready(
+    context,
+    node_to_insert,
+    0,
+    1,
+    _Scheduler_EDF_cluster_SMP_Less
+  );
+}
+
+void _Scheduler_EDF_cluster_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Get_highest_ready,
+    _Scheduler_EDF_cluster_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  Scheduler_EDF_cluster_SMP_Node    *the_node;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  the_node = _Scheduler_EDF_cluster_SMP_Node_downcast( node );
+
+  /* A node pinned to a cluster without processors cannot be scheduled */
+  if (
+    the_node->pinned
+      && self->Clusters[ the_node->cluster_index ].processor_count == 0
+  ) {
+    ( *insert_ready )( context, node );
+    return true;
+  }
+
+  return _Scheduler_SMP_Enqueue_ordered(
+    context,
+    node,
+    order,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_EDF_cluster_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_EDF_cluster_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_EDF_cluster_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_EDF_cluster_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_EDF_cluster_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_EDF_cluster_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_ordered(
+  Scheduler_Context *context,
+  Scheduler_Node *node,
+  Chain_Node_order order,
+  Scheduler_SMP_Insert insert_ready,
+  Scheduler_SMP_Insert insert_scheduled
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Get_highest_ready,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_EDF_cluster_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_EDF_cluster_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_EDF_cluster_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+void _Scheduler_EDF_cluster_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_cluster_SMP_Do_update,
+    _Scheduler_EDF_cluster_SMP_Enqueue_fifo
+  );
+}
+
+static inline bool _Scheduler_EDF_cluster_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_EDF_cluster_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo,
+    _Scheduler_EDF_cluster_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_EDF_cluster_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_EDF_cluster_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Do_update,
+    _Scheduler_EDF_cluster_SMP_Enqueue_fifo,
+    _Scheduler_EDF_cluster_SMP_Enqueue_lifo,
+    _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_lifo,
+    _Scheduler_EDF_cluster_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_EDF_cluster_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_EDF_cluster_SMP_Do_ask_for_help( context, the_thread, node );
+}
+
+void _Scheduler_EDF_cluster_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_EDF_cluster_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Get_highest_ready,
+    _Scheduler_EDF_cluster_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static inline void _Scheduler_EDF_cluster_SMP_Register_idle(
+  Scheduler_Context *context,
+  Scheduler_Node    *idle,
+  Per_CPU_Control   *cpu
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  uint32_t                           cluster_index;
+
+  (void) idle;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_self( context );
+  cluster_index = 0;
+
+  while (
+    self->Clusters[ cluster_index ].processor_count >= self->cluster_size
+  ) {
+    ++cluster_index;
+    _Assert( cluster_index < self->cluster_count );
+  }
+
+  self->cluster_of_processor[ _Per_CPU_Get_index( cpu ) ] = cluster_index;
+  ++self->Clusters[ cluster_index ].processor_count;
+}
+
+/*
+ * Returns the processors of the scheduler instance which belong to the
+ * cluster.
+ */
+static void _Scheduler_EDF_cluster_SMP_Get_cluster_processors(
+  const Scheduler_EDF_cluster_SMP_Context *self,
+  uint32_t                                 cluster_index,
+  Processor_mask                          *cluster
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  _Processor_mask_Zero( cluster );
+  cpu_max = _SMP_Get_processor_count();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if (
+      _Processor_mask_Is_set( &self->Base.Base.Processors, cpu_index )
+        && self->cluster_of_processor[ cpu_index ] == cluster_index
+    ) {
+      _Processor_mask_Set( cluster, cpu_index );
+    }
+  }
+}
+
+void _Scheduler_EDF_cluster_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_EDF_cluster_SMP_Has_ready,
+    _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_EDF_cluster_SMP_Register_idle
+  );
+}
+
+Thread_Control *_Scheduler_EDF_cluster_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_EDF_cluster_SMP_Context *self;
+  uint32_t                           cluster_index;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_context( scheduler );
+  cluster_index = _Scheduler_EDF_cluster_SMP_Cluster_of_processor( self, cpu );
+  _Assert( self->Clusters[ cluster_index ].processor_count > 0 );
+  --self->Clusters[ cluster_index ].processor_count;
+
+  return _Scheduler_SMP_Remove_processor(
+    &self->Base.Base,
+    cpu,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Enqueue_fifo
+  );
+}
+
+void _Scheduler_EDF_cluster_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Enqueue_fifo,
+    _Scheduler_EDF_cluster_SMP_Enqueue_scheduled_fifo
+  );
+}
+
+typedef struct {
+  uint32_t cluster_index;
+  bool     pinned;
+} Scheduler_EDF_cluster_SMP_Affinity;
+
+static inline void _Scheduler_EDF_cluster_SMP_Do_set_affinity(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  void              *arg
+)
+{
+  Scheduler_EDF_cluster_SMP_Node           *node;
+  const Scheduler_EDF_cluster_SMP_Affinity *affinity;
+
+  (void) context;
+
+  node = _Scheduler_EDF_cluster_SMP_Node_downcast( node_base );
+  affinity = arg;
+  node->cluster_index = affinity->cluster_index;
+  node->pinned = affinity->pinned;
+}
+
+void _Scheduler_EDF_cluster_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context;
+
+  context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Do_start_idle(
+    context,
+    idle,
+    cpu,
+    _Scheduler_EDF_cluster_SMP_Register_idle
+  );
+}
+
+bool _Scheduler_EDF_cluster_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_EDF_cluster_SMP_Context  *self;
+  Processor_mask                      a;
+  Scheduler_EDF_cluster_SMP_Affinity  arg;
+
+  self = _Scheduler_EDF_cluster_SMP_Get_context( scheduler );
+  _Processor_mask_And( &a, &self->Base.Base.Processors, affinity );
+
+  if ( _Processor_mask_Is_zero( &a ) ) {
+    return false;
+  }
+
+  if ( _Processor_mask_Is_equal( &a, &self->Base.Base.Processors ) ) {
+    arg.cluster_index = 0;
+    arg.pinned = false;
+  } else {
+    Processor_mask cluster;
+    uint32_t       cpu_index;
+
+    /* The last set bit is one plus the processor index */
+    cpu_index = _Processor_mask_Find_last_set( &a ) - 1;
+    arg.cluster_index = self->cluster_of_processor[ cpu_index ];
+    arg.pinned = true;
+
+    /*
+     * The affinity granularity is the cluster.  Reject a part of a cluster
+     * and processors of several clusters.
+     */
+    _Scheduler_EDF_cluster_SMP_Get_cluster_processors(
+      self,
+      arg.cluster_index,
+      &cluster
+    );
+
+    if ( !_Processor_mask_Is_equal( &cluster, &a ) ) {
+      return false;
+    }
+  }
+
+  _Scheduler_SMP_Set_affinity(
+    &self->Base.Base,
+    thread,
+    node,
+    &arg,
+    _Scheduler_EDF_cluster_SMP_Do_set_affinity,
+    _Scheduler_EDF_cluster_SMP_Extract_from_ready,
+    _Scheduler_EDF_cluster_SMP_Get_highest_ready,
+    _Scheduler_EDF_cluster_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_EDF_cluster_SMP_Enqueue_fifo,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+
+  return true;
+}
@@ -0,0 +1,687 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerPriorityLocalSMP
+ *
+ * @brief Deterministic Priority SMP Scheduler with Per-Processor Ready
+ * Queues Implementation
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/schedulerprioritylocalsmp.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static Scheduler_priority_local_SMP_Context *
+_Scheduler_priority_local_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_priority_local_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static inline Scheduler_priority_local_SMP_Context *
+_Scheduler_priority_local_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_priority_local_SMP_Context *) context;
+}
+
+static inline Scheduler_priority_local_SMP_Node *
+_Scheduler_priority_local_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_priority_local_SMP_Node *) node;
+}
+
+static inline uint32_t _Scheduler_priority_local_SMP_Processor_of_node(
+  Scheduler_Node *node
+)
+{
+  return _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+void _Scheduler_priority_local_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_priority_local_SMP_Context *self;
+  size_t                                priority_count;
+  uint32_t                              i;
+
+  self = _Scheduler_priority_local_SMP_Get_context( scheduler );
+  priority_count = (size_t) scheduler->maximum_priority + 1;
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  _Priority_bit_map_Initialize( &self->Bit_map );
+
+  for ( i = 0; i < priority_count; ++i ) {
+    _Processor_mask_Zero( &self->Ready_queues_of_priority[ i ] );
+  }
+
+  for ( i = 0; i < self->ready_queue_count; ++i ) {
+    Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+    ready_queue = &self->Ready_queues[ i ];
+    ready_queue->Ready = &self->Ready[ i * priority_count ];
+    _Priority_bit_map_Initialize( &ready_queue->Bit_map );
+    _Scheduler_priority_Ready_queue_initialize(
+      ready_queue->Ready,
+      scheduler->maximum_priority
+    );
+  }
+}
+
+void _Scheduler_priority_local_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Node        *the_node;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+  the_node = _Scheduler_priority_local_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+
+  self = _Scheduler_priority_local_SMP_Get_context( scheduler );
+  ready_queue = &self->Ready_queues[ 0 ];
+  the_node->ready_queue_index = 0;
+  _Scheduler_priority_Ready_queue_update(
+    &the_node->Ready_queue,
+    priority,
+    &ready_queue->Bit_map,
+    ready_queue->Ready
+  );
+  _Priority_bit_map_Initialize_information(
+    &self->Bit_map,
+    &the_node->Summary_map,
+    (unsigned int) priority
+  );
+}
+
+static inline bool _Scheduler_priority_local_SMP_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_priority_local_SMP_Context *self;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+
+  return !_Priority_bit_map_Is_empty( &self->Bit_map );
+}
+
+/*
+ * The summary bit map yields the highest ready priority.  The ready queue of
+ * the processor used by the filter node is used if it contains a node of
+ * this priority, so that threads tend to stay on their processor.  Otherwise,
+ * a ready queue with a node of this priority is taken from the set of ready
+ * queues of this priority.
+ */
+static Scheduler_Node *_Scheduler_priority_local_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+  unsigned int                              highest_priority;
+  uint32_t                                  index;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+  _Assert( !_Priority_bit_map_Is_empty( &self->Bit_map ) );
+  highest_priority = _Priority_bit_map_Get_highest( &self->Bit_map );
+  index = _Scheduler_priority_local_SMP_Processor_of_node( filter );
+  _Assert( index < self->ready_queue_count );
+  ready_queue = &self->Ready_queues[ index ];
+
+  if ( _Chain_Is_empty( &ready_queue->Ready[ highest_priority ] ) ) {
+    index = _Processor_mask_Find_last_set(
+      &self->Ready_queues_of_priority[ highest_priority ]
+    );
+    _Assert( index > 0 && index <= self->ready_queue_count );
+    ready_queue = &self->Ready_queues[ index - 1 ];
+  }
+
+  return (Scheduler_Node *)
+    _Chain_First( &ready_queue->Ready[ highest_priority ] );
+}
+
+/*
+ * This is _Scheduler_SMP_Get_lowest_scheduled() with a preference for the
+ * processor used last by the filter node in case several scheduled nodes
+ * have the lowest priority, e.g. idle threads.
+ */
+static inline Scheduler_Node *
+_Scheduler_priority_local_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_SMP_Context *self;
+  Chain_Control         *scheduled;
+  const Chain_Node      *head;
+  Scheduler_Node        *lowest_scheduled;
+  Chain_Node            *chain_node;
+  Priority_Control       lowest_priority;
+  Per_CPU_Control       *cpu;
+
+  self = _Scheduler_SMP_Get_self( context );
+  scheduled = &self->Scheduled;
+  head = _Chain_Immutable_head( scheduled );
+  lowest_scheduled = (Scheduler_Node *) _Chain_Last( scheduled );
+
+  _Assert( &lowest_scheduled->Node.Chain != _Chain_Tail( scheduled ) );
+
+  lowest_priority = _Scheduler_SMP_Node_priority( lowest_scheduled );
+  cpu = _Thread_Get_CPU( _Scheduler_Node_get_user( filter ) );
+  chain_node = &lowest_scheduled->Node.Chain;
+
+  while ( chain_node != head ) {
+    Scheduler_Node *node;
+
+    node = (Scheduler_Node *) chain_node;
+
+    if ( _Scheduler_SMP_Node_priority( node ) != lowest_priority ) {
+      break;
+    }
+
+    if ( _Thread_Get_CPU( _Scheduler_Node_get_user( node ) ) == cpu ) {
+      return node;
+    }
+
+    chain_node = _Chain_Previous( chain_node );
+  }
+
+  return lowest_scheduled;
+}
+
+static inline Scheduler_priority_local_SMP_Ready_queue *
+_Scheduler_priority_local_SMP_Ready_queue_of_node(
+  Scheduler_priority_local_SMP_Context *self,
+  Scheduler_priority_local_SMP_Node    *node
+)
+{
+  return &self->Ready_queues[ node->ready_queue_index ];
+}
+
+/*
+ * Selects the ready queue of the processor used last by the node.  The ready
+ * chain and bit map information of the node must be updated accordingly.
+ */
+static inline Scheduler_priority_local_SMP_Ready_queue *
+_Scheduler_priority_local_SMP_Select_ready_queue(
+  Scheduler_priority_local_SMP_Context *self,
+  Scheduler_priority_local_SMP_Node    *node
+)
+{
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+  uint32_t                                  index;
+
+  index = _Scheduler_priority_local_SMP_Processor_of_node( &node->Base.Base );
+  _Assert( index < self->ready_queue_count );
+  node->ready_queue_index = index;
+  ready_queue = &self->Ready_queues[ index ];
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    node->Base.priority,
+    &ready_queue->Bit_map,
+    ready_queue->Ready
+  );
+  _Priority_bit_map_Initialize_information(
+    &self->Bit_map,
+    &node->Summary_map,
+    node->Ready_queue.current_priority
+  );
+
+  return ready_queue;
+}
+
+/*
+ * Must be called after the node was inserted into its ready chain.  The
+ * summary changes only if the ready chain was empty before.
+ */
+static inline void _Scheduler_priority_local_SMP_Summary_add(
+  Scheduler_priority_local_SMP_Context *self,
+  Scheduler_priority_local_SMP_Node    *node
+)
+{
+  if ( _Chain_Has_only_one_node( node->Ready_queue.ready_chain ) ) {
+    _Processor_mask_Set(
+      &self->Ready_queues_of_priority[ node->Ready_queue.current_priority ],
+      node->ready_queue_index
+    );
+    _Priority_bit_map_Add( &self->Bit_map, &node->Summary_map );
+  }
+}
+
+/*
+ * Must be called after the node was extracted from its ready chain.  The
+ * summary changes only if the ready chain is empty now.
+ */
+static inline void _Scheduler_priority_local_SMP_Summary_remove(
+  Scheduler_priority_local_SMP_Context *self,
+  Scheduler_priority_local_SMP_Node    *node
+)
+{
+  if ( _Chain_Is_empty( node->Ready_queue.ready_chain ) ) {
+    Processor_mask *ready_queues;
+
+    ready_queues =
+      &self->Ready_queues_of_priority[ node->Ready_queue.current_priority ];
+    _Processor_mask_Clear( ready_queues, node->ready_queue_index );
+
+    if ( _Processor_mask_Is_zero( ready_queues ) ) {
+      _Priority_bit_map_Remove( &self->Bit_map, &node->Summary_map );
+    }
+  }
+}
+
+static inline void _Scheduler_priority_local_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Node        *node;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+  node = _Scheduler_priority_local_SMP_Node_downcast( scheduled_to_ready );
+
+  _Chain_Extract_unprotected( &node->Base.Base.Node.Chain );
+  ready_queue = _Scheduler_priority_local_SMP_Select_ready_queue( self, node );
+  _Scheduler_priority_Ready_queue_enqueue_first(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &ready_queue->Bit_map
+  );
+  _Scheduler_priority_local_SMP_Summary_add( self, node );
+}
+
+static inline void _Scheduler_priority_local_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *thread
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Node        *node;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+  node = _Scheduler_priority_local_SMP_Node_downcast( thread );
+  ready_queue = _Scheduler_priority_local_SMP_Ready_queue_of_node( self, node );
+
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &ready_queue->Bit_map
+  );
+  _Scheduler_priority_local_SMP_Summary_remove( self, node );
+}
+
+static inline void _Scheduler_priority_local_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Priority_Control priority;
+
+  _Scheduler_priority_local_SMP_Extract_from_ready(
+    context,
+    ready_to_scheduled
+  );
+  priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  _Chain_Insert_ordered_unprotected(
+    &_Scheduler_SMP_Get_self( context )->Scheduled,
+    &ready_to_scheduled->Node.Chain,
+    &priority,
+    _Scheduler_SMP_Insert_priority_fifo_order
+  );
+}
+
+static inline void _Scheduler_priority_local_SMP_Insert_ready_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *thread
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Node        *node;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+  node = _Scheduler_priority_local_SMP_Node_downcast( thread );
+  ready_queue = _Scheduler_priority_local_SMP_Select_ready_queue( self, node );
+
+  _Scheduler_priority_Ready_queue_enqueue(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &ready_queue->Bit_map
+  );
+  _Scheduler_priority_local_SMP_Summary_add( self, node );
+}
+
+static inline void _Scheduler_priority_local_SMP_Insert_ready_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *thread
+)
+{
+  Scheduler_priority_local_SMP_Context     *self;
+  Scheduler_priority_local_SMP_Node        *node;
+  Scheduler_priority_local_SMP_Ready_queue *ready_queue;
+
+  self = _Scheduler_priority_local_SMP_Get_self( context );
+  node = _Scheduler_priority_local_SMP_Node_downcast( thread );
+  ready_queue = _Scheduler_priority_local_SMP_Select_ready_queue( self, node );
+
+  _Scheduler_priority_Ready_queue_enqueue_first(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &ready_queue->Bit_map
+  );
+  _Scheduler_priority_local_SMP_Summary_add( self, node );
+}
+
+/*
+ * The node is not in a ready queue, the ready chain and bit map information
+ * is updated once the node is inserted into a ready queue.
+ */
+static inline void _Scheduler_priority_local_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *node;
+
+  (void) context;
+
+  node = _Scheduler_SMP_Node_downcast( node_to_update );
+  _Scheduler_SMP_Node_update_priority( node, new_priority );
+}
+
+void _Scheduler_priority_local_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Get_highest_ready,
+    _Scheduler_priority_local_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  return _Scheduler_SMP_Enqueue_ordered(
+    context,
+    node,
+    order,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_priority_local_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_priority_local_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_priority_local_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_priority_local_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_priority_local_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_priority_local_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_scheduled_ordered(
+  Scheduler_Context *context,
+  Scheduler_Node *node,
+  Chain_Node_order order,
+  Scheduler_SMP_Insert insert_ready,
+  Scheduler_SMP_Insert insert_scheduled
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Get_highest_ready,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_priority_local_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_priority_local_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_priority_local_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Enqueue_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_priority_local_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_priority_local_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+void _Scheduler_priority_local_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_local_SMP_Do_update,
+    _Scheduler_priority_local_SMP_Enqueue_fifo
+  );
+}
+
+static bool _Scheduler_priority_local_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_priority_local_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo,
+    _Scheduler_priority_local_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_priority_local_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy
+  );
+}
+
+void _Scheduler_priority_local_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Do_update,
+    _Scheduler_priority_local_SMP_Enqueue_fifo,
+    _Scheduler_priority_local_SMP_Enqueue_lifo,
+    _Scheduler_priority_local_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_priority_local_SMP_Enqueue_scheduled_lifo,
+    _Scheduler_priority_local_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_priority_local_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_priority_local_SMP_Do_ask_for_help( context, the_thread, node );
+}
+
+void _Scheduler_priority_local_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_priority_local_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_priority_local_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Get_highest_ready,
+    _Scheduler_priority_local_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy
+  );
+}
+
+void _Scheduler_priority_local_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_priority_local_SMP_Has_ready,
+    _Scheduler_priority_local_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_SMP_Do_nothing_register_idle
+  );
+}
+
+Thread_Control *_Scheduler_priority_local_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Enqueue_fifo
+  );
+}
+
+void _Scheduler_priority_local_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_local_SMP_Extract_from_ready,
+    _Scheduler_priority_local_SMP_Enqueue_fifo,
+    _Scheduler_priority_local_SMP_Enqueue_scheduled_fifo
+  );
+}
@@ -11,57 +11,44 @@
 #endif
 
 #include <rtems/score/smpimpl.h>
-#include <rtems/score/smplock.h>
-#include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlock.h>
 #include <rtems/score/sysstate.h>
 
-typedef struct {
-  Chain_Node          Node;
-  SMP_Action_handler  handler;
-  void               *arg;
-  Processor_mask      targets;
-  Atomic_Ulong        done;
-} SMP_Multicast_action;
-
-typedef struct {
-  SMP_lock_Control Lock;
-  Chain_Control    Actions;
-} SMP_Multicast_context;
-
-static SMP_Multicast_context _SMP_Multicast = {
-  .Lock = SMP_LOCK_INITIALIZER( "SMP Multicast Action" ),
-  .Actions = CHAIN_INITIALIZER_EMPTY( _SMP_Multicast.Actions )
-};
+/*
+ * The jobs of a multicast action are provided by the caller in chunks of this
+ * count.  This bounds the stack usage independent of CPU_MAXIMUM_PROCESSORS.
+ */
+#define SMP_MULTICAST_ACTION_JOBS 8
 
 void _SMP_Multicast_actions_process( void )
 {
-  SMP_lock_Context      lock_context;
-  uint32_t              cpu_self_index;
-  SMP_Multicast_action *node;
-  SMP_Multicast_action *next;
+  Per_CPU_Control   *cpu_self;
+  ISR_lock_Context   lock_context;
+  SMP_Multicast_job *job;
 
-  _SMP_lock_ISR_disable_and_acquire( &_SMP_Multicast.Lock, &lock_context );
-  cpu_self_index = _SMP_Get_current_processor();
-  node = (SMP_Multicast_action *) _Chain_First( &_SMP_Multicast.Actions );
+  cpu_self = _Per_CPU_Get();
 
-  while ( !_Chain_Is_tail( &_SMP_Multicast.Actions, &node->Node ) ) {
-    next = (SMP_Multicast_action *) _Chain_Next( &node->Node );
+  _ISR_lock_ISR_disable_and_acquire( &cpu_self->Multicast.Lock, &lock_context );
+  job = cpu_self->Multicast.head;
+  cpu_self->Multicast.head = NULL;
+  _ISR_lock_Release_and_ISR_enable( &cpu_self->Multicast.Lock, &lock_context );
 
-    if ( _Processor_mask_Is_set( &node->targets, cpu_self_index ) ) {
-      _Processor_mask_Clear( &node->targets, cpu_self_index );
+  while ( job != NULL ) {
+    SMP_Multicast_job   *next;
+    SMP_Multicast_batch *batch;
 
-      ( *node->handler )( node->arg );
+    /*
+     * The job storage may be reused after the decrement of the pending jobs
+     * count, so fetch everything we need before.
+     */
+    next = job->next;
+    batch = job->batch;
 
-      if ( _Processor_mask_Is_zero( &node->targets ) ) {
-        _Chain_Extract_unprotected( &node->Node );
-        _Atomic_Store_ulong( &node->done, 1, ATOMIC_ORDER_RELEASE );
-      }
-    }
+    ( *job->handler )( job->arg );
 
-    node = next;
+    _Atomic_Fetch_sub_ulong( &batch->pending, 1, ATOMIC_ORDER_RELEASE );
+    job = next;
   }
-
-  _SMP_lock_Release_and_ISR_enable( &_SMP_Multicast.Lock, &lock_context );
 }
 
 static void
@@ -88,6 +75,64 @@ _SMP_Multicasts_try_process( void )
   _ISR_Local_enable( isr_level );
 }
 
+void _SMP_Multicast_batch_initialize( SMP_Multicast_batch *batch )
+{
+  _Processor_mask_Zero( &batch->targets );
+  _Atomic_Init_ulong( &batch->pending, 0 );
+}
+
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch *batch,
+  SMP_Multicast_job   *job,
+  uint32_t             cpu_index,
+  SMP_Action_handler   handler,
+  void                *arg
+)
+{
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+
+  if ( !_System_state_Is_up( _System_state_Get() ) ) {
+    ( *handler )( arg );
+    return;
+  }
+
+  job->next = NULL;
+  job->handler = handler;
+  job->arg = arg;
+  job->batch = batch;
+
+  _Atomic_Fetch_add_ulong( &batch->pending, 1, ATOMIC_ORDER_RELAXED );
+  _Processor_mask_Set( &batch->targets, cpu_index );
+
+  cpu = _Per_CPU_Get_by_index( cpu_index );
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Multicast.Lock, &lock_context );
+
+  if ( cpu->Multicast.head == NULL ) {
+    cpu->Multicast.head = job;
+  } else {
+    cpu->Multicast.tail->next = job;
+  }
+
+  cpu->Multicast.tail = job;
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Multicast.Lock, &lock_context );
+}
+
+void _SMP_Multicast_batch_issue( SMP_Multicast_batch *batch )
+{
+  _SMP_Send_message_multicast( &batch->targets, SMP_MESSAGE_MULTICAST_ACTION );
+  _Processor_mask_Zero( &batch->targets );
+}
+
+void _SMP_Multicast_batch_wait( SMP_Multicast_batch *batch )
+{
+  while ( !_SMP_Multicast_batch_is_done( batch ) ) {
+    _SMP_Multicasts_try_process();
+  }
+}
+
 void _SMP_Multicast_action(
   const size_t setsize,
   const cpu_set_t *cpus,
@@ -95,42 +140,42 @@ void _SMP_Multicast_action(
   void *arg
 )
 {
-  SMP_Multicast_action node;
-  Processor_mask       targets;
-  SMP_lock_Context     lock_context;
-  uint32_t             i;
+  SMP_Multicast_job   jobs[ SMP_MULTICAST_ACTION_JOBS ];
+  SMP_Multicast_batch batch;
+  uint32_t            cpu_count;
+  uint32_t            job_count;
+  uint32_t            i;
 
   if ( ! _System_state_Is_up( _System_state_Get() ) ) {
     ( *handler )( arg );
     return;
   }
 
-  if( cpus == NULL ) {
-    _Processor_mask_Assign( &targets, _SMP_Get_online_processors() );
-  } else {
-    _Processor_mask_Zero( &targets );
+  _SMP_Multicast_batch_initialize( &batch );
+  cpu_count = _SMP_Get_processor_count();
+  job_count = 0;
 
-    for ( i = 0; i < _SMP_Get_processor_count(); ++i ) {
-      if ( CPU_ISSET_S( i, setsize, cpus ) ) {
-        _Processor_mask_Set( &targets, i );
-      }
-    }
-  }
+  for ( i = 0; i < cpu_count; ++i ) {
+    bool is_target;
 
-  _Chain_Initialize_node( &node.Node );
-  node.handler = handler;
-  node.arg = arg;
-  _Processor_mask_Assign( &node.targets, &targets );
-  _Atomic_Store_ulong( &node.done, 0, ATOMIC_ORDER_RELAXED );
+    if ( cpus == NULL ) {
+      is_target = _Processor_mask_Is_set( _SMP_Get_online_processors(), i );
+    } else {
+      is_target = CPU_ISSET_S( i, setsize, cpus );
+    }
 
-  _SMP_lock_ISR_disable_and_acquire( &_SMP_Multicast.Lock, &lock_context );
-  _Chain_Prepend_unprotected( &_SMP_Multicast.Actions, &node.Node );
-  _SMP_lock_Release_and_ISR_enable( &_SMP_Multicast.Lock, &lock_context );
+    if ( is_target ) {
+      if ( job_count == RTEMS_ARRAY_SIZE( jobs ) ) {
+        _SMP_Multicast_batch_issue( &batch );
+        _SMP_Multicast_batch_wait( &batch );
+        job_count = 0;
+      }
 
-  _SMP_Send_message_multicast( &targets, SMP_MESSAGE_MULTICAST_ACTION );
-  _SMP_Multicasts_try_process();
+      _SMP_Multicast_batch_add( &batch, &jobs[ job_count ], i, handler, arg );
+      ++job_count;
+    }
+  }
 
-  while ( _Atomic_Load_ulong( &node.done, ATOMIC_ORDER_ACQUIRE ) == 0 ) {
-    /* Wait */
-  };
+  _SMP_Multicast_batch_issue( &batch );
+  _SMP_Multicast_batch_wait( &batch );
 }
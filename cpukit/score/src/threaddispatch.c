@@ -27,6 +27,7 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
 #include <rtems/score/userextimpl.h>
+#include <rtems/score/watchdogimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/config.h>
 
@@ -210,6 +211,10 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
     if ( heir->budget_algorithm == THREAD_CPU_BUDGET_ALGORITHM_RESET_TIMESLICE )
       heir->cpu_time_budget = rtems_configuration_get_ticks_per_timeslice();
 
+    if ( cpu_self->Watchdog.next_tick != 0 ) {
+      _Watchdog_Tickless_dispatch( cpu_self, heir );
+    }
+
     _ISR_Local_enable( level );
 
     _User_extensions_Thread_switch( executing, heir );
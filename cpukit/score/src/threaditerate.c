@@ -44,7 +44,8 @@ void _Thread_Iterate(
     for ( i = 1 ; i <= information->maximum ; ++i ) {
       Thread_Control *the_thread;
 
-      the_thread = (Thread_Control *) information->local_table[ i ];
+      the_thread = (Thread_Control *)
+        _Objects_Get_local_object( information, i );
 
       if ( the_thread != NULL ) {
         bool done;
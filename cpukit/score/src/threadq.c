@@ -25,7 +25,9 @@
 #include <rtems/score/threadimpl.h>
 
 RTEMS_STATIC_ASSERT(
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  offsetof( Thread_queue_Syslock_queue, Queue.Lock.reserved[ 0 ] )
+#elif defined(RTEMS_SMP)
   offsetof( Thread_queue_Syslock_queue, Queue.Lock.next_ticket )
 #else
   offsetof( Thread_queue_Syslock_queue, reserved[ 0 ] )
@@ -35,7 +37,9 @@ RTEMS_STATIC_ASSERT(
 );
 
 RTEMS_STATIC_ASSERT(
-#if defined(RTEMS_SMP)
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  offsetof( Thread_queue_Syslock_queue, Queue.Lock.reserved[ 1 ] )
+#elif defined(RTEMS_SMP)
   offsetof( Thread_queue_Syslock_queue, Queue.Lock.now_serving )
 #else
   offsetof( Thread_queue_Syslock_queue, reserved[ 1 ] )
@@ -44,6 +48,14 @@ RTEMS_STATIC_ASSERT(
   THREAD_QUEUE_SYSLOCK_QUEUE_NOW_SERVING
 );
 
+#if defined(RTEMS_SMP_MCS_LOCKS)
+RTEMS_STATIC_ASSERT(
+  sizeof( SMP_MCS_lock_Control )
+    <= sizeof( ( (struct _Thread_queue_Queue *) 0 )->_Lock ),
+  THREAD_QUEUE_SYSLOCK_QUEUE_MCS_LOCK
+);
+#endif
+
 RTEMS_STATIC_ASSERT(
   offsetof( Thread_queue_Syslock_queue, Queue.heads )
     == offsetof( struct _Thread_queue_Queue, _heads ),
@@ -736,6 +736,56 @@ void _Thread_queue_Surrender_sticky(
   _Thread_Priority_and_sticky_update( new_owner, 0 );
   _Thread_Dispatch_enable( cpu_self );
 }
+
+void _Thread_queue_Surrender_no_owner(
+  Thread_queue_Queue            *queue,
+  const Thread_queue_Operations *operations,
+  Thread_queue_Context          *queue_context
+)
+{
+  Thread_queue_Heads *heads;
+  Thread_Control     *new_owner;
+
+  _Thread_queue_Queue_acquire_critical(
+    queue,
+    &_Thread_Executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  heads = queue->heads;
+
+  if ( heads == NULL ) {
+    _Thread_queue_Queue_release(
+      queue,
+      &queue_context->Lock_context.Lock_context
+    );
+    return;
+  }
+
+  new_owner = ( *operations->first )( heads );
+
+  if ( !_Thread_queue_Queue_try_set_owner( queue, new_owner ) ) {
+    /*
+     * The thread queue was obtained without the thread queue lock in the
+     * meantime.  The new owner will observe the enqueued threads during its
+     * release.
+     */
+    _Thread_queue_Queue_release(
+      queue,
+      &queue_context->Lock_context.Lock_context
+    );
+    return;
+  }
+
+#if defined(RTEMS_MULTIPROCESSING)
+  if ( !_Thread_queue_MP_set_callout( new_owner, queue_context ) )
+#endif
+  {
+    _Thread_Resource_count_increment( new_owner );
+  }
+
+  _Thread_queue_Extract_critical( queue, operations, new_owner, queue_context );
+}
 #endif
 
 Thread_Control *_Thread_queue_Do_dequeue(
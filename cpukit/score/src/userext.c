@@ -25,31 +25,55 @@
 
 void _User_extensions_Handler_initialization(void)
 {
-  User_extensions_Switch_control *initial_extension_switch_controls;
-  const User_extensions_Table    *initial_table;
-  uint32_t                        n;
-  uint32_t                        i;
+  User_extensions_Initial_callouts *initial;
+  const User_extensions_Table      *initial_table;
+  void                            **callouts;
+  uint32_t                          n;
+  uint32_t                          i;
 
   n = rtems_configuration_get_number_of_initial_extensions();
 
-  initial_extension_switch_controls = _Workspace_Allocate_or_fatal_error(
-    n * sizeof( *initial_extension_switch_controls )
+  /*
+   * One allocation with room for all thread switch, create and delete
+   * callouts of the initial extensions.
+   */
+  callouts = _Workspace_Allocate_or_fatal_error(
+    n * ( sizeof( *initial->thread_switch )
+      + sizeof( *initial->thread_create )
+      + sizeof( *initial->thread_delete ) )
   );
 
+  initial = &_User_extensions_Initial_callouts;
+  initial->thread_switch =
+    (User_extensions_thread_switch_extension *) callouts;
+  initial->thread_create = (User_extensions_thread_create_extension *)
+    &initial->thread_switch[ n ];
+  initial->thread_delete = (User_extensions_thread_delete_extension *)
+    &initial->thread_create[ n ];
+
   initial_table = rtems_configuration_get_user_extension_table();
 
   for ( i = 0 ; i < n ; ++i ) {
-    User_extensions_thread_switch_extension callout;
+    const User_extensions_Table *table;
+
+    table = &initial_table[ i ];
 
-    callout = initial_table[ i ].thread_switch;
+    if ( table->thread_switch != NULL ) {
+      initial->thread_switch[ initial->thread_switch_count ] =
+        table->thread_switch;
+      ++initial->thread_switch_count;
+    }
 
-    if ( callout != NULL ) {
-      User_extensions_Switch_control *c;
+    if ( table->thread_create != NULL ) {
+      initial->thread_create[ initial->thread_create_count ] =
+        table->thread_create;
+      ++initial->thread_create_count;
+    }
 
-      c = &initial_extension_switch_controls[ i ];
-      c->thread_switch = callout;
-      _Chain_Initialize_node( &c->Node );
-      _Chain_Append_unprotected( &_User_extensions_Switches_list, &c->Node );
+    if ( table->thread_delete != NULL ) {
+      initial->thread_delete[ initial->thread_delete_count ] =
+        table->thread_delete;
+      ++initial->thread_delete_count;
     }
   }
 }
@@ -38,6 +38,8 @@ User_extensions_List _User_extensions_List = {
 #endif
 };
 
+User_extensions_Initial_callouts _User_extensions_Initial_callouts;
+
 void _User_extensions_Thread_create_visitor(
   Thread_Control              *executing,
   void                        *arg,
@@ -147,35 +149,19 @@ void _User_extensions_Thread_terminate_visitor(
   }
 }
 
-void _User_extensions_Iterate(
+static void _User_extensions_Do_iterate_dynamic(
+  Thread_Control           *executing,
   void                     *arg,
   User_extensions_Visitor   visitor,
   Chain_Iterator_direction  direction
 )
 {
-  Thread_Control              *executing;
-  const User_extensions_Table *initial_current;
-  const User_extensions_Table *initial_begin;
-  const User_extensions_Table *initial_end;
-  const Chain_Node            *end;
-  Chain_Node                  *node;
-  User_extensions_Iterator     iter;
-  ISR_lock_Context             lock_context;
-
-  executing = _Thread_Get_executing();
-
-  initial_begin = rtems_configuration_get_user_extension_table();
-  initial_end =
-    initial_begin + rtems_configuration_get_number_of_initial_extensions();
+  const Chain_Node         *end;
+  Chain_Node               *node;
+  User_extensions_Iterator  iter;
+  ISR_lock_Context          lock_context;
 
   if ( direction == CHAIN_ITERATOR_FORWARD ) {
-    initial_current = initial_begin;
-
-    while ( initial_current != initial_end ) {
-      (*visitor)( executing, arg, initial_current );
-      ++initial_current;
-    }
-
     end = _Chain_Immutable_tail( &_User_extensions_List.Active );
   } else {
     end = _Chain_Immutable_head( &_User_extensions_List.Active );
@@ -215,6 +201,49 @@ void _User_extensions_Iterate(
   _Chain_Iterator_destroy( &iter.Iterator );
 
   _User_extensions_Release( &lock_context );
+}
+
+void _User_extensions_Iterate_dynamic(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  Chain_Iterator_direction  direction
+)
+{
+  _User_extensions_Do_iterate_dynamic(
+    _Thread_Get_executing(),
+    arg,
+    visitor,
+    direction
+  );
+}
+
+void _User_extensions_Iterate(
+  void                     *arg,
+  User_extensions_Visitor   visitor,
+  Chain_Iterator_direction  direction
+)
+{
+  Thread_Control              *executing;
+  const User_extensions_Table *initial_current;
+  const User_extensions_Table *initial_begin;
+  const User_extensions_Table *initial_end;
+
+  executing = _Thread_Get_executing();
+
+  initial_begin = rtems_configuration_get_user_extension_table();
+  initial_end =
+    initial_begin + rtems_configuration_get_number_of_initial_extensions();
+
+  if ( direction == CHAIN_ITERATOR_FORWARD ) {
+    initial_current = initial_begin;
+
+    while ( initial_current != initial_end ) {
+      (*visitor)( executing, arg, initial_current );
+      ++initial_current;
+    }
+  }
+
+  _User_extensions_Do_iterate_dynamic( executing, arg, visitor, direction );
 
   if ( direction == CHAIN_ITERATOR_BACKWARD ) {
     initial_current = initial_end;
@@ -25,6 +25,34 @@
 
 #include <rtems/score/watchdogimpl.h>
 
+/*
+ * In tickless mode, the next clock interrupt of the processor may be too late
+ * for the new watchdog.  The expiration time of realtime watchdogs is not
+ * measured in clock ticks, so they always lead to a reprogramming.
+ */
+static void _Watchdog_Insert_update_next_tick(
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog,
+  uint64_t                expire
+)
+{
+  Per_CPU_Control *cpu;
+
+  cpu = _Watchdog_Get_CPU( the_watchdog );
+
+  if ( cpu->Watchdog.next_tick == 0 ) {
+    return;
+  }
+
+  if (
+    ( header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+      && expire < cpu->Watchdog.next_tick )
+      || header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  ) {
+    _Watchdog_Tickless_reprogram_critical( cpu );
+  }
+}
+
 void _Watchdog_Insert(
   Watchdog_Header  *header,
   Watchdog_Control *the_watchdog,
@@ -38,6 +66,14 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if (
+    header->wheel != NULL
+      && _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire )
+  ) {
+    _Watchdog_Insert_update_next_tick( header, the_watchdog, expire );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -63,4 +99,5 @@ void _Watchdog_Insert(
   _RBTree_Initialize_node( &the_watchdog->Node.RBTree );
   _RBTree_Add_child( &the_watchdog->Node.RBTree, parent, link );
   _RBTree_Insert_color( &header->Watchdogs, &the_watchdog->Node.RBTree );
+  _Watchdog_Insert_update_next_tick( header, the_watchdog, expire );
 }
@@ -31,11 +31,16 @@ void _Watchdog_Remove(
 )
 {
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
-    if ( header->first == &the_watchdog->Node.RBTree ) {
-      _Watchdog_Next_first( header, the_watchdog );
+    if ( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_SCHEDULED_WHEEL ) {
+      _Watchdog_Wheel_remove( header->wheel, the_watchdog );
+    } else {
+      if ( header->first == &the_watchdog->Node.RBTree ) {
+        _Watchdog_Next_first( header, the_watchdog );
+      }
+
+      _RBTree_Extract( &header->Watchdogs, &the_watchdog->Node.RBTree );
     }
 
-    _RBTree_Extract( &header->Watchdogs, &the_watchdog->Node.RBTree );
     _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
   }
 }
@@ -30,6 +30,29 @@ void _Watchdog_Do_tickle(
   ISR_lock_Context *lock_context
 )
 {
+  Watchdog_Wheel *wheel;
+
+  wheel = header->wheel;
+
+  if ( wheel != NULL ) {
+    _Watchdog_Wheel_advance( wheel, now );
+
+    while ( !_Chain_Is_empty( &wheel->Expired ) ) {
+      Watchdog_Control               *the_watchdog;
+      Watchdog_Service_routine_entry  routine;
+
+      the_watchdog = (Watchdog_Control *)
+        _Chain_Get_first_unprotected( &wheel->Expired );
+      --wheel->count;
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+  }
+
   while ( true ) {
     Watchdog_Control *the_watchdog;
 
@@ -58,11 +81,34 @@ void _Watchdog_Do_tickle(
   _ISR_lock_Release_and_ISR_enable( lock, lock_context );
 }
 
+static void _Watchdog_Do_tick(
+  Per_CPU_Control  *cpu,
+  uint64_t          ticks,
+  ISR_lock_Context *lock_context
+)
+{
+  struct timespec now;
+
+  _Watchdog_Tickle(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+    ticks,
+    &cpu->Watchdog.Lock,
+    lock_context
+  );
+
+  _Timecounter_Getnanotime( &now );
+  _Watchdog_Per_CPU_tickle_realtime(
+    cpu,
+    _Watchdog_Realtime_from_timespec( &now )
+  );
+
+  _Scheduler_Tick( cpu );
+}
+
 void _Watchdog_Tick( Per_CPU_Control *cpu )
 {
   ISR_lock_Context lock_context;
   uint64_t         ticks;
-  struct timespec  now;
 
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
     ++_Watchdog_Ticks_since_boot;
@@ -75,18 +121,22 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   ++ticks;
   cpu->Watchdog.ticks = ticks;
 
-  _Watchdog_Tickle(
-    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
-    ticks,
-    &cpu->Watchdog.Lock,
-    &lock_context
-  );
+  _Watchdog_Do_tick( cpu, ticks, &lock_context );
+}
 
-  _Timecounter_Getnanotime( &now );
-  _Watchdog_Per_CPU_tickle_realtime(
-    cpu,
-    _Watchdog_Realtime_from_timespec( &now )
-  );
+void _Watchdog_Tickless_tick( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context lock_context;
 
-  _Scheduler_Tick( cpu );
+  /* Accounts the elapsed clock tick intervals */
+  _ISR_lock_ISR_disable( &lock_context );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+
+  _Watchdog_Do_tick( cpu, cpu->Watchdog.ticks, &lock_context );
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+  _Watchdog_Tickless_reprogram_critical( cpu );
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+  _ISR_lock_ISR_enable( &lock_context );
 }
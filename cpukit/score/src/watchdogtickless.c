@@ -0,0 +1,198 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Tickless Mode
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/timecounter.h>
+
+const Watchdog_Tickless_operations *_Watchdog_Tickless;
+
+/*
+ * Only the boot processor increments the watchdog ticks counter.  It is NULL
+ * as long as the boot processor uses periodic clock interrupts.
+ */
+static Per_CPU_Control *_Watchdog_Tickless_boot_cpu;
+
+static bool _Watchdog_Tickless_needs_tick( const Thread_Control *the_thread )
+{
+  return the_thread != NULL
+    && !the_thread->is_idle
+    && the_thread->budget_algorithm != THREAD_CPU_BUDGET_ALGORITHM_NONE;
+}
+
+uint64_t _Watchdog_Next_tick( const Per_CPU_Control *cpu, uint32_t max_ticks )
+{
+  const Watchdog_Header  *header;
+  const Watchdog_Control *first;
+  uint64_t                ticks;
+  uint64_t                next;
+
+  ticks = cpu->Watchdog.ticks;
+  next = ticks + max_ticks;
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+
+  if ( header->wheel != NULL ) {
+    uint64_t expire;
+
+    expire = _Watchdog_Wheel_next_expire( header->wheel );
+
+    if ( expire < next ) {
+      next = expire;
+    }
+  }
+
+  first = (const Watchdog_Control *) header->first;
+
+  if ( first != NULL && first->expire < next ) {
+    next = first->expire;
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  first = (const Watchdog_Control *) header->first;
+
+  if ( first != NULL ) {
+    struct timespec now;
+    uint64_t        expire_ns;
+    uint64_t        now_ns;
+
+    _Timecounter_Nanotime( &now );
+
+    expire_ns = ( first->expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+      * WATCHDOG_NANOSECONDS_PER_SECOND;
+    expire_ns += first->expire
+      & ( ( UINT32_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 );
+    now_ns = (uint64_t) now.tv_sec * WATCHDOG_NANOSECONDS_PER_SECOND;
+    now_ns += (uint32_t) now.tv_nsec;
+
+    if ( expire_ns > now_ns ) {
+      uint64_t delta;
+
+      delta = ( expire_ns - now_ns ) / _Watchdog_Nanoseconds_per_tick + 1;
+
+      if ( delta < next - ticks ) {
+        next = ticks + delta;
+      }
+    } else {
+      next = ticks;
+    }
+  }
+
+  if ( next <= ticks ) {
+    next = ticks + 1;
+  }
+
+  return next;
+}
+
+void _Watchdog_Tickless_synchronize_critical( Per_CPU_Control *cpu )
+{
+  uint32_t elapsed;
+
+  elapsed = ( *_Watchdog_Tickless->elapsed_ticks )( cpu );
+
+  if ( elapsed > 0 ) {
+    _Assert( cpu->Watchdog.ticks <= UINT64_MAX - elapsed );
+    cpu->Watchdog.ticks += elapsed;
+
+    if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+      _Watchdog_Ticks_since_boot += elapsed;
+    }
+  }
+}
+
+Watchdog_Interval _Watchdog_Tickless_get_ticks_since_boot( void )
+{
+  Per_CPU_Control   *cpu;
+  ISR_lock_Context   lock_context;
+  Watchdog_Interval  ticks;
+
+  cpu = _Watchdog_Tickless_boot_cpu;
+
+  if ( cpu == NULL ) {
+    return _Watchdog_Ticks_since_boot;
+  }
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+  ticks = _Watchdog_Ticks_since_boot;
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+  _ISR_lock_ISR_enable( &lock_context );
+
+  return ticks;
+}
+
+void _Watchdog_Tickless_dispatch(
+  Per_CPU_Control      *cpu,
+  const Thread_Control *heir
+)
+{
+  ISR_lock_Context lock_context;
+
+  if ( !_Watchdog_Tickless_needs_tick( heir ) ) {
+    return;
+  }
+
+  _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
+
+  if ( cpu->Watchdog.next_tick > cpu->Watchdog.ticks + 1 ) {
+    _Watchdog_Tickless_reprogram_critical( cpu );
+  }
+
+  _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
+}
+
+void _Watchdog_Tickless_reprogram_critical( Per_CPU_Control *cpu )
+{
+  uint64_t next_tick;
+
+  /*
+   * The scheduler tick operation consumes the CPU budget of the executing
+   * thread, so threads with a CPU budget algorithm need periodic clock
+   * interrupts.
+   */
+  if (
+    _Watchdog_Tickless_needs_tick( cpu->executing )
+      || _Watchdog_Tickless_needs_tick( cpu->heir )
+  ) {
+    next_tick = cpu->Watchdog.ticks + 1;
+  } else {
+    next_tick = _Watchdog_Next_tick( cpu, _Watchdog_Tickless->max_ticks );
+  }
+
+  cpu->Watchdog.next_tick = next_tick;
+  ( *_Watchdog_Tickless->set_next_tick )( cpu, next_tick );
+}
+
+void _Watchdog_Tickless_enable(
+  Per_CPU_Control                    *cpu,
+  const Watchdog_Tickless_operations *operations
+)
+{
+  ISR_lock_Context lock_context;
+
+  _Assert( operations->max_ticks > 0 );
+  _Watchdog_Tickless = operations;
+
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+    _Watchdog_Tickless_boot_cpu = cpu;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  _Watchdog_Tickless_reprogram_critical( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
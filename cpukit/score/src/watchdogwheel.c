@@ -0,0 +1,261 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timing Wheel
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+#define WATCHDOG_WHEEL_RANGE \
+  ( UINT64_C( 1 ) << ( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) )
+
+static void _Watchdog_Wheel_place(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  uint64_t     delta;
+  unsigned int shift;
+  size_t       level;
+  size_t       slot;
+
+  _Assert( expire >= wheel->now );
+  delta = expire - wheel->now;
+  _Assert( delta < WATCHDOG_WHEEL_RANGE );
+
+  level = 0;
+  shift = 0;
+
+  while ( ( delta >> ( shift + WATCHDOG_WHEEL_SLOT_BITS ) ) != 0 ) {
+    ++level;
+    shift += WATCHDOG_WHEEL_SLOT_BITS;
+  }
+
+  slot = (size_t) ( expire >> shift ) & WATCHDOG_WHEEL_SLOT_MASK;
+  _Chain_Append_unprotected(
+    &wheel->Slots[ level ][ slot ],
+    &the_watchdog->Node.Chain
+  );
+}
+
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+)
+{
+  size_t level;
+  size_t slot;
+
+  wheel->now = now;
+  wheel->count = 0;
+  _Chain_Initialize_empty( &wheel->Expired );
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOT_COUNT; ++slot ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ slot ] );
+    }
+  }
+
+  _Watchdog_Header_initialize( header );
+  header->wheel = wheel;
+}
+
+bool _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  uint64_t now;
+  uint64_t place;
+
+  now = wheel->now;
+
+  /* Watchdogs which are already expired fire with the next tick */
+  if ( expire > now ) {
+    place = expire;
+  } else {
+    place = now + 1;
+  }
+
+  if ( place - now >= WATCHDOG_WHEEL_RANGE ) {
+    return false;
+  }
+
+  the_watchdog->expire = expire;
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_WHEEL );
+  ++wheel->count;
+  _Watchdog_Wheel_place( wheel, the_watchdog, place );
+
+  return true;
+}
+
+static void _Watchdog_Wheel_cascade( Watchdog_Wheel *wheel, size_t level )
+{
+  Chain_Control *slot;
+  unsigned int   shift;
+
+  shift = level * WATCHDOG_WHEEL_SLOT_BITS;
+  slot = &wheel->Slots[ level ][
+    (size_t) ( wheel->now >> shift ) & WATCHDOG_WHEEL_SLOT_MASK
+  ];
+
+  while ( !_Chain_Is_empty( slot ) ) {
+    Watchdog_Control *the_watchdog;
+
+    the_watchdog = (Watchdog_Control *) _Chain_Get_first_unprotected( slot );
+    _Watchdog_Wheel_place( wheel, the_watchdog, the_watchdog->expire );
+  }
+}
+
+static void _Watchdog_Wheel_expire( Watchdog_Wheel *wheel )
+{
+  Chain_Control *slot;
+  Chain_Node    *first;
+  Chain_Node    *last;
+  Chain_Node    *tail;
+  Chain_Node    *previous;
+
+  slot = &wheel->Slots[ 0 ][ (size_t) wheel->now & WATCHDOG_WHEEL_SLOT_MASK ];
+
+  if ( _Chain_Is_empty( slot ) ) {
+    return;
+  }
+
+  /* Move the complete slot to the end of the expired chain */
+  first = _Chain_First( slot );
+  last = _Chain_Last( slot );
+  tail = _Chain_Tail( &wheel->Expired );
+  previous = tail->previous;
+
+  previous->next = first;
+  first->previous = previous;
+  last->next = tail;
+  tail->previous = last;
+
+  _Chain_Initialize_empty( slot );
+}
+
+void _Watchdog_Wheel_advance( Watchdog_Wheel *wheel, uint64_t now )
+{
+  while ( wheel->now < now ) {
+    uint64_t now_of_wheel;
+    size_t   level;
+
+    if ( wheel->count == 0 ) {
+      wheel->now = now;
+      break;
+    }
+
+    /*
+     * In tickless mode, the wheel may advance by many ticks at once.  Skip
+     * the ticks without a slot to expire or cascade.
+     */
+    if ( now - wheel->now > 1 ) {
+      uint64_t next;
+
+      next = _Watchdog_Wheel_next_expire( wheel );
+
+      if ( next > now ) {
+        wheel->now = now;
+        break;
+      }
+
+      if ( next > wheel->now + 1 ) {
+        wheel->now = next - 1;
+      }
+    }
+
+    now_of_wheel = wheel->now + 1;
+    wheel->now = now_of_wheel;
+
+    /*
+     * Cascade the slots of the higher levels which start their range with
+     * this tick.  Start with the highest level, since its watchdogs may end
+     * up in the lower level slots cascaded next.
+     */
+    level = 0;
+
+    while (
+      level + 1 < WATCHDOG_WHEEL_LEVEL_COUNT
+        && ( now_of_wheel & WATCHDOG_WHEEL_SLOT_MASK ) == 0
+    ) {
+      ++level;
+      now_of_wheel >>= WATCHDOG_WHEEL_SLOT_BITS;
+    }
+
+    while ( level > 0 ) {
+      _Watchdog_Wheel_cascade( wheel, level );
+      --level;
+    }
+
+    _Watchdog_Wheel_expire( wheel );
+  }
+}
+
+uint64_t _Watchdog_Wheel_next_expire( const Watchdog_Wheel *wheel )
+{
+  uint64_t next;
+  size_t   level;
+
+  if ( wheel->count == 0 ) {
+    return UINT64_MAX;
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Expired ) ) {
+    return wheel->now;
+  }
+
+  next = UINT64_MAX;
+
+  /*
+   * The watchdogs of the first level expire exactly at the time of their
+   * slot.  The watchdogs of the higher levels do not expire before their
+   * slot is cascaded.
+   */
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    unsigned int shift;
+    uint64_t     base;
+    uint64_t     i;
+
+    shift = level * WATCHDOG_WHEEL_SLOT_BITS;
+    base = wheel->now >> shift;
+
+    for ( i = 1; i <= WATCHDOG_WHEEL_SLOT_COUNT; ++i ) {
+      const Chain_Control *slot;
+      uint64_t             start;
+
+      start = ( base + i ) << shift;
+
+      if ( start >= next ) {
+        break;
+      }
+
+      slot = &wheel->Slots[ level ][
+        (size_t) ( base + i ) & WATCHDOG_WHEEL_SLOT_MASK
+      ];
+
+      if ( !_Chain_Is_empty( slot ) ) {
+        next = start;
+        break;
+      }
+    }
+  }
+
+  return next;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timing Wheel Initialization
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/config.h>
+
+void _Watchdog_Wheel_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    _Watchdog_Header_initialize_wheel(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+      &_Watchdog_Wheel_table[ cpu_index ],
+      cpu->Watchdog.ticks
+    );
+  }
+}
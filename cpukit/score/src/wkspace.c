@@ -68,6 +68,11 @@ void _Workspace_Handler_initialization(
   uintptr_t tls_size = _TLS_Get_size();
   size_t i;
 
+  if ( rtems_configuration_get_heap_segregated_fit() ) {
+    init_or_extend = _Heap_Initialize_segregated_fit;
+    overhead += sizeof( Heap_Segregated_index ) + CPU_ALIGNMENT - 1;
+  }
+
   /*
    * In case we have a non-zero TLS size, then we need a TLS area for each
    * thread.  These areas are allocated from the workspace.  Ensure that the
@@ -533,5 +533,6 @@ static rtems_task Init(rtems_task_argument argument)
 #define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE_A
 #define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE_B
 #define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_SIZE_B
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
 
 #include <rtems/confdefs.h>
@@ -495,5 +495,6 @@ static rtems_task Init(rtems_task_argument argument)
 #define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
 #define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
 #define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_SIZE * BLOCK_COUNT)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
 
 #include <rtems/confdefs.h>
@@ -141,6 +141,7 @@ static void Init(rtems_task_argument arg)
 #define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
 #define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
 #define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
 
 #define CONFIGURE_MAXIMUM_TASKS 1
 
@@ -52,11 +52,11 @@ static const int action_sequence [READ_COUNT] = {
 static const int expected_block_access_counts [READ_COUNT] [BLOCK_COUNT] = {
    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
    { 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+   { 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
-   { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
@@ -68,19 +68,42 @@ static const int expected_block_access_counts [READ_COUNT] [BLOCK_COUNT] = {
    { 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0 },
    UNUSED_LINE,
    { 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 },
-   { 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1 },
+   { 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0 },
    UNUSED_LINE,
    { 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 },
-   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 },
-   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 }
+   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0 },
+   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0 }
+};
+
+/*
+ * The read-ahead stream checked after each action.  The read of block 2
+ * starts a second stream, since no stream expects it.  After a reset the
+ * first stream is used again.
+ */
+static const int stream [READ_COUNT] = {
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0, 0,
+  0,
+  0, 0, 1
 };
 
 #define NO_TRIGGER RTEMS_DISK_READ_AHEAD_NO_TRIGGER
 
 #define TRIGGER_AFTER_RESET RTEMS_DISK_READ_AHEAD_NO_TRIGGER
 
+/*
+ * The read-ahead window starts with one block and doubles with each hit at
+ * the trigger up to the maximum of three blocks.
+ */
 static const rtems_blkdev_bnum trigger [READ_COUNT] = {
-  1, 3, 5, 5, 8, 8, 8, NO_TRIGGER, NO_TRIGGER, NO_TRIGGER,
+  1, 3, 4, 6, 6, 8, 8, NO_TRIGGER, NO_TRIGGER, NO_TRIGGER,
   TRIGGER_AFTER_RESET,
   11,
   TRIGGER_AFTER_RESET,
@@ -88,15 +111,15 @@ static const rtems_blkdev_bnum trigger [READ_COUNT] = {
   TRIGGER_AFTER_RESET,
   9,
   TRIGGER_AFTER_RESET,
-  8, NO_TRIGGER,
+  8, 9,
   TRIGGER_AFTER_RESET,
-  7, 9, NO_TRIGGER
+  7, 8, 10
 };
 
 #define NOT_CHANGED_BY_RESET(i) (i)
 
 static const rtems_blkdev_bnum next [READ_COUNT] = {
-  2, 4, 7, 7, 10, 10, 10, 10, 10, 10,
+  2, 4, 5, 7, 7, 10, 10, 10, 10, 10,
   NOT_CHANGED_BY_RESET(10),
   12,
   NOT_CHANGED_BY_RESET(12),
@@ -104,9 +127,9 @@ static const rtems_blkdev_bnum next [READ_COUNT] = {
   NOT_CHANGED_BY_RESET(11),
   10,
   NOT_CHANGED_BY_RESET(10),
-  9, 9,
-  NOT_CHANGED_BY_RESET(9),
-  8, 11, 11
+  9, 10,
+  NOT_CHANGED_BY_RESET(10),
+  8, 9, 11
 };
 
 static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
@@ -171,8 +194,8 @@ static void test_read_ahead(rtems_disk_device *dd)
       memset(&block_access_counts, 0, sizeof(block_access_counts));
     }
 
-    rtems_test_assert(trigger [i] == dd->read_ahead.trigger);
-    rtems_test_assert(next [i] == dd->read_ahead.next);
+    rtems_test_assert(trigger [i] == dd->read_ahead [stream [i]].trigger);
+    rtems_test_assert(next [i] == dd->read_ahead [stream [i]].next);
   }
 
   printf("\n");
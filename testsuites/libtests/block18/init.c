@@ -0,0 +1,533 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/bdbufhash.h>
+#include <rtems/counter.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#define DEVICE_COUNT 4
+
+#define MIN_ENTRIES 1024
+
+#define MAX_ENTRIES (64 * 1024)
+
+#define AVL_MAX_HEIGHT 32
+
+#define RANDOM_MAX_ENTRIES 24
+
+#define RANDOM_KEY_COUNT 96
+
+#define RANDOM_OPERATIONS 20000
+
+/*
+ * The reference is the AVL tree which indexed the buffer descriptors before
+ * the hash index.  Except the node type it is a verbatim copy.
+ */
+typedef struct avl_node {
+  struct avl_node *left;
+  struct avl_node *right;
+  signed char cache;
+  signed char bal;
+  rtems_disk_device *dd;
+  rtems_blkdev_bnum block;
+} avl_node;
+
+static avl_node *
+avl_search (avl_node** root,
+            const rtems_disk_device *dd,
+            rtems_blkdev_bnum    block)
+{
+  avl_node* p = *root;
+
+  while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
+  {
+    if (((uintptr_t) p->dd < (uintptr_t) dd)
+        || ((p->dd == dd) && (p->block < block)))
+    {
+      p = p->right;
+    }
+    else
+    {
+      p = p->left;
+    }
+  }
+
+  return p;
+}
+
+/**
+ * Inserts the specified node to the AVl-Tree.
+ *
+ * @param root pointer to the root node of the AVL-Tree
+ * @param node Pointer to the node to add.
+ * @retval 0 The node added successfully
+ * @retval -1 An error occured
+ */
+static int
+avl_insert(avl_node** root,
+           avl_node*  node)
+{
+  const rtems_disk_device *dd = node->dd;
+  rtems_blkdev_bnum block = node->block;
+
+  avl_node*  p = *root;
+  avl_node*  q;
+  avl_node*  p1;
+  avl_node*  p2;
+  avl_node*  buf_stack[AVL_MAX_HEIGHT];
+  avl_node** buf_prev = buf_stack;
+
+  bool modified = false;
+
+  if (p == NULL)
+  {
+    *root = node;
+    node->left = NULL;
+    node->right = NULL;
+    node->bal = 0;
+    return 0;
+  }
+
+  while (p != NULL)
+  {
+    *buf_prev++ = p;
+
+    if (((uintptr_t) p->dd < (uintptr_t) dd)
+        || ((p->dd == dd) && (p->block < block)))
+    {
+      p->cache = 1;
+      q = p->right;
+      if (q == NULL)
+      {
+        q = node;
+        p->right = q = node;
+        break;
+      }
+    }
+    else if ((p->dd != dd) || (p->block != block))
+    {
+      p->cache = -1;
+      q = p->left;
+      if (q == NULL)
+      {
+        q = node;
+        p->left = q;
+        break;
+      }
+    }
+    else
+    {
+      return -1;
+    }
+
+    p = q;
+  }
+
+  q->left = q->right = NULL;
+  q->bal = 0;
+  modified = true;
+  buf_prev--;
+
+  while (modified)
+  {
+    if (p->cache == -1)
+    {
+      switch (p->bal)
+      {
+        case 1:
+          p->bal = 0;
+          modified = false;
+          break;
+
+        case 0:
+          p->bal = -1;
+          break;
+
+        case -1:
+          p1 = p->left;
+          if (p1->bal == -1) /* simple LL-turn */
+          {
+            p->left = p1->right;
+            p1->right = p;
+            p->bal = 0;
+            p = p1;
+          }
+          else /* double LR-turn */
+          {
+            p2 = p1->right;
+            p1->right = p2->left;
+            p2->left = p1;
+            p->left = p2->right;
+            p2->right = p;
+            if (p2->bal == -1) p->bal = +1; else p->bal = 0;
+            if (p2->bal == +1) p1->bal = -1; else p1->bal = 0;
+            p = p2;
+          }
+          p->bal = 0;
+          modified = false;
+          break;
+
+        default:
+          break;
+      }
+    }
+    else
+    {
+      switch (p->bal)
+      {
+        case -1:
+          p->bal = 0;
+          modified = false;
+          break;
+
+        case 0:
+          p->bal = 1;
+          break;
+
+        case 1:
+          p1 = p->right;
+          if (p1->bal == 1) /* simple RR-turn */
+          {
+            p->right = p1->left;
+            p1->left = p;
+            p->bal = 0;
+            p = p1;
+          }
+          else /* double RL-turn */
+          {
+            p2 = p1->left;
+            p1->left = p2->right;
+            p2->right = p1;
+            p->right = p2->left;
+            p2->left = p;
+            if (p2->bal == +1) p->bal = -1; else p->bal = 0;
+            if (p2->bal == -1) p1->bal = +1; else p1->bal = 0;
+            p = p2;
+          }
+          p->bal = 0;
+          modified = false;
+          break;
+
+        default:
+          break;
+      }
+    }
+    q = p;
+    if (buf_prev > buf_stack)
+    {
+      p = *--buf_prev;
+
+      if (p->cache == -1)
+      {
+        p->left = q;
+      }
+      else
+      {
+        p->right = q;
+      }
+    }
+    else
+    {
+      *root = p;
+      break;
+    }
+  };
+
+  return 0;
+}
+
+typedef struct {
+  rtems_disk_device devices[DEVICE_COUNT];
+  rtems_bdbuf_buffer *bds;
+  avl_node *nodes;
+  uint32_t *order;
+  rtems_bdbuf_buffer random_bds[RANDOM_KEY_COUNT];
+  rtems_bdbuf_buffer duplicate_bds[RANDOM_KEY_COUNT];
+  bool present[RANDOM_KEY_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void set_key(
+  test_context *ctx,
+  uint32_t i,
+  rtems_disk_device **dd,
+  rtems_blkdev_bnum *block
+)
+{
+  /*
+   * Interleave the devices and use a block to media block ratio of eight to
+   * get a key distribution similar to several file systems with 4KiB blocks on
+   * disks with 512 byte sectors.
+   */
+  *dd = &ctx->devices[i % DEVICE_COUNT];
+  *block = (i / DEVICE_COUNT) * 8;
+}
+
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return *seed >> 8;
+}
+
+static void shuffle(uint32_t *order, uint32_t n, uint32_t seed)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; ++i) {
+    order[i] = i;
+  }
+
+  for (i = n - 1; i > 0; --i) {
+    uint32_t j;
+    uint32_t t;
+
+    j = next_random(&seed) % (i + 1);
+    t = order[i];
+    order[i] = order[j];
+    order[j] = t;
+  }
+}
+
+static uint64_t per_operation(rtems_counter_ticks d, uint32_t n)
+{
+  return rtems_counter_ticks_to_nanoseconds(d) / n;
+}
+
+static void measure(test_context *ctx, uint32_t n)
+{
+  rtems_bdbuf_hash_table table;
+  avl_node *root;
+  rtems_counter_ticks a;
+  rtems_counter_ticks hash_insert;
+  rtems_counter_ticks hash_search;
+  rtems_counter_ticks avl_insert_ticks;
+  rtems_counter_ticks avl_search_ticks;
+  rtems_status_code sc;
+  uint32_t i;
+
+  for (i = 0; i < n; ++i) {
+    set_key(ctx, i, &ctx->bds[i].dd, &ctx->bds[i].block);
+    set_key(ctx, i, &ctx->nodes[i].dd, &ctx->nodes[i].block);
+  }
+
+  sc = rtems_bdbuf_hash_initialize(&table, n);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  root = NULL;
+
+  shuffle(ctx->order, n, n);
+
+  a = rtems_counter_read();
+  for (i = 0; i < n; ++i) {
+    rtems_bdbuf_hash_insert(&table, &ctx->bds[ctx->order[i]]);
+  }
+  hash_insert = rtems_counter_difference(rtems_counter_read(), a);
+
+  a = rtems_counter_read();
+  for (i = 0; i < n; ++i) {
+    avl_insert(&root, &ctx->nodes[ctx->order[i]]);
+  }
+  avl_insert_ticks = rtems_counter_difference(rtems_counter_read(), a);
+
+  shuffle(ctx->order, n, n + 1);
+
+  a = rtems_counter_read();
+  for (i = 0; i < n; ++i) {
+    const rtems_bdbuf_buffer *bd = &ctx->bds[ctx->order[i]];
+
+    rtems_bdbuf_hash_search(&table, bd->dd, bd->block);
+  }
+  hash_search = rtems_counter_difference(rtems_counter_read(), a);
+
+  a = rtems_counter_read();
+  for (i = 0; i < n; ++i) {
+    const avl_node *node = &ctx->nodes[ctx->order[i]];
+
+    avl_search(&root, node->dd, node->block);
+  }
+  avl_search_ticks = rtems_counter_difference(rtems_counter_read(), a);
+
+  for (i = 0; i < n; ++i) {
+    rtems_bdbuf_buffer *bd = &ctx->bds[i];
+    avl_node *node = &ctx->nodes[i];
+
+    rtems_test_assert(rtems_bdbuf_hash_search(&table, bd->dd, bd->block) == bd);
+    rtems_test_assert(avl_search(&root, node->dd, node->block) == node);
+  }
+
+  rtems_test_assert(table.count == n);
+  rtems_bdbuf_hash_destroy(&table);
+
+  printf(
+    "  <Sample>\n"
+    "    <Entries>%" PRIu32 "</Entries>\n"
+    "    <HashInsert unit=\"ns\">%" PRIu64 "</HashInsert>"
+    "<AVLInsert unit=\"ns\">%" PRIu64 "</AVLInsert>\n"
+    "    <HashSearch unit=\"ns\">%" PRIu64 "</HashSearch>"
+    "<AVLSearch unit=\"ns\">%" PRIu64 "</AVLSearch>\n"
+    "  </Sample>\n",
+    n,
+    per_operation(hash_insert, n),
+    per_operation(avl_insert_ticks, n),
+    per_operation(hash_search, n),
+    per_operation(avl_search_ticks, n)
+  );
+}
+
+static void check_random(
+  test_context *ctx,
+  const rtems_bdbuf_hash_table *table,
+  size_t count
+)
+{
+  uint32_t i;
+
+  rtems_test_assert(table->count == count);
+
+  for (i = 0; i < RANDOM_KEY_COUNT; ++i) {
+    const rtems_bdbuf_buffer *bd = &ctx->random_bds[i];
+    const rtems_bdbuf_buffer *expected = ctx->present[i] ? bd : NULL;
+
+    rtems_test_assert(
+      rtems_bdbuf_hash_search(table, bd->dd, bd->block) == expected
+    );
+  }
+}
+
+static void test_random(test_context *ctx)
+{
+  rtems_bdbuf_hash_table table;
+  rtems_status_code sc;
+  size_t count;
+  uint32_t seed;
+  uint32_t i;
+
+  /*
+   * A small table with more keys than slots produces long probe sequences
+   * which wrap around the end of the slot table.  The backward shift
+   * deletion must keep all remaining keys reachable.
+   */
+  for (i = 0; i < RANDOM_KEY_COUNT; ++i) {
+    set_key(ctx, i, &ctx->random_bds[i].dd, &ctx->random_bds[i].block);
+    ctx->duplicate_bds[i] = ctx->random_bds[i];
+    ctx->present[i] = false;
+  }
+
+  sc = rtems_bdbuf_hash_initialize(&table, RANDOM_MAX_ENTRIES);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  count = 0;
+  seed = 0;
+
+  for (i = 0; i < RANDOM_OPERATIONS; ++i) {
+    uint32_t r = next_random(&seed);
+    uint32_t k = r % RANDOM_KEY_COUNT;
+    rtems_bdbuf_buffer *bd = &ctx->random_bds[k];
+    bool insert = ((r / RANDOM_KEY_COUNT) & 0x1) != 0;
+
+    /* Another descriptor with the same key is neither inserted nor removed */
+    if (ctx->present[k]) {
+      rtems_test_assert(
+        rtems_bdbuf_hash_insert(&table, &ctx->duplicate_bds[k]) == -1
+      );
+    }
+
+    rtems_test_assert(
+      rtems_bdbuf_hash_remove(&table, &ctx->duplicate_bds[k]) == -1
+    );
+
+    if (insert) {
+      if (ctx->present[k]) {
+        rtems_test_assert(rtems_bdbuf_hash_insert(&table, bd) == -1);
+      } else if (count < table.mask) {
+        rtems_test_assert(rtems_bdbuf_hash_insert(&table, bd) == 0);
+        ctx->present[k] = true;
+        ++count;
+      } else {
+        rtems_test_assert(rtems_bdbuf_hash_insert(&table, bd) == -1);
+      }
+    } else {
+      if (ctx->present[k]) {
+        rtems_test_assert(rtems_bdbuf_hash_remove(&table, bd) == 0);
+        ctx->present[k] = false;
+        --count;
+      } else {
+        rtems_test_assert(rtems_bdbuf_hash_remove(&table, bd) == -1);
+      }
+    }
+
+    check_random(ctx, &table, count);
+  }
+
+  rtems_bdbuf_hash_destroy(&table);
+}
+
+static void test(test_context *ctx)
+{
+  uint32_t n;
+
+  test_random(ctx);
+
+  printf("<Block18>\n");
+
+  for (n = MIN_ENTRIES; n <= MAX_ENTRIES; n *= 4) {
+    ctx->bds = calloc(n, sizeof(*ctx->bds));
+    rtems_test_assert(ctx->bds != NULL);
+
+    ctx->nodes = calloc(n, sizeof(*ctx->nodes));
+    rtems_test_assert(ctx->nodes != NULL);
+
+    ctx->order = calloc(n, sizeof(*ctx->order));
+    rtems_test_assert(ctx->order != NULL);
+
+    measure(ctx, n);
+
+    free(ctx->bds);
+    free(ctx->nodes);
+    free(ctx->order);
+  }
+
+  printf("</Block18>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
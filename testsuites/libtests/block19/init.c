@@ -0,0 +1,312 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+#include <rtems/ramdisk.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 128
+
+#define WORKER_COUNT 2
+
+#define WORKER_ROUNDS 8
+
+#define DONE_EVENT RTEMS_EVENT_0
+
+/*
+ * Each shard needs RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN groups of two blocks.
+ * The cache is half of the disk to force buffer recycling.
+ */
+#define CACHE_SHARDS 4
+
+#define CACHE_BLOCK_COUNT \
+  (2 * CACHE_SHARDS * RTEMS_BDBUF_CACHE_SHARD_GROUPS_MIN)
+
+/*
+ * The read-ahead task must be able to preempt the reading task.
+ */
+#define INIT_PRIORITY (RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT + 5)
+
+static unsigned char disk_area [MEDIA_BLOCK_COUNT * MEDIA_BLOCK_SIZE];
+
+static rtems_disk_device *dd;
+
+static rtems_id main_task;
+
+static unsigned char pattern(rtems_blkdev_bnum block, unsigned round)
+{
+  return (unsigned char) (block * 7 + round);
+}
+
+static void write_block(rtems_blkdev_bnum block, unsigned round)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  ASSERT_SC(sc);
+
+  memset(bd->buffer, pattern(block, round), MEDIA_BLOCK_SIZE);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  ASSERT_SC(sc);
+}
+
+static void check_block(rtems_blkdev_bnum block, unsigned round)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum i;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  ASSERT_SC(sc);
+
+  for (i = 0; i < MEDIA_BLOCK_SIZE; ++i) {
+    rtems_test_assert(bd->buffer [i] == pattern(block, round));
+  }
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+}
+
+static void check_disk_area(unsigned round)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < MEDIA_BLOCK_COUNT; ++block) {
+    rtems_test_assert(
+      disk_area [block * MEDIA_BLOCK_SIZE] == pattern(block, round)
+    );
+  }
+}
+
+static void test_write_and_read_back(void)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < MEDIA_BLOCK_COUNT; ++block) {
+    write_block(block, 0);
+  }
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+
+  check_disk_area(0);
+
+  rtems_bdbuf_purge_dev(dd);
+
+  for (block = 0; block < MEDIA_BLOCK_COUNT; ++block) {
+    check_block(block, 0);
+  }
+}
+
+static void test_read_ahead(void)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+
+  for (block = 0; block < MEDIA_BLOCK_COUNT; ++block) {
+    check_block(block, 0);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_ahead_transfers > 0);
+  rtems_test_assert(stats.read_hits > 0);
+  rtems_test_assert(stats.read_hits + stats.read_misses == MEDIA_BLOCK_COUNT);
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  unsigned round;
+
+  for (round = 1; round <= WORKER_ROUNDS; ++round) {
+    rtems_blkdev_bnum block;
+
+    for (block = arg; block < MEDIA_BLOCK_COUNT; block += WORKER_COUNT) {
+      write_block(block, round);
+      check_block(block, round);
+    }
+  }
+
+  sc = rtems_event_send(main_task, DONE_EVENT);
+  ASSERT_SC(sc);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_concurrent_access(void)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_id workers [WORKER_COUNT];
+  size_t i;
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      INIT_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_TIMESLICE,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &workers [i]
+    );
+    ASSERT_SC(sc);
+
+    sc = rtems_task_start(workers [i], worker_task, i);
+    ASSERT_SC(sc);
+  }
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_event_receive(
+      DONE_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    ASSERT_SC(sc);
+  }
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_task_delete(workers [i]);
+    ASSERT_SC(sc);
+  }
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+
+  check_disk_area(WORKER_ROUNDS);
+}
+
+static void test_set_block_size(void)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum block;
+
+  sc = rtems_bdbuf_set_block_size(dd, 2 * MEDIA_BLOCK_SIZE, true);
+  ASSERT_SC(sc);
+
+  for (block = 0; block < MEDIA_BLOCK_COUNT / 2; ++block) {
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    ASSERT_SC(sc);
+
+    rtems_test_assert(bd->buffer [0] == pattern(2 * block, WORKER_ROUNDS));
+    rtems_test_assert(
+      bd->buffer [MEDIA_BLOCK_SIZE] == pattern(2 * block + 1, WORKER_ROUNDS)
+    );
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+
+  sc = rtems_bdbuf_set_block_size(dd, MEDIA_BLOCK_SIZE, true);
+  ASSERT_SC(sc);
+}
+
+static void test(void)
+{
+  static const char device [] = "/dev/rda";
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  main_task = rtems_task_self();
+
+  sc = rtems_disk_io_initialize();
+  ASSERT_SC(sc);
+
+  rd = ramdisk_allocate(
+    disk_area,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    false
+  );
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  test_write_and_read_back();
+  test_read_ahead();
+  test_concurrent_access();
+  test_set_block_size();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE (2 * MEDIA_BLOCK_SIZE)
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (CACHE_BLOCK_COUNT * MEDIA_BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 4
+#define CONFIGURE_BDBUF_CACHE_SHARDS CACHE_SHARDS
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
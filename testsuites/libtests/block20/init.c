@@ -0,0 +1,190 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/ramdisk.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 64
+
+#define CACHE_BLOCK_COUNT 16
+
+#define HOT_BLOCK_COUNT 4
+
+#define SCAN_BLOCK_COUNT (2 * CACHE_BLOCK_COUNT)
+
+/*
+ * The last block of the scan recycled for another block of the scan.
+ */
+#define LAST_RECYCLED_BLOCK \
+  (HOT_BLOCK_COUNT + SCAN_BLOCK_COUNT - 1 \
+    - (CACHE_BLOCK_COUNT - HOT_BLOCK_COUNT))
+
+static unsigned char disk_area [MEDIA_BLOCK_COUNT * MEDIA_BLOCK_SIZE];
+
+static rtems_disk_device *dd;
+
+static void read_block(rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(bd->block == block);
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+}
+
+static void read_blocks(rtems_blkdev_bnum begin, rtems_blkdev_bnum end)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    read_block(block);
+  }
+}
+
+static void test_scan_resistance(void)
+{
+  rtems_blkdev_stats stats;
+
+  /* Use the hot blocks twice */
+  read_blocks(0, HOT_BLOCK_COUNT);
+  read_blocks(0, HOT_BLOCK_COUNT);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == HOT_BLOCK_COUNT);
+  rtems_test_assert(stats.read_hits == HOT_BLOCK_COUNT);
+
+  rtems_bdbuf_reset_device_stats(dd);
+
+  /* Scan twice the cache size, this must not recycle the hot blocks */
+  read_blocks(HOT_BLOCK_COUNT, HOT_BLOCK_COUNT + SCAN_BLOCK_COUNT);
+  read_blocks(0, HOT_BLOCK_COUNT);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == SCAN_BLOCK_COUNT);
+  rtems_test_assert(stats.read_hits == HOT_BLOCK_COUNT);
+  rtems_test_assert(stats.ghost_hits == 0);
+}
+
+static void test_ghost_hit(void)
+{
+  rtems_blkdev_stats stats;
+
+  rtems_bdbuf_reset_device_stats(dd);
+
+  read_block(LAST_RECYCLED_BLOCK);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 1);
+  rtems_test_assert(stats.read_hits == 0);
+  rtems_test_assert(stats.ghost_hits == 1);
+
+  /* The block is hot now */
+  read_blocks(0, HOT_BLOCK_COUNT);
+  read_block(LAST_RECYCLED_BLOCK);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 1);
+  rtems_test_assert(stats.read_hits == HOT_BLOCK_COUNT + 1);
+}
+
+static void test(void)
+{
+  static const char device [] = "/dev/rda";
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  sc = rtems_disk_io_initialize();
+  ASSERT_SC(sc);
+
+  rd = ramdisk_allocate(
+    disk_area,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    false
+  );
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  test_scan_resistance();
+  test_ghost_hit();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE \
+  (CACHE_BLOCK_COUNT * MEDIA_BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
+#define CONFIGURE_BDBUF_REPLACEMENT_POLICY RTEMS_BDBUF_REPLACEMENT_ARC
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,164 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/ramdisk.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 64
+
+#define MAX_READ_AHEAD_BLOCKS 8
+
+#define STREAM_COUNT 2
+
+#define STREAM_LENGTH 24
+
+#define STREAM_DISTANCE (MEDIA_BLOCK_COUNT / STREAM_COUNT)
+
+/*
+ * The read-ahead task must be able to preempt the reading task.
+ */
+#define INIT_PRIORITY (RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT + 5)
+
+static unsigned char disk_area [MEDIA_BLOCK_COUNT * MEDIA_BLOCK_SIZE];
+
+static rtems_disk_device *dd;
+
+static void read_block(rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(bd->block == block);
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+}
+
+static void test_interleaved_streams(void)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum i;
+  size_t s;
+
+  for (i = 0; i < STREAM_LENGTH; ++i) {
+    for (s = 0; s < STREAM_COUNT; ++s) {
+      read_block(s * STREAM_DISTANCE + i);
+    }
+  }
+
+  /*
+   * Each stream starts with a miss and the miss of the next block triggers
+   * the first read-ahead request.  All other blocks are read ahead.
+   */
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 2 * STREAM_COUNT);
+  rtems_test_assert(
+    stats.read_hits == STREAM_COUNT * STREAM_LENGTH - 2 * STREAM_COUNT
+  );
+  rtems_test_assert(stats.read_ahead_transfers > 0);
+  rtems_test_assert(stats.read_ahead_wasted == 0);
+
+  for (s = 0; s < STREAM_COUNT; ++s) {
+    rtems_test_assert(dd->read_ahead [s].window == MAX_READ_AHEAD_BLOCKS);
+  }
+}
+
+static void test(void)
+{
+  static const char device [] = "/dev/rda";
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  sc = rtems_disk_io_initialize();
+  ASSERT_SC(sc);
+
+  rd = ramdisk_allocate(
+    disk_area,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    false
+  );
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  test_interleaved_streams();
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE \
+  (MEDIA_BLOCK_COUNT * MEDIA_BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS MAX_READ_AHEAD_BLOCKS
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,233 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 22";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define BLOCK_COUNT 20
+
+#define CACHE_BLOCK_COUNT 16
+
+#define DIRTY_RATIO 50
+
+#define SWAP_PERIOD 10
+
+static rtems_blkdev_bnum written_blocks [BLOCK_COUNT];
+
+static size_t written_block_count;
+
+static size_t write_request_count;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+
+    ++write_request_count;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_test_assert(written_block_count < BLOCK_COUNT);
+      written_blocks [written_block_count] = breq->bufs [i].block;
+      ++written_block_count;
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void check_write_request(
+  const rtems_blkdev_bnum *expected_blocks,
+  size_t expected_block_count
+)
+{
+  rtems_test_assert(write_request_count == 1);
+  rtems_test_assert(written_block_count == expected_block_count);
+  rtems_test_assert(
+    memcmp(
+      written_blocks,
+      expected_blocks,
+      expected_block_count * sizeof(expected_blocks [0])
+    ) == 0
+  );
+
+  write_request_count = 0;
+  written_block_count = 0;
+}
+
+static rtems_bdbuf_buffer *get_block(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block
+)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  ASSERT_SC(sc);
+
+  return bd;
+}
+
+static void modify_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+
+  sc = rtems_bdbuf_release_modified(get_block(dd, block));
+  ASSERT_SC(sc);
+}
+
+static void test_merge(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_bnum expected [] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < 8; ++block) {
+    if (block != 4) {
+      modify_block(dd, block);
+    }
+  }
+
+  /*
+   * The hold timers of the modified neighbours did not expire, they are
+   * written together with the synchronized block anyway.
+   */
+  sc = rtems_bdbuf_sync(get_block(dd, 4));
+  ASSERT_SC(sc);
+
+  check_write_request(expected, RTEMS_ARRAY_SIZE(expected));
+  rtems_test_assert(dd->write_position == 8);
+}
+
+static void test_elevator(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_bnum expected [] = { 9, 12, 1 };
+  rtems_status_code sc;
+
+  modify_block(dd, 1);
+  modify_block(dd, 9);
+  modify_block(dd, 12);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+
+  check_write_request(expected, RTEMS_ARRAY_SIZE(expected));
+  rtems_test_assert(dd->write_position == 2);
+}
+
+static void test_dirty_ratio(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_bnum expected [] = { 2, 0 };
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+
+  rtems_bdbuf_purge_dev(dd);
+
+  /*
+   * The swapout task has a lower priority, so it sees all ten modified blocks
+   * in one pass.  The limit is eight blocks, so the two oldest blocks are
+   * written long before their hold timers expire.
+   */
+  for (block = 0; block < BLOCK_COUNT; block += 2) {
+    modify_block(dd, block);
+  }
+
+  sc = rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(10 * SWAP_PERIOD));
+  ASSERT_SC(sc);
+
+  check_write_request(expected, RTEMS_ARRAY_SIZE(expected));
+  rtems_test_assert(dd->write_position == 1);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_io_initialize();
+  ASSERT_SC(sc);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  ASSERT_SC(sc);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_merge(dd);
+  test_elevator(dd);
+  test_dirty_ratio(dd);
+
+  rtems_bdbuf_purge_dev(dd);
+
+  sc = rtems_disk_release(dd);
+  ASSERT_SC(sc);
+
+  sc = rtems_disk_delete(dev);
+  ASSERT_SC(sc);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAP_PERIOD
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD 60000
+#define CONFIGURE_SWAPOUT_DIRTY_RATIO DIRTY_RATIO
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
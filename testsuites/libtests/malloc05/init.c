@@ -0,0 +1,211 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/malloc.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define BLOCK_COUNT ( 2 * RTEMS_MALLOC_CACHE_CAPACITY )
+
+static void *blocks[ BLOCK_COUNT ];
+
+static void get_info( rtems_malloc_cache_information *info )
+{
+  int rv;
+
+  rv = malloc_cache_info( info );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_info( void )
+{
+  int rv;
+
+  rv = malloc_cache_info( NULL );
+  rtems_test_assert( rv == -1 );
+}
+
+static void test_hit( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  void *p;
+  void *q;
+
+  p = malloc( 24 );
+  rtems_test_assert( p != NULL );
+
+  get_info( &before );
+  free( p );
+  get_info( &after );
+  rtems_test_assert( after.free_hits == before.free_hits + 1 );
+  rtems_test_assert( after.cached_blocks == before.cached_blocks + 1 );
+
+  q = malloc( 24 );
+  rtems_test_assert( q == p );
+  get_info( &before );
+  rtems_test_assert( before.alloc_hits == after.alloc_hits + 1 );
+  rtems_test_assert( before.cached_blocks == after.cached_blocks - 1 );
+
+  free( q );
+}
+
+static void test_double_free( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  void *p;
+
+  p = malloc( 24 );
+  rtems_test_assert( p != NULL );
+  free( p );
+
+  /* The second free is reported and ignored */
+  get_info( &before );
+  free( p );
+  get_info( &after );
+  rtems_test_assert( after.free_hits == before.free_hits );
+  rtems_test_assert( after.cached_blocks == before.cached_blocks );
+
+  p = malloc( 24 );
+  rtems_test_assert( p != NULL );
+
+  /* An allocated block may contain the in-cache marker by chance */
+  ( (uintptr_t *) p )[ 1 ] = (uintptr_t) p ^ UINT32_C( 0x4d434348 );
+
+  get_info( &before );
+  free( p );
+  get_info( &after );
+  rtems_test_assert( after.free_hits == before.free_hits + 1 );
+  rtems_test_assert( after.cached_blocks == before.cached_blocks + 1 );
+}
+
+static void test_refill_and_drain( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  size_t i;
+
+  rtems_malloc_cache_flush();
+  get_info( &before );
+  rtems_test_assert( before.cached_blocks == 0 );
+  rtems_test_assert( before.cached_bytes == 0 );
+
+  blocks[ 0 ] = malloc( 100 );
+  rtems_test_assert( blocks[ 0 ] != NULL );
+  get_info( &after );
+  rtems_test_assert( after.alloc_misses == before.alloc_misses + 1 );
+  rtems_test_assert( after.cached_blocks == RTEMS_MALLOC_CACHE_BATCH - 1 );
+  rtems_test_assert(
+    after.cached_bytes == ( RTEMS_MALLOC_CACHE_BATCH - 1 ) * 128
+  );
+
+  for ( i = 1; i < BLOCK_COUNT; ++i ) {
+    blocks[ i ] = malloc( 100 );
+    rtems_test_assert( blocks[ i ] != NULL );
+    memset( blocks[ i ], 0xff, 100 );
+  }
+
+  get_info( &before );
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    free( blocks[ i ] );
+  }
+
+  get_info( &after );
+  rtems_test_assert( after.free_misses > before.free_misses );
+  rtems_test_assert(
+    after.cached_blocks
+      <= RTEMS_MALLOC_CACHE_CLASS_COUNT * RTEMS_MALLOC_CACHE_CAPACITY
+  );
+
+  rtems_malloc_cache_flush();
+  get_info( &after );
+  rtems_test_assert( after.cached_blocks == 0 );
+}
+
+static void test_large( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  void *p;
+
+  get_info( &before );
+
+  p = malloc( 4096 );
+  rtems_test_assert( p != NULL );
+  free( p );
+
+  get_info( &after );
+  rtems_test_assert( memcmp( &before, &after, sizeof( before ) ) == 0 );
+}
+
+static void test_no_memory( void )
+{
+  Heap_Information_block info;
+  void *p;
+  size_t i;
+
+  rtems_malloc_cache_flush();
+  malloc_info( &info );
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    blocks[ i ] = malloc( 200 );
+    rtems_test_assert( blocks[ i ] != NULL );
+  }
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    free( blocks[ i ] );
+  }
+
+  /*
+   * The largest free block may be held by the cache.  The allocation must
+   * flush the cache to succeed.
+   */
+  p = malloc( info.Free.largest - 2 * sizeof( uintptr_t ) );
+  rtems_test_assert( p != NULL );
+  free( p );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_info();
+  test_hit();
+  test_double_free();
+  test_refill_and_drain();
+  test_large();
+  test_no_memory();
+
+  TEST_END();
+
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
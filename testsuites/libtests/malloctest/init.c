@@ -1243,6 +1243,79 @@ static void test_greedy_allocate(void)
   rtems_test_assert( p == NULL );
 }
 
+static void test_segregated_fit(void)
+{
+  static uint8_t area[ 16384 ];
+  static uint8_t extend_area[ 4096 ];
+  Heap_Control heap;
+  Heap_Information_block info;
+  void *p[ 32 ];
+  uintptr_t size;
+  bool ok;
+  size_t i;
+
+  size = _Heap_Initialize_segregated_fit( &heap, area, 4, 0 );
+  rtems_test_assert( size == 0 );
+
+  size = _Heap_Initialize_segregated_fit( &heap, area, sizeof( area ), 0 );
+  rtems_test_assert( size > 0 );
+  rtems_test_assert( _Heap_Is_segregated_fit( &heap ) );
+  rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    p[ i ] = _Heap_Allocate_aligned_with_boundary(
+      &heap,
+      1 + 13 * i,
+      ( i % 3 ) == 0 ? 64 : 0,
+      ( i % 5 ) == 0 ? 1024 : 0
+    );
+    rtems_test_assert( p[ i ] != NULL );
+    rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+  }
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); i += 2 ) {
+    ok = _Heap_Free( &heap, p[ i ] );
+    rtems_test_assert( ok );
+    rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+  }
+
+  for ( i = 1; i < RTEMS_ARRAY_SIZE( p ); i += 2 ) {
+    uintptr_t old_size;
+    uintptr_t new_size;
+
+    _Heap_Resize_block( &heap, p[ i ], 8, &old_size, &new_size );
+    rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+  }
+
+  for ( i = 1; i < RTEMS_ARRAY_SIZE( p ); i += 2 ) {
+    ok = _Heap_Free( &heap, p[ i ] );
+    rtems_test_assert( ok );
+    rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+  }
+
+  _Heap_Get_information( &heap, &info );
+  rtems_test_assert( info.Used.number == 0 );
+  rtems_test_assert( info.Free.number == 1 );
+
+  size = _Heap_Extend( &heap, extend_area, sizeof( extend_area ), 0 );
+  rtems_test_assert( size > 0 );
+  rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+
+  p[ 0 ] = _Heap_Allocate(
+    &heap,
+    info.Free.largest - HEAP_BLOCK_HEADER_SIZE
+  );
+  rtems_test_assert( p[ 0 ] != NULL );
+  p[ 1 ] = _Heap_Allocate( &heap, 2048 );
+  rtems_test_assert( p[ 1 ] != NULL );
+  rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+  ok = _Heap_Free( &heap, p[ 0 ] );
+  rtems_test_assert( ok );
+  ok = _Heap_Free( &heap, p[ 1 ] );
+  rtems_test_assert( ok );
+  rtems_test_assert( _Heap_Walk( &heap, 0, false ) );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -1296,6 +1369,7 @@ rtems_task Init(
   test_protected_heap_info();
   test_rtems_heap_allocate_aligned_with_boundary();
   test_greedy_allocate();
+  test_segregated_fit();
 
   test_posix_memalign();
 
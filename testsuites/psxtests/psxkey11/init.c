@@ -0,0 +1,148 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+
+#include <rtems/score/thread.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PSXKEY 11";
+
+#define KEY_COUNT (THREAD_KEYS_SLOT_COUNT + 2)
+
+static pthread_key_t keys[KEY_COUNT];
+
+static int values[KEY_COUNT];
+
+static void set_all(void)
+{
+  size_t i;
+
+  for (i = 0; i < KEY_COUNT; ++i) {
+    int eno;
+
+    eno = pthread_setspecific(keys[i], &values[i]);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static void check_all(void)
+{
+  size_t i;
+
+  for (i = 0; i < KEY_COUNT; ++i) {
+    rtems_test_assert(pthread_getspecific(keys[i]) == &values[i]);
+  }
+}
+
+static void test_slots_and_tree(void)
+{
+  size_t i;
+  int eno;
+
+  for (i = 0; i < KEY_COUNT; ++i) {
+    eno = pthread_key_create(&keys[i], NULL);
+    rtems_test_assert(eno == 0);
+    rtems_test_assert(pthread_getspecific(keys[i]) == NULL);
+  }
+
+  set_all();
+  check_all();
+
+  /* Overwrite existing values */
+  set_all();
+  check_all();
+
+  /* Remove the values of one slot key and one tree key */
+  eno = pthread_setspecific(keys[0], NULL);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(pthread_getspecific(keys[0]) == NULL);
+
+  eno = pthread_setspecific(keys[KEY_COUNT - 1], NULL);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(pthread_getspecific(keys[KEY_COUNT - 1]) == NULL);
+
+  set_all();
+  check_all();
+}
+
+static void test_stale_key(void)
+{
+  pthread_key_t old_key;
+  pthread_key_t new_key;
+  int eno;
+
+  old_key = keys[1];
+  eno = pthread_key_delete(old_key);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(pthread_getspecific(old_key) == NULL);
+
+  /* The new key reuses the object index of the old key */
+  eno = pthread_key_create(&new_key, NULL);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(new_key != old_key);
+  rtems_test_assert(pthread_getspecific(new_key) == NULL);
+
+  eno = pthread_setspecific(new_key, &values[1]);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(pthread_getspecific(new_key) == &values[1]);
+  rtems_test_assert(pthread_getspecific(old_key) == NULL);
+
+  eno = pthread_setspecific(old_key, &values[0]);
+  rtems_test_assert(eno == EINVAL);
+  rtems_test_assert(pthread_getspecific(new_key) == &values[1]);
+
+  keys[1] = new_key;
+  check_all();
+}
+
+static void test_delete_all(void)
+{
+  size_t i;
+
+  for (i = 0; i < KEY_COUNT; ++i) {
+    int eno;
+
+    eno = pthread_key_delete(keys[i]);
+    rtems_test_assert(eno == 0);
+    rtems_test_assert(pthread_getspecific(keys[i]) == NULL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_slots_and_tree();
+  test_stale_key();
+  test_delete_all();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_KEYS KEY_COUNT
+
+#define CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS KEY_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
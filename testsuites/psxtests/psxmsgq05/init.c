@@ -0,0 +1,485 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <mqueue.h>
+#include <string.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PSXMSGQ 5";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 64
+
+#define PRIO_LOW 1
+
+#define PRIO_HIGH 2
+
+#define EVENT_RECEIVE RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+#define ZERO_COPY_NAME "/zero-copy"
+
+#define COPY_NAME "/copy"
+
+#define READ_ONLY_NAME "/read-only"
+
+typedef struct {
+  rtems_id master;
+  rtems_id worker;
+  mqd_t zero_copy_queue;
+  mqd_t copy_queue;
+  void *received_buffer;
+  ssize_t received_size;
+  unsigned int received_prio;
+} test_context;
+
+static test_context test_instance;
+
+static void send_events(rtems_id id, rtems_event_set events)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send(id, events);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_events(rtems_event_set events)
+{
+  rtems_status_code sc;
+  rtems_event_set received;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == events);
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    wait_for_events(EVENT_RECEIVE);
+
+    ctx->received_size = mq_receive_buffer_np(
+      ctx->zero_copy_queue,
+      &ctx->received_buffer,
+      &ctx->received_prio
+    );
+
+    send_events(ctx->master, EVENT_DONE);
+  }
+}
+
+static mqd_t open_queue(const char *name, int oflag, long flags)
+{
+  struct mq_attr attr;
+  mqd_t mq;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.mq_flags = flags;
+  attr.mq_maxmsg = MESSAGE_COUNT;
+  attr.mq_msgsize = MESSAGE_SIZE;
+
+  mq = mq_open(name, O_CREAT | O_EXCL | oflag, 0777, &attr);
+  rtems_test_assert(mq != (mqd_t) -1);
+
+  return mq;
+}
+
+static void close_queue(const char *name, mqd_t mq)
+{
+  int rv;
+
+  rv = mq_close(mq);
+  rtems_test_assert(rv == 0);
+
+  rv = mq_unlink(name);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_buffer(test_context *ctx, void **buffer)
+{
+  int rv;
+
+  *buffer = NULL;
+  rv = mq_get_buffer_np(ctx->zero_copy_queue, buffer);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(*buffer != NULL);
+}
+
+static void release_buffer(test_context *ctx, void *buffer)
+{
+  int rv;
+
+  rv = mq_release_buffer_np(ctx->zero_copy_queue, buffer);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_attributes(test_context *ctx)
+{
+  struct mq_attr attr;
+  int rv;
+
+  rv = mq_getattr(ctx->zero_copy_queue, &attr);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert((attr.mq_flags & MQ_ZERO_COPY) != 0);
+  rtems_test_assert(attr.mq_maxmsg == MESSAGE_COUNT);
+  rtems_test_assert(attr.mq_msgsize == MESSAGE_SIZE);
+
+  rv = mq_getattr(ctx->copy_queue, &attr);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert((attr.mq_flags & MQ_ZERO_COPY) == 0);
+}
+
+static void test_not_zero_copy(test_context *ctx)
+{
+  char buf[MESSAGE_SIZE];
+  void *buffer;
+  ssize_t n;
+  int rv;
+
+  errno = 0;
+  rv = mq_get_buffer_np(ctx->copy_queue, &buffer);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = mq_send_buffer_np(ctx->copy_queue, &buf[0], 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  n = mq_receive_buffer_np(ctx->copy_queue, &buffer, NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = mq_release_buffer_np(ctx->copy_queue, &buf[0]);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* Messages of zero-copy message queues cannot be received by copy */
+  errno = 0;
+  n = mq_receive(ctx->zero_copy_queue, &buf[0], sizeof(buf), NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+}
+
+static void test_invalid(test_context *ctx)
+{
+  char buf[MESSAGE_SIZE];
+  void *buffer;
+  ssize_t n;
+  mqd_t mq;
+  int rv;
+
+  errno = 0;
+  rv = mq_get_buffer_np(ctx->zero_copy_queue, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, NULL, NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = mq_get_buffer_np((mqd_t) -1, &buffer);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  rv = mq_send_buffer_np((mqd_t) -1, &buf[0], 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  n = mq_receive_buffer_np((mqd_t) -1, &buffer, NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  rv = mq_release_buffer_np((mqd_t) -1, &buf[0]);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  /* Only message buffers of the message queue are accepted */
+  errno = 0;
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, &buf[0], 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = mq_release_buffer_np(ctx->zero_copy_queue, &buf[0]);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  get_buffer(ctx, &buffer);
+
+  errno = 0;
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, buffer, 1, MQ_PRIO_MAX + 1);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  release_buffer(ctx, buffer);
+
+  /* The access mode of the message queue is checked */
+  mq = open_queue(READ_ONLY_NAME, O_RDONLY, MQ_ZERO_COPY);
+
+  errno = 0;
+  rv = mq_get_buffer_np(mq, &buffer);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  rv = mq_send_buffer_np(mq, &buf[0], 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  close_queue(READ_ONLY_NAME, mq);
+}
+
+static void test_message_size(test_context *ctx)
+{
+  char buf[MESSAGE_SIZE + 1];
+  void *buffer;
+  unsigned int prio;
+  ssize_t n;
+  int rv;
+
+  get_buffer(ctx, &buffer);
+
+  /* The sender keeps the ownership of a buffer with an invalid size */
+  errno = 0;
+  rv = mq_send_buffer_np(
+    ctx->zero_copy_queue,
+    buffer,
+    MESSAGE_SIZE + 1,
+    PRIO_LOW
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EMSGSIZE);
+
+  memset(buffer, 'b', MESSAGE_SIZE);
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, buffer, MESSAGE_SIZE, PRIO_LOW);
+  rtems_test_assert(rv == 0);
+
+  buffer = NULL;
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, &buffer, &prio);
+  rtems_test_assert(n == MESSAGE_SIZE);
+  rtems_test_assert(buffer != NULL);
+  rtems_test_assert(prio == PRIO_LOW);
+  rtems_test_assert(((char *) buffer)[MESSAGE_SIZE - 1] == 'b');
+
+  release_buffer(ctx, buffer);
+
+  /* A copy send must fit into a message buffer */
+  memset(&buf[0], 'c', sizeof(buf));
+
+  errno = 0;
+  rv = mq_send(ctx->zero_copy_queue, &buf[0], MESSAGE_SIZE + 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EMSGSIZE);
+
+  rv = mq_send(ctx->zero_copy_queue, &buf[0], MESSAGE_SIZE, PRIO_LOW);
+  rtems_test_assert(rv == 0);
+
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, &buffer, NULL);
+  rtems_test_assert(n == MESSAGE_SIZE);
+  rtems_test_assert(memcmp(buffer, &buf[0], MESSAGE_SIZE) == 0);
+
+  release_buffer(ctx, buffer);
+
+  /* The receive buffer size is checked before the zero-copy check */
+  errno = 0;
+  n = mq_receive(ctx->zero_copy_queue, &buf[0], MESSAGE_SIZE - 1, NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EMSGSIZE);
+}
+
+static void test_exhaustion(test_context *ctx)
+{
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+  size_t i;
+  int rv;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    get_buffer(ctx, &buffers[i]);
+  }
+
+  errno = 0;
+  rv = mq_get_buffer_np(ctx->zero_copy_queue, &buffer);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  /* Senders do not block on zero-copy message queues */
+  errno = 0;
+  rv = mq_send(ctx->zero_copy_queue, "x", 1, PRIO_LOW);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    release_buffer(ctx, buffers[i]);
+  }
+
+  get_buffer(ctx, &buffer);
+  release_buffer(ctx, buffer);
+}
+
+static void test_pending(test_context *ctx)
+{
+  void *low;
+  void *high;
+  void *buffer;
+  unsigned int prio;
+  ssize_t n;
+  int rv;
+
+  get_buffer(ctx, &low);
+  get_buffer(ctx, &high);
+  rtems_test_assert(low != high);
+
+  memset(low, 'l', 2);
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, low, 2, PRIO_LOW);
+  rtems_test_assert(rv == 0);
+
+  memset(high, 'h', 3);
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, high, 3, PRIO_HIGH);
+  rtems_test_assert(rv == 0);
+
+  /* The receiver obtains the buffers of the sender in priority order */
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, &buffer, &prio);
+  rtems_test_assert(n == 3);
+  rtems_test_assert(buffer == high);
+  rtems_test_assert(prio == PRIO_HIGH);
+  rtems_test_assert(((char *) buffer)[2] == 'h');
+
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, &buffer, &prio);
+  rtems_test_assert(n == 2);
+  rtems_test_assert(buffer == low);
+  rtems_test_assert(prio == PRIO_LOW);
+  rtems_test_assert(((char *) buffer)[1] == 'l');
+
+  /* A received buffer may be sent again */
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, low, 1, PRIO_LOW);
+  rtems_test_assert(rv == 0);
+
+  n = mq_receive_buffer_np(ctx->zero_copy_queue, &buffer, NULL);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(buffer == low);
+
+  release_buffer(ctx, low);
+  release_buffer(ctx, high);
+}
+
+static void test_waiting_receiver(test_context *ctx)
+{
+  void *buffer;
+  int rv;
+
+  /* The worker has a higher priority and blocks on the empty queue */
+  send_events(ctx->worker, EVENT_RECEIVE);
+
+  get_buffer(ctx, &buffer);
+  memset(buffer, 'w', 4);
+
+  rv = mq_send_buffer_np(ctx->zero_copy_queue, buffer, 4, PRIO_HIGH);
+  rtems_test_assert(rv == 0);
+
+  wait_for_events(EVENT_DONE);
+  rtems_test_assert(ctx->received_size == 4);
+  rtems_test_assert(ctx->received_buffer == buffer);
+  rtems_test_assert(ctx->received_prio == PRIO_HIGH);
+  rtems_test_assert(((char *) buffer)[3] == 'w');
+
+  release_buffer(ctx, buffer);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  ctx->master = rtems_task_self();
+  ctx->zero_copy_queue = open_queue(ZERO_COPY_NAME, O_RDWR, MQ_ZERO_COPY);
+  ctx->copy_queue = open_queue(COPY_NAME, O_RDWR | O_NONBLOCK, 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker, worker, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_attributes(ctx);
+  test_not_zero_copy(ctx);
+  test_invalid(ctx);
+  test_message_size(ctx);
+  test_exhaustion(ctx);
+  test_pending(ctx);
+  test_waiting_receiver(ctx);
+
+  sc = rtems_task_delete(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  close_queue(COPY_NAME, ctx->copy_queue);
+  close_queue(ZERO_COPY_NAME, ctx->zero_copy_queue);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 3
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  (3 * CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE))
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,148 @@
+/*
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <mqueue.h>
+#include <stdio.h>
+#include <timesys.h>
+#include <rtems/btimer.h>
+#include "test_support.h"
+#include <tmacros.h>
+
+const char rtems_test_name[] = "PSXTMMQ 02";
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+#define MQ_MAXMSG     (256 + 1)
+#define MQ_MSGSIZE    sizeof(int)
+
+#define PRIORITY_COUNT 32
+
+static const int depths[] = { 1, 16, 64, 256 };
+
+static mqd_t queue;
+
+static unsigned int message_priority(int i)
+{
+  /* Spread the messages over all priorities */
+  return (unsigned int) ((i * 13) % PRIORITY_COUNT);
+}
+
+static void send_message(int i)
+{
+  int status;
+
+  status = mq_send(queue, (const char *) &i, MQ_MSGSIZE, message_priority(i));
+  rtems_test_assert(status == 0);
+}
+
+static void receive_message(void)
+{
+  ssize_t      n;
+  unsigned int priority;
+  int          message;
+
+  n = mq_receive(queue, (char *) &message, MQ_MSGSIZE, &priority);
+  rtems_test_assert(n == (ssize_t) MQ_MSGSIZE);
+  rtems_test_assert(priority == message_priority(message));
+}
+
+static void benchmark_depth(int depth)
+{
+  benchmark_timer_t send_time;
+  benchmark_timer_t receive_time;
+  char              name[64];
+  int               i;
+
+  for (i = 0; i < depth - 1; ++i) {
+    send_message(i);
+  }
+
+  send_time = 0;
+  receive_time = 0;
+
+  /* Keep the queue depth between depth - 1 and depth */
+  for (i = 0; i < OPERATION_COUNT; ++i) {
+    benchmark_timer_initialize();
+      send_message(depth + i);
+    send_time += benchmark_timer_read();
+
+    benchmark_timer_initialize();
+      receive_message();
+    receive_time += benchmark_timer_read();
+  }
+
+  for (i = 0; i < depth - 1; ++i) {
+    receive_message();
+  }
+
+  snprintf(
+    name,
+    sizeof(name),
+    "mq_send: no threads waiting: depth %d",
+    depth
+  );
+  put_time(name, send_time, OPERATION_COUNT, 0, 0);
+
+  snprintf(
+    name,
+    sizeof(name),
+    "mq_receive: available: depth %d",
+    depth
+  );
+  put_time(name, receive_time, OPERATION_COUNT, 0, 0);
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  struct mq_attr attr;
+  size_t         i;
+  int            status;
+
+  TEST_BEGIN();
+
+  attr.mq_maxmsg  = MQ_MAXMSG;
+  attr.mq_msgsize = MQ_MSGSIZE;
+  queue = mq_open("queue", O_CREAT | O_RDWR, 0x777, &attr);
+  rtems_test_assert(queue != (-1));
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(depths); ++i) {
+    benchmark_depth(depths[i]);
+  }
+
+  status = mq_close(queue);
+  rtems_test_assert(status == 0);
+
+  status = mq_unlink("queue");
+  rtems_test_assert(status == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     1
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES  1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MQ_MAXMSG, MQ_MSGSIZE)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
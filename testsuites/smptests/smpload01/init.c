@@ -27,7 +27,11 @@
 #include <rtems/score/smpbarrier.h>
 #include <rtems/score/smplock.h>
 
+#if defined(SMPLOAD02)
+const char rtems_test_name[] = "SMPLOAD 2";
+#else
 const char rtems_test_name[] = "SMPLOAD 1";
+#endif
 
 #define CPU_COUNT 32
 
@@ -394,6 +398,10 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
 
+#if defined(SMPLOAD02)
+#define CONFIGURE_SCHEDULER_PRIORITY_LOCAL_SMP
+#endif
+
 #define CONFIGURE_MAXIMUM_TASKS \
   (1 + MAX_INHERIT_OBTAIN_COUNT + 1 + 1 + SEM_WORKER_COUNT)
 
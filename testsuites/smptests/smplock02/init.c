@@ -0,0 +1,321 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smplock.h>
+#include <rtems/score/smplockmcs.h>
+#include <rtems/score/smplockticket.h>
+#include <rtems/score/threadqimpl.h>
+#include <rtems/test.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPLOCK 2";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 4
+
+#define DATA_LINE_COUNT 4
+
+typedef struct {
+  unsigned long value RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+} test_data_line;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+  SMP_ticket_lock_Control ticket_lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats ticket_stats;
+#endif
+  SMP_MCS_lock_Control mcs_lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats mcs_stats;
+#endif
+  SMP_lock_Control lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+  Thread_queue_Control queue RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+  test_data_line data[TEST_COUNT][DATA_LINE_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .ticket_lock = SMP_TICKET_LOCK_INITIALIZER,
+#if defined(RTEMS_PROFILING)
+  .ticket_stats = SMP_LOCK_STATS_INITIALIZER("global ticket"),
+#endif
+  .mcs_lock = SMP_MCS_LOCK_INITIALIZER,
+#if defined(RTEMS_PROFILING)
+  .mcs_stats = SMP_LOCK_STATS_INITIALIZER("global MCS"),
+#endif
+  .lock = SMP_LOCK_INITIALIZER("global SMP lock"),
+  .queue = THREAD_QUEUE_INITIALIZER("global thread queue")
+};
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void critical_section(test_context *ctx, size_t test)
+{
+  size_t i;
+
+  for (i = 0; i < DATA_LINE_COUNT; ++i) {
+    ++ctx->data[test][i].value;
+  }
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long sum = 0;
+  unsigned long n = active_workers;
+  unsigned long i;
+
+  printf("  <%s activeWorker=\"%lu\">\n", name, n);
+
+  for (i = 0; i < n; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "    <LocalCounter worker=\"%lu\">%lu</LocalCounter>\n",
+      i,
+      local_counter
+    );
+  }
+
+  printf(
+    "    <SumOfLocalCounter>%lu</SumOfLocalCounter>\n"
+    "  </%s>\n",
+    sum,
+    name
+  );
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 0;
+  unsigned long counter = 0;
+  SMP_lock_Stats_context stats_context;
+  ISR_Level level;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _ISR_Local_disable(level);
+    _SMP_ticket_lock_Acquire(
+      &ctx->ticket_lock,
+      &ctx->ticket_stats,
+      &stats_context
+    );
+    critical_section(ctx, test);
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &stats_context);
+    _ISR_Local_enable(level);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "TicketLock", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 1;
+  unsigned long counter = 0;
+  SMP_MCS_lock_Context lock_context;
+  ISR_Level level;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _ISR_Local_disable(level);
+    _SMP_MCS_lock_Acquire(&ctx->mcs_lock, &lock_context, &ctx->mcs_stats);
+    critical_section(ctx, test);
+    _SMP_MCS_lock_Release(&ctx->mcs_lock, &lock_context);
+    _ISR_Local_enable(level);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "MCSLock", 1, active_workers);
+}
+
+static void test_2_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 2;
+  unsigned long counter = 0;
+  SMP_lock_Context lock_context;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _SMP_lock_ISR_disable_and_acquire(&ctx->lock, &lock_context);
+    critical_section(ctx, test);
+    _SMP_lock_Release_and_ISR_enable(&ctx->lock, &lock_context);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_2_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "SMPLock", 2, active_workers);
+}
+
+static void test_3_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 3;
+  unsigned long counter = 0;
+  Thread_queue_Context queue_context;
+
+  _Thread_queue_Context_initialize(&queue_context);
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _Thread_queue_Acquire(&ctx->queue, &queue_context);
+    critical_section(ctx, test);
+    _Thread_queue_Release(&ctx->queue, &queue_context);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_3_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "ThreadQueueLock", 3, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_2_body,
+    .fini = test_2_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_3_body,
+    .fini = test_3_fini,
+    .cascade = true
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPLock02";
+#if defined(RTEMS_SMP_MCS_LOCKS)
+  const char *implementation = "MCS";
+#else
+  const char *implementation = "Ticket";
+#endif
+
+  printf("<%s implementation=\"%s\">\n", test, implementation);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,267 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/mpscring.h>
+#include <rtems/score/smpbarrier.h>
+
+const char rtems_test_name[] = "SMPMPSCRING 1";
+
+#define CPU_COUNT 4
+
+#define PRODUCER_COUNT_MAX (CPU_COUNT - 1)
+
+#define SLOT_COUNT 16
+
+#define BURST 8
+
+#define ROUND_COUNT 1000
+
+#define ITEMS_PER_PRODUCER (BURST * ROUND_COUNT)
+
+#define CONSUMER_PRIORITY 2
+
+#define PRODUCER_PRIORITY 3
+
+typedef struct {
+  MPSC_ring_Control ring;
+  MPSC_ring_Slot slots[SLOT_COUNT];
+  rtems_id master_id;
+  rtems_id consumer_id;
+  rtems_id producer_ids[PRODUCER_COUNT_MAX];
+  uint32_t producer_count;
+  SMP_barrier_Control barrier;
+  Atomic_Uint received;
+  volatile bool lost_wake_up;
+  uint32_t next_sequence[PRODUCER_COUNT_MAX];
+} test_context;
+
+static test_context test_instance = {
+  .barrier = SMP_BARRIER_CONTROL_INITIALIZER
+};
+
+static void *encode(uint32_t producer, uint32_t sequence)
+{
+  return (void *) (uintptr_t)
+    (producer * ITEMS_PER_PRODUCER + sequence + 1);
+}
+
+static bool timed_out(rtems_interval start)
+{
+  return rtems_clock_get_ticks_since_boot() - start
+    > rtems_clock_get_ticks_per_second();
+}
+
+static void enqueue(test_context *ctx, void *item)
+{
+  rtems_interval start;
+
+  start = rtems_clock_get_ticks_since_boot();
+
+  /* The ring is full while the consumer is busy */
+  while (!_MPSC_ring_Enqueue(&ctx->ring, item)) {
+    if (timed_out(start)) {
+      ctx->lost_wake_up = true;
+      return;
+    }
+  }
+}
+
+/*
+ * The consumer empties the ring before the producers start the next round,
+ * so it blocks on the ring and the next round must wake it up.  A lost
+ * wake-up would block the consumer forever.
+ */
+static void wait_for_consumer(test_context *ctx, uint32_t expected)
+{
+  rtems_interval start;
+
+  start = rtems_clock_get_ticks_since_boot();
+
+  while (_Atomic_Load_uint(&ctx->received, ATOMIC_ORDER_RELAXED) < expected) {
+    if (timed_out(start)) {
+      ctx->lost_wake_up = true;
+      return;
+    }
+  }
+}
+
+static void producer(rtems_task_argument arg)
+{
+  test_context *ctx;
+  SMP_barrier_State barrier_state;
+  rtems_status_code sc;
+  uint32_t round;
+
+  ctx = &test_instance;
+  _SMP_barrier_State_initialize(&barrier_state);
+
+  for (round = 0; round < ROUND_COUNT && !ctx->lost_wake_up; ++round) {
+    uint32_t i;
+
+    _SMP_barrier_Wait(&ctx->barrier, &barrier_state, ctx->producer_count);
+
+    for (i = 0; i < BURST; ++i) {
+      enqueue(ctx, encode(arg, round * BURST + i));
+    }
+
+    wait_for_consumer(ctx, (round + 1) * BURST * ctx->producer_count);
+  }
+
+  sc = rtems_event_transient_send(ctx->master_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void consumer(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t n;
+  uint32_t i;
+
+  ctx = &test_instance;
+  n = ctx->producer_count * ITEMS_PER_PRODUCER;
+
+  for (i = 0; i < n; ++i) {
+    uintptr_t value;
+    uint32_t producer;
+    uint32_t sequence;
+
+    value = (uintptr_t) _MPSC_ring_Dequeue(&ctx->ring) - 1;
+    producer = value / ITEMS_PER_PRODUCER;
+    sequence = value % ITEMS_PER_PRODUCER;
+
+    /* Each item exactly once and in the enqueue order of its producer */
+    rtems_test_assert(producer < ctx->producer_count);
+    rtems_test_assert(sequence == ctx->next_sequence[producer]);
+    ++ctx->next_sequence[producer];
+
+    _Atomic_Store_uint(&ctx->received, i + 1, ATOMIC_ORDER_RELAXED);
+  }
+
+  sc = rtems_event_transient_send(ctx->master_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void create_task(
+  rtems_id *id,
+  rtems_task_priority priority,
+  rtems_task_entry entry,
+  rtems_task_argument arg
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('M', 'P', 'S', 'C'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(*id, entry, arg);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t cpu_count;
+  uint32_t i;
+
+  ctx->master_id = rtems_task_self();
+  cpu_count = rtems_get_processor_count();
+
+  /* One processor for the consumer, the others for the producers */
+  if (cpu_count > 1) {
+    ctx->producer_count = cpu_count - 1;
+  } else {
+    ctx->producer_count = 1;
+  }
+
+  _MPSC_ring_Initialize(&ctx->ring, ctx->slots, SLOT_COUNT);
+  _Atomic_Init_uint(&ctx->received, 0);
+
+  create_task(&ctx->consumer_id, CONSUMER_PRIORITY, consumer, 0);
+
+  for (i = 0; i < ctx->producer_count; ++i) {
+    create_task(&ctx->producer_ids[i], PRODUCER_PRIORITY, producer, i);
+  }
+
+  for (i = 0; i < ctx->producer_count; ++i) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(!ctx->lost_wake_up);
+
+  sc = rtems_event_transient_receive(
+    RTEMS_WAIT,
+    rtems_clock_get_ticks_per_second()
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(
+    _Atomic_Load_uint(&ctx->received, ATOMIC_ORDER_RELAXED)
+      == ctx->producer_count * ITEMS_PER_PRODUCER
+  );
+
+  for (i = 0; i < ctx->producer_count; ++i) {
+    rtems_test_assert(ctx->next_sequence[i] == ITEMS_PER_PRODUCER);
+
+    sc = rtems_task_delete(ctx->producer_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->consumer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(_MPSC_ring_Try_dequeue(&ctx->ring) == NULL);
+  _MPSC_ring_Destroy(&ctx->ring);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + PRODUCER_COUNT_MAX)
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
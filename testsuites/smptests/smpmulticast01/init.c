@@ -0,0 +1,266 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smpimpl.h>
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMULTICAST 1";
+
+#define CPU_COUNT 32
+
+#define MAX_JOBS_PER_PROCESSOR 16
+
+#define SAMPLE_COUNT 32
+
+typedef struct {
+  uint32_t next[CPU_COUNT];
+  SMP_Multicast_job jobs[CPU_COUNT][MAX_JOBS_PER_PROCESSOR];
+  uint32_t initiator;
+} test_context;
+
+static test_context test_instance;
+
+static void ordered_action(void *arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t self = rtems_get_current_processor();
+
+  rtems_test_assert(ctx->next[self] == (uint32_t) (uintptr_t) arg);
+  ++ctx->next[self];
+}
+
+static void count_action(void *arg)
+{
+  test_context *ctx = arg;
+
+  ++ctx->next[rtems_get_current_processor()];
+}
+
+static void nested_action(void *arg)
+{
+  test_context *ctx = arg;
+
+  if (rtems_get_current_processor() == ctx->initiator) {
+    _SMP_Multicast_action(0, NULL, count_action, ctx);
+  }
+}
+
+static void reset(test_context *ctx)
+{
+  memset(ctx->next, 0, sizeof(ctx->next));
+}
+
+static void check_counts(
+  const test_context *ctx,
+  uint32_t cpu_count,
+  uint32_t expected
+)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_test_assert(ctx->next[cpu_index] == expected);
+  }
+}
+
+static void issue_batch(
+  test_context *ctx,
+  uint32_t cpu_count,
+  uint32_t jobs_per_processor,
+  SMP_Action_handler handler,
+  bool ordered
+)
+{
+  SMP_Multicast_batch batch;
+  uint32_t cpu_index;
+  uint32_t j;
+
+  _SMP_Multicast_batch_initialize(&batch);
+
+  for (j = 0; j < jobs_per_processor; ++j) {
+    for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+      _SMP_Multicast_batch_add(
+        &batch,
+        &ctx->jobs[cpu_index][j],
+        cpu_index,
+        handler,
+        ordered ? (void *) (uintptr_t) j : ctx
+      );
+    }
+  }
+
+  _SMP_Multicast_batch_issue(&batch);
+  _SMP_Multicast_batch_wait(&batch);
+  rtems_test_assert(_SMP_Multicast_batch_is_done(&batch));
+}
+
+static void test_order(test_context *ctx, uint32_t cpu_count)
+{
+  reset(ctx);
+  issue_batch(ctx, cpu_count, MAX_JOBS_PER_PROCESSOR, ordered_action, true);
+  check_counts(ctx, cpu_count, MAX_JOBS_PER_PROCESSOR);
+}
+
+static void test_isr_disabled(test_context *ctx, uint32_t cpu_count)
+{
+  rtems_interrupt_level level;
+
+  reset(ctx);
+  rtems_interrupt_local_disable(level);
+  _SMP_Multicast_action(0, NULL, count_action, ctx);
+  rtems_interrupt_local_enable(level);
+  check_counts(ctx, cpu_count, 1);
+}
+
+/*
+ * The action handler performed by the initiating processor issues another
+ * multicast action while it waits for the completion of the first one.
+ */
+static void test_nested(test_context *ctx, uint32_t cpu_count)
+{
+  reset(ctx);
+  ctx->initiator = rtems_get_current_processor();
+  _SMP_Multicast_action(0, NULL, nested_action, ctx);
+  check_counts(ctx, cpu_count, 1);
+}
+
+static rtems_counter_ticks measure_synchronous(
+  test_context *ctx,
+  uint32_t cpu_count,
+  uint32_t actions
+)
+{
+  rtems_counter_ticks min;
+  int sample;
+
+  min = (rtems_counter_ticks) -1;
+
+  for (sample = 0; sample < SAMPLE_COUNT; ++sample) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks d;
+    uint32_t i;
+
+    reset(ctx);
+    a = rtems_counter_read();
+
+    for (i = 0; i < actions; ++i) {
+      _SMP_Multicast_action(0, NULL, count_action, ctx);
+    }
+
+    d = rtems_counter_difference(rtems_counter_read(), a);
+    check_counts(ctx, cpu_count, actions);
+
+    if (d < min) {
+      min = d;
+    }
+  }
+
+  return min;
+}
+
+static rtems_counter_ticks measure_batched(
+  test_context *ctx,
+  uint32_t cpu_count,
+  uint32_t actions
+)
+{
+  rtems_counter_ticks min;
+  int sample;
+
+  min = (rtems_counter_ticks) -1;
+
+  for (sample = 0; sample < SAMPLE_COUNT; ++sample) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks d;
+
+    reset(ctx);
+    a = rtems_counter_read();
+    issue_batch(ctx, cpu_count, actions, count_action, false);
+    d = rtems_counter_difference(rtems_counter_read(), a);
+    check_counts(ctx, cpu_count, actions);
+
+    if (d < min) {
+      min = d;
+    }
+  }
+
+  return min;
+}
+
+/*
+ * Broadcast a series of actions to all processors.  Compare the minimum
+ * latency of back-to-back synchronous multicast actions with one batch
+ * containing the same actions.
+ */
+static void test_broadcast_latency(test_context *ctx, uint32_t cpu_count)
+{
+  uint32_t actions;
+
+  printf("<SMPMulticast01 processorCount=\"%" PRIu32 "\">\n", cpu_count);
+
+  for (actions = 1; actions <= MAX_JOBS_PER_PROCESSOR; actions *= 2) {
+    rtems_counter_ticks synchronous;
+    rtems_counter_ticks batched;
+
+    synchronous = measure_synchronous(ctx, cpu_count, actions);
+    batched = measure_batched(ctx, cpu_count, actions);
+
+    printf(
+      "  <Sample>\n"
+      "    <ActionCount>%" PRIu32 "</ActionCount>"
+      "<Synchronous unit=\"ns\">%" PRIu64 "</Synchronous>"
+      "<Batched unit=\"ns\">%" PRIu64 "</Batched>\n"
+      "  </Sample>\n",
+      actions,
+      rtems_counter_ticks_to_nanoseconds(synchronous),
+      rtems_counter_ticks_to_nanoseconds(batched)
+    );
+  }
+
+  printf("</SMPMulticast01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_get_processor_count();
+
+  TEST_BEGIN();
+
+  test_order(ctx, cpu_count);
+  test_isr_disabled(ctx, cpu_count);
+  test_nested(ctx, cpu_count);
+  test_broadcast_latency(ctx, cpu_count);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
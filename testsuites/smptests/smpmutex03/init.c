@@ -0,0 +1,262 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/lock.h>
+#include <pthread.h>
+
+#include <rtems.h>
+#include <rtems/score/threadimpl.h>
+
+const char rtems_test_name[] = "SMPMUTEX 3";
+
+#define CPU_COUNT 4
+
+#define ITERATIONS 10000
+
+#define WORKER_PRIORITY 2
+
+#define CLASSIC_COUNT 3
+
+/*
+ * A lost hand over of a mutex released via the fast path leads to a timeout
+ * instead of a test which hangs.
+ */
+#define TIMEOUT 1000
+
+typedef enum {
+  KIND_CLASSIC_FIFO,
+  KIND_CLASSIC_PRIORITY,
+  KIND_CLASSIC_INHERIT,
+  KIND_POSIX = CLASSIC_COUNT,
+  KIND_SELF_CONTAINED,
+  KIND_COUNT
+} mutex_kind;
+
+typedef struct {
+  uint32_t worker_count;
+  rtems_id master_id;
+  rtems_id worker_ids[CPU_COUNT];
+  rtems_id classic_ids[CLASSIC_COUNT];
+  pthread_mutex_t posix_mutex;
+  struct _Mutex_Control self_contained_mutex;
+  volatile rtems_id owners[KIND_COUNT];
+  uint32_t counters[KIND_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .posix_mutex = PTHREAD_MUTEX_INITIALIZER,
+  .self_contained_mutex = _MUTEX_INITIALIZER
+};
+
+static void obtain(test_context *ctx, mutex_kind kind)
+{
+  rtems_status_code sc;
+  int eno;
+
+  switch (kind) {
+    case KIND_POSIX:
+      eno = pthread_mutex_lock(&ctx->posix_mutex);
+      rtems_test_assert(eno == 0);
+      break;
+    case KIND_SELF_CONTAINED:
+      _Mutex_Acquire(&ctx->self_contained_mutex);
+      break;
+    default:
+      sc = rtems_semaphore_obtain(ctx->classic_ids[kind], RTEMS_WAIT, TIMEOUT);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+  }
+}
+
+static void release(test_context *ctx, mutex_kind kind)
+{
+  rtems_status_code sc;
+  int eno;
+
+  switch (kind) {
+    case KIND_POSIX:
+      eno = pthread_mutex_unlock(&ctx->posix_mutex);
+      rtems_test_assert(eno == 0);
+      break;
+    case KIND_SELF_CONTAINED:
+      _Mutex_Release(&ctx->self_contained_mutex);
+      break;
+    default:
+      sc = rtems_semaphore_release(ctx->classic_ids[kind]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+  }
+}
+
+static void check_no_resources(rtems_task_priority expected_priority)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  /* A priority inherited while the mutex was owned must be gone */
+  sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(prio == expected_priority);
+
+#if defined(RTEMS_SCORE_THREAD_ENABLE_RESOURCE_COUNT)
+  rtems_test_assert(!_Thread_Owns_resources(_Thread_Get_executing()));
+#endif
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  rtems_id self;
+  mutex_kind kind;
+
+  ctx = &test_instance;
+  self = rtems_task_self();
+
+  for (kind = 0; kind < KIND_COUNT; ++kind) {
+    uint32_t i;
+
+    for (i = 0; i < ITERATIONS; ++i) {
+      obtain(ctx, kind);
+
+      rtems_test_assert(ctx->owners[kind] == 0);
+      ctx->owners[kind] = self;
+      ++ctx->counters[kind];
+      rtems_test_assert(ctx->owners[kind] == self);
+      ctx->owners[kind] = 0;
+
+      release(ctx, kind);
+      check_no_resources(WORKER_PRIORITY + arg);
+    }
+  }
+
+  sc = rtems_event_transient_send(ctx->master_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void create_classic(test_context *ctx, mutex_kind kind)
+{
+  static const rtems_attribute attributes[CLASSIC_COUNT] = {
+    RTEMS_BINARY_SEMAPHORE | RTEMS_FIFO,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY
+  };
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'T', 'X', '0' + kind),
+    1,
+    attributes[kind],
+    0,
+    &ctx->classic_ids[kind]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  mutex_kind kind;
+  uint32_t i;
+
+  ctx->master_id = rtems_task_self();
+  ctx->worker_count = rtems_get_processor_count();
+
+  if (ctx->worker_count > CPU_COUNT) {
+    ctx->worker_count = CPU_COUNT;
+  }
+
+  for (kind = 0; kind < CLASSIC_COUNT; ++kind) {
+    create_classic(ctx, kind);
+  }
+
+  /* Each worker has its own processor and a distinct priority */
+  for (i = 0; i < ctx->worker_count; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      WORKER_PRIORITY + i,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->worker_ids[i], worker, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    sc = rtems_task_delete(ctx->worker_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (kind = 0; kind < KIND_COUNT; ++kind) {
+    rtems_test_assert(ctx->owners[kind] == 0);
+    rtems_test_assert(ctx->counters[kind] == ctx->worker_count * ITERATIONS);
+  }
+
+  /* The mutexes are available after the last fast release */
+  for (kind = 0; kind < CLASSIC_COUNT; ++kind) {
+    sc = rtems_semaphore_obtain(ctx->classic_ids[kind], RTEMS_NO_WAIT, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_release(ctx->classic_ids[kind]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_delete(ctx->classic_ids[kind]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(pthread_mutex_trylock(&ctx->posix_mutex) == 0);
+  rtems_test_assert(pthread_mutex_unlock(&ctx->posix_mutex) == 0);
+
+  rtems_test_assert(_Mutex_Try_acquire(&ctx->self_contained_mutex) == 0);
+  _Mutex_Release(&ctx->self_contained_mutex);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES CLASSIC_COUNT
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,400 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <string.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SMPSCHEDCEDF 1";
+
+#define CPU_COUNT 4
+
+#define CLUSTER_SIZE 2
+
+#define TASK_COUNT 6
+
+#define P(i) (UINT32_C(2) + i)
+
+#define ALL UINT32_C(0xf)
+
+#define C(i) (UINT32_C(0x3) << ((i) * CLUSTER_SIZE))
+
+#define NONE UINT8_C(255)
+
+#define NAME rtems_build_name('C', 'E', 'D', 'F')
+
+typedef struct {
+  enum {
+    KIND_RESET,
+    KIND_SET_PRIORITY,
+    KIND_SET_AFFINITY,
+    KIND_BLOCK,
+    KIND_UNBLOCK
+  } kind;
+
+  size_t index;
+
+  struct {
+    rtems_task_priority priority;
+    uint32_t cpu_set;
+  } data;
+
+  uint8_t expected_clusters[TASK_COUNT];
+} test_action;
+
+typedef struct {
+  rtems_id timer_id;
+  rtems_id master_id;
+  rtems_id task_ids[TASK_COUNT];
+  size_t action_index;
+} test_context;
+
+#define RESET \
+  { \
+    KIND_RESET, \
+    0, \
+    { 0 }, \
+    { NONE, NONE, NONE, NONE, NONE, NONE } \
+  }
+
+#define SET_PRIORITY(index, prio, t0, t1, t2, t3, t4, t5) \
+  { \
+    KIND_SET_PRIORITY, \
+    index, \
+    { .priority = prio }, \
+    { t0, t1, t2, t3, t4, t5 } \
+  }
+
+#define SET_AFFINITY(index, aff, t0, t1, t2, t3, t4, t5) \
+  { \
+    KIND_SET_AFFINITY, \
+    index, \
+    { .cpu_set = aff }, \
+    { t0, t1, t2, t3, t4, t5 } \
+  }
+
+#define BLOCK(index, t0, t1, t2, t3, t4, t5) \
+  { \
+    KIND_BLOCK, \
+    index, \
+    { 0 }, \
+    { t0, t1, t2, t3, t4, t5 } \
+  }
+
+#define UNBLOCK(index, t0, t1, t2, t3, t4, t5) \
+  { \
+    KIND_UNBLOCK, \
+    index, \
+    { 0 }, \
+    { t0, t1, t2, t3, t4, t5 } \
+  }
+
+/*
+ * The expectations are the clusters of the processors used by the tasks.  The
+ * tasks 0 and 1 are pinned to cluster 1, the tasks 2 and 3 are pinned to
+ * cluster 0, the tasks 4 and 5 are migratable.
+ */
+static const test_action test_actions[] = {
+  RESET,
+  SET_AFFINITY( 0,  C(1), NONE, NONE, NONE, NONE, NONE, NONE),
+  SET_AFFINITY( 1,  C(1), NONE, NONE, NONE, NONE, NONE, NONE),
+  SET_AFFINITY( 2,  C(0), NONE, NONE, NONE, NONE, NONE, NONE),
+  SET_AFFINITY( 3,  C(0), NONE, NONE, NONE, NONE, NONE, NONE),
+  UNBLOCK(      0,           1, NONE, NONE, NONE, NONE, NONE),
+  UNBLOCK(      1,           1,    1, NONE, NONE, NONE, NONE),
+  UNBLOCK(      2,           1,    1,    0, NONE, NONE, NONE),
+  UNBLOCK(      3,           1,    1,    0,    0, NONE, NONE),
+  UNBLOCK(      4,           1,    1,    0,    0, NONE, NONE),
+  /* Cluster 0 pulls the migratable task 4 */
+  BLOCK(        2,           1,    1, NONE,    0,    0, NONE),
+  UNBLOCK(      2,           1,    1,    0,    0, NONE, NONE),
+  /* Cluster 1 pulls the migratable task 4 queued in cluster 0 */
+  BLOCK(        0,        NONE,    1,    0,    0,    1, NONE),
+  UNBLOCK(      5,        NONE,    1,    0,    0,    1, NONE),
+  UNBLOCK(      0,           1,    1,    0,    0, NONE, NONE),
+  /* A migratable task preempts the lowest priority task of all clusters */
+  SET_PRIORITY( 5,  P(0),    1,    1,    0, NONE, NONE,    0),
+  BLOCK(        5,           1,    1,    0,    0, NONE, NONE),
+  BLOCK(        2,           1,    1, NONE,    0,    0, NONE),
+  BLOCK(        3,           1,    1, NONE, NONE,    0, NONE),
+  /* A pinned task does not use the idle processor of another cluster */
+  SET_PRIORITY( 5,  P(5),    1,    1, NONE, NONE,    0, NONE),
+  SET_AFFINITY( 5,  C(1),    1,    1, NONE, NONE,    0, NONE),
+  UNBLOCK(      5,           1,    1, NONE, NONE,    0, NONE),
+  BLOCK(        1,           1, NONE, NONE, NONE,    0,    1),
+  RESET
+};
+
+static test_context test_instance;
+
+static void set_priority(rtems_id id, rtems_task_priority prio)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_set_priority(id, prio, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_status_code do_set_affinity(rtems_id id, uint32_t cpu_set_32)
+{
+  cpu_set_t cpu_set;
+  size_t i;
+
+  CPU_ZERO(&cpu_set);
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    if ((cpu_set_32 & (UINT32_C(1) << i)) != 0) {
+      CPU_SET(i, &cpu_set);
+    }
+  }
+
+  return rtems_task_set_affinity(id, sizeof(cpu_set), &cpu_set);
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_set_32)
+{
+  rtems_status_code sc;
+
+  sc = do_set_affinity(id, cpu_set_32);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_invalid_affinities(test_context *ctx)
+{
+  /* Parts of a cluster and processors of several clusters */
+  static const uint32_t invalid[] = { 0x1, 0x2, 0x8, 0x6, 0x7, 0xb };
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(invalid); ++i) {
+    sc = do_set_affinity(ctx->task_ids[0], invalid[i]);
+    rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+  }
+
+  set_affinity(ctx->task_ids[0], C(0));
+  set_affinity(ctx->task_ids[0], C(1));
+  set_affinity(ctx->task_ids[0], ALL);
+}
+
+static void reset(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    set_priority(ctx->task_ids[i], P(i));
+    set_affinity(ctx->task_ids[i], ALL);
+  }
+
+  for (i = CPU_COUNT; i < TASK_COUNT; ++i) {
+    sc = rtems_task_suspend(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL || sc == RTEMS_ALREADY_SUSPENDED);
+  }
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    sc = rtems_task_resume(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL || sc == RTEMS_INCORRECT_STATE);
+  }
+
+  /* Order the idle threads explicitly */
+  for (i = 0; i < CPU_COUNT; ++i) {
+    const Per_CPU_Control *c;
+    const Thread_Control *h;
+
+    c = _Per_CPU_Get_by_index(CPU_COUNT - 1 - i);
+    h = c->heir;
+
+    sc = rtems_task_suspend(h->Object.id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void check_cluster_allocations(
+  test_context *ctx,
+  const test_action *action
+)
+{
+  uint8_t clusters[TASK_COUNT];
+  size_t i;
+
+  memset(clusters, NONE, sizeof(clusters));
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    const Per_CPU_Control *c;
+    const Thread_Control *h;
+    size_t j;
+
+    c = _Per_CPU_Get_by_index(i);
+    h = c->heir;
+
+    for (j = 0; j < TASK_COUNT; ++j) {
+      if (h->Object.id == ctx->task_ids[j]) {
+        rtems_test_assert(clusters[j] == NONE);
+        clusters[j] = (uint8_t) (i / CLUSTER_SIZE);
+      }
+    }
+  }
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    rtems_test_assert(clusters[i] == action->expected_clusters[i]);
+  }
+}
+
+/*
+ * Use a timer to execute the actions, since it runs with thread dispatching
+ * disabled.  This is necessary to check the expected processor allocations.
+ */
+static void timer(rtems_id id, void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  size_t i;
+
+  ctx = arg;
+  i = ctx->action_index;
+
+  if (i == 0) {
+    sc = rtems_task_suspend(ctx->master_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  if (i < RTEMS_ARRAY_SIZE(test_actions)) {
+    const test_action *action = &test_actions[i];
+    rtems_id task;
+
+    ctx->action_index = i + 1;
+
+    task = ctx->task_ids[action->index];
+
+    switch (action->kind) {
+      case KIND_SET_PRIORITY:
+        set_priority(task, action->data.priority);
+        break;
+      case KIND_SET_AFFINITY:
+        set_affinity(task, action->data.cpu_set);
+        break;
+      case KIND_BLOCK:
+        sc = rtems_task_suspend(task);
+        rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+        break;
+      case KIND_UNBLOCK:
+        sc = rtems_task_resume(task);
+        rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+        break;
+      default:
+        rtems_test_assert(action->kind == KIND_RESET);
+        reset(ctx);
+        break;
+    }
+
+    check_cluster_allocations(ctx, action);
+
+    sc = rtems_timer_reset(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    sc = rtems_task_resume(ctx->master_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_transient_send(ctx->master_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void do_nothing_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    /* Do nothing */
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  size_t i;
+
+  ctx = &test_instance;
+
+  ctx->master_id = rtems_task_self();
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    sc = rtems_task_create(
+      NAME,
+      P(i),
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->task_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->task_ids[i], do_nothing_task, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  test_invalid_affinities(ctx);
+
+  sc = rtems_timer_create(NAME, &ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_fire_after(ctx->timer_id, 1, timer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    sc = rtems_task_delete(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_timer_delete(ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_get_processor_count() == CPU_COUNT) {
+    test();
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASK_COUNT)
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP
+
+#define CONFIGURE_SCHEDULER_EDF_CLUSTER_SIZE CLUSTER_SIZE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,248 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SMPSCHEDCEDF 2";
+
+#define CPU_COUNT 4
+
+#define CLUSTER_SIZE 2
+
+#define PERIODIC_COUNT 3
+
+#define APERIODIC_COUNT 3
+
+#define PERIOD 10
+
+#define BUDGET 3
+
+#define PERIOD_COUNT 50
+
+#define PERIODIC_PRIORITY 2
+
+#define APERIODIC_PRIORITY 3
+
+#define C(i) (UINT32_C(0x3) << ((i) * CLUSTER_SIZE))
+
+#define NAME rtems_build_name('C', 'E', 'D', 'F')
+
+/*
+ * The periodic tasks 0 and 1 load cluster 0 and the periodic task 2 loads
+ * cluster 1.  Cluster 1 has not enough idle capacity for all aperiodic
+ * tasks, so some of them must use the idle capacity of cluster 0.
+ */
+static const uint32_t periodic_clusters[PERIODIC_COUNT] = { 0, 0, 1 };
+
+typedef struct {
+  rtems_id master_id;
+  rtems_id periodic_ids[PERIODIC_COUNT];
+  rtems_id aperiodic_ids[APERIODIC_COUNT];
+  rtems_rate_monotonic_period_statistics stats[PERIODIC_COUNT];
+  volatile bool wrong_cluster;
+  volatile uint32_t aperiodic_counters[APERIODIC_COUNT];
+  volatile uint32_t aperiodic_clusters[APERIODIC_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t current_cluster(void)
+{
+  return rtems_get_current_processor() / CLUSTER_SIZE;
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_set_32)
+{
+  rtems_status_code sc;
+  cpu_set_t cpu_set;
+  size_t i;
+
+  CPU_ZERO(&cpu_set);
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    if ((cpu_set_32 & (UINT32_C(1) << i)) != 0) {
+      CPU_SET(i, &cpu_set);
+    }
+  }
+
+  sc = rtems_task_set_affinity(id, sizeof(cpu_set), &cpu_set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void busy(test_context *ctx, uint32_t cluster, rtems_interval ticks)
+{
+  rtems_interval start;
+
+  start = rtems_clock_get_ticks_since_boot();
+
+  while (rtems_clock_get_ticks_since_boot() - start < ticks) {
+    if (current_cluster() != cluster) {
+      ctx->wrong_cluster = true;
+    }
+  }
+}
+
+static void periodic_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  rtems_id period;
+  size_t i;
+
+  ctx = &test_instance;
+
+  sc = rtems_rate_monotonic_create(NAME, &period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < PERIOD_COUNT; ++i) {
+    sc = rtems_rate_monotonic_period(period, PERIOD);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    busy(ctx, periodic_clusters[arg], BUDGET);
+  }
+
+  sc = rtems_rate_monotonic_get_statistics(period, &ctx->stats[arg]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_delete(period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_send(ctx->master_id, RTEMS_EVENT_0 << arg);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void aperiodic_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  while (true) {
+    ctx->aperiodic_clusters[arg] |= UINT32_C(1) << current_cluster();
+    ++ctx->aperiodic_counters[arg];
+  }
+}
+
+static void create_task(rtems_id *id, rtems_task_priority priority)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    NAME,
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  rtems_event_set events;
+  uint32_t clusters;
+  size_t i;
+
+  ctx = &test_instance;
+  ctx->master_id = rtems_task_self();
+
+  for (i = 0; i < APERIODIC_COUNT; ++i) {
+    create_task(&ctx->aperiodic_ids[i], APERIODIC_PRIORITY);
+
+    sc = rtems_task_start(ctx->aperiodic_ids[i], aperiodic_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < PERIODIC_COUNT; ++i) {
+    create_task(&ctx->periodic_ids[i], PERIODIC_PRIORITY);
+    set_affinity(ctx->periodic_ids[i], C(periodic_clusters[i]));
+
+    sc = rtems_task_start(ctx->periodic_ids[i], periodic_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_event_receive(
+    (RTEMS_EVENT_0 << PERIODIC_COUNT) - 1,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < APERIODIC_COUNT; ++i) {
+    sc = rtems_task_delete(ctx->aperiodic_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < PERIODIC_COUNT; ++i) {
+    sc = rtems_task_delete(ctx->periodic_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(!ctx->wrong_cluster);
+
+  for (i = 0; i < PERIODIC_COUNT; ++i) {
+    rtems_test_assert(ctx->stats[i].count == PERIOD_COUNT - 1);
+    rtems_test_assert(ctx->stats[i].missed_count == 0);
+  }
+
+  clusters = 0;
+
+  for (i = 0; i < APERIODIC_COUNT; ++i) {
+    rtems_test_assert(ctx->aperiodic_counters[i] > 0);
+    clusters |= ctx->aperiodic_clusters[i];
+  }
+
+  rtems_test_assert(clusters == 0x3);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_get_processor_count() == CPU_COUNT) {
+    test();
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + PERIODIC_COUNT + APERIODIC_COUNT)
+#define CONFIGURE_MAXIMUM_PERIODS PERIODIC_COUNT
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_EDF_CLUSTER_SMP
+
+#define CONFIGURE_SCHEDULER_EDF_CLUSTER_SIZE CLUSTER_SIZE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,142 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+#include <rtems/score/atomic.h>
+
+#define CPU_COUNT 2
+
+#define ITEM_COUNT 8
+
+const char rtems_test_name[] = "SMPWORKQUEUE 1";
+
+typedef struct {
+  rtems_work_queue queue;
+  rtems_work_item items[ITEM_COUNT];
+  uint32_t processors[ITEM_COUNT];
+  Atomic_Uint done;
+} test_context;
+
+static test_context test_instance;
+
+static void handler(rtems_work_item *item)
+{
+  test_context *ctx = rtems_work_item_get_argument(item);
+  int i = (int) (item - &ctx->items[0]);
+
+  ctx->processors[i] = rtems_get_current_processor();
+  _Atomic_Fetch_add_uint(&ctx->done, 1, ATOMIC_ORDER_RELEASE);
+}
+
+static void wait_for_items(test_context *ctx, unsigned int count)
+{
+  while (_Atomic_Load_uint(&ctx->done, ATOMIC_ORDER_ACQUIRE) != count) {
+    /* Wait */
+  }
+}
+
+static void test_work_stealing(test_context *ctx)
+{
+  rtems_work_queue_worker_info info;
+  rtems_status_code sc;
+  cpu_set_t cpu;
+  int i;
+
+  /* Keep the worker of processor 0 busy by an executing task */
+  CPU_ZERO(&cpu);
+  CPU_SET(0, &cpu);
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpu), &cpu);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_get_current_processor() == 0);
+
+  _Atomic_Init_uint(&ctx->done, 0);
+
+  sc = rtems_work_queue_create(
+    &ctx->queue,
+    rtems_build_name('W', 'O', 'R', 'K'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    rtems_work_item_initialize(
+      &ctx->items[i],
+      handler,
+      ctx,
+      RTEMS_WORK_PRIORITY_NORMAL
+    );
+  }
+
+  /* Let the worker of processor 1 execute its own work item */
+  sc = rtems_work_queue_submit_to_processor(&ctx->queue, &ctx->items[0], 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_items(ctx, 1);
+  rtems_test_assert(ctx->processors[0] == 1);
+
+  /* The worker of processor 1 steals the work items of processor 0 */
+  for (i = 1; i < ITEM_COUNT; ++i) {
+    sc = rtems_work_queue_submit(&ctx->queue, &ctx->items[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  wait_for_items(ctx, ITEM_COUNT);
+
+  for (i = 1; i < ITEM_COUNT; ++i) {
+    rtems_test_assert(ctx->processors[i] == 1);
+  }
+
+  sc = rtems_work_queue_get_worker_info(&ctx->queue, 0, &info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(info.pending == 0);
+  rtems_test_assert(info.executed == 0);
+
+  sc = rtems_work_queue_get_worker_info(&ctx->queue, 1, &info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(info.pending == 0);
+  rtems_test_assert(info.executed == ITEM_COUNT);
+  rtems_test_assert(info.stolen == ITEM_COUNT - 1);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_get_processor_count() == CPU_COUNT) {
+    test_work_stealing(&test_instance);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,396 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/score/userextimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPEXTENSIONS 2";
+
+#define EVENT_COUNT_MAX 16
+
+#define WORKER_PRIORITY 1
+
+typedef enum {
+  CREATE_A,
+  CREATE_B,
+  CREATE_DYNAMIC,
+  DELETE_B,
+  DELETE_C,
+  DELETE_DYNAMIC
+} event;
+
+typedef enum {
+  SWITCH_A,
+  SWITCH_C,
+  SWITCH_DYNAMIC,
+  SWITCH_COUNT
+} switch_callout;
+
+typedef struct {
+  bool recording;
+  size_t event_count;
+  event events[EVENT_COUNT_MAX];
+  uint32_t switch_step;
+  uint32_t switch_counts[SWITCH_COUNT];
+  bool switch_order_error;
+  rtems_id extension;
+} test_context;
+
+static test_context test_instance;
+
+static void record(event e)
+{
+  test_context *ctx = &test_instance;
+
+  if (ctx->recording) {
+    rtems_test_assert(ctx->event_count < EVENT_COUNT_MAX);
+    ctx->events[ctx->event_count] = e;
+    ++ctx->event_count;
+  }
+}
+
+/*
+ * The switch callouts of one thread switch must run in the order initial
+ * extension A, initial extension C, dynamic extension.
+ */
+static void switch_to(switch_callout s)
+{
+  test_context *ctx = &test_instance;
+
+  if (s != SWITCH_A && ctx->switch_step != s) {
+    ctx->switch_order_error = true;
+  }
+
+  ctx->switch_step = s + 1;
+  ++ctx->switch_counts[s];
+}
+
+static bool create_a(rtems_tcb *executing, rtems_tcb *created)
+{
+  record(CREATE_A);
+  return true;
+}
+
+static void switch_a(rtems_tcb *executing, rtems_tcb *heir)
+{
+  switch_to(SWITCH_A);
+}
+
+static bool create_b(rtems_tcb *executing, rtems_tcb *created)
+{
+  record(CREATE_B);
+  return true;
+}
+
+static void delete_b(rtems_tcb *executing, rtems_tcb *deleted)
+{
+  record(DELETE_B);
+}
+
+static void delete_c(rtems_tcb *executing, rtems_tcb *deleted)
+{
+  record(DELETE_C);
+}
+
+static void switch_c(rtems_tcb *executing, rtems_tcb *heir)
+{
+  switch_to(SWITCH_C);
+}
+
+static bool create_dynamic(rtems_tcb *executing, rtems_tcb *created)
+{
+  record(CREATE_DYNAMIC);
+  return true;
+}
+
+static void delete_dynamic(rtems_tcb *executing, rtems_tcb *deleted)
+{
+  record(DELETE_DYNAMIC);
+}
+
+static void switch_dynamic(rtems_tcb *executing, rtems_tcb *heir)
+{
+  switch_to(SWITCH_DYNAMIC);
+}
+
+static const rtems_extensions_table dynamic_extension = {
+  .thread_create = create_dynamic,
+  .thread_delete = delete_dynamic,
+  .thread_switch = switch_dynamic
+};
+
+static void start_recording(test_context *ctx)
+{
+  ctx->event_count = 0;
+  ctx->recording = true;
+}
+
+static void check_events(
+  test_context *ctx,
+  const event *expected,
+  size_t expected_count
+)
+{
+  ctx->recording = false;
+  rtems_test_assert(ctx->event_count == expected_count);
+  rtems_test_assert(
+    memcmp(&ctx->events[0], expected, expected_count * sizeof(*expected)) == 0
+  );
+}
+
+static void worker(rtems_task_argument arg)
+{
+  while (true) {
+    rtems_task_suspend(RTEMS_SELF);
+  }
+}
+
+/*
+ * The worker has a higher priority than the Init task, so its start and its
+ * self suspension lead to two thread switches.
+ */
+static void create_and_start_worker(rtems_id *id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    WORKER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(*id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_worker(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_resolved_callouts(void)
+{
+  const User_extensions_Initial_callouts *initial;
+  const rtems_extensions_table *table;
+  uint32_t n;
+  uint32_t i;
+  uint32_t s;
+  uint32_t c;
+  uint32_t d;
+  uint32_t a_index;
+
+  initial = &_User_extensions_Initial_callouts;
+  table = rtems_configuration_get_user_extension_table();
+  n = rtems_configuration_get_number_of_initial_extensions();
+  s = 0;
+  c = 0;
+  d = 0;
+  a_index = n;
+
+  /*
+   * The tables contain exactly the callouts of the initial extension table
+   * which are not NULL in the order of the initial extension table.
+   */
+  for (i = 0; i < n; ++i) {
+    if (table[i].thread_switch != NULL) {
+      rtems_test_assert(s < initial->thread_switch_count);
+      rtems_test_assert(initial->thread_switch[s] == table[i].thread_switch);
+      ++s;
+    }
+
+    if (table[i].thread_create != NULL) {
+      rtems_test_assert(c < initial->thread_create_count);
+      rtems_test_assert(initial->thread_create[c] == table[i].thread_create);
+      ++c;
+    }
+
+    if (table[i].thread_delete != NULL) {
+      rtems_test_assert(d < initial->thread_delete_count);
+      rtems_test_assert(initial->thread_delete[d] == table[i].thread_delete);
+      ++d;
+    }
+
+    if (table[i].thread_create == create_a) {
+      a_index = i;
+    }
+  }
+
+  rtems_test_assert(s == initial->thread_switch_count);
+  rtems_test_assert(c == initial->thread_create_count);
+  rtems_test_assert(d == initial->thread_delete_count);
+
+  /* The extensions of this test are consecutive entries of the table */
+  rtems_test_assert(a_index + 2 < n);
+  rtems_test_assert(table[a_index].thread_switch == switch_a);
+  rtems_test_assert(table[a_index + 1].thread_create == create_b);
+  rtems_test_assert(table[a_index + 1].thread_switch == NULL);
+  rtems_test_assert(table[a_index + 2].thread_switch == switch_c);
+}
+
+static void test_without_dynamic_switch(test_context *ctx)
+{
+  static const event create_events[] = {
+    CREATE_A,
+    CREATE_B
+  };
+  static const event delete_and_create_events[] = {
+    DELETE_C,
+    DELETE_B,
+    CREATE_A,
+    CREATE_B
+  };
+  uint32_t switch_counts[SWITCH_COUNT];
+  rtems_id first;
+  rtems_id second;
+
+  /* The API extension sets have no switch callouts */
+  rtems_test_assert(_Chain_Is_empty(&_User_extensions_Switches_list));
+
+  memcpy(&switch_counts[0], &ctx->switch_counts[0], sizeof(switch_counts));
+
+  start_recording(ctx);
+  create_and_start_worker(&first);
+  check_events(ctx, &create_events[0], RTEMS_ARRAY_SIZE(create_events));
+
+  rtems_test_assert(!ctx->switch_order_error);
+  rtems_test_assert(
+    ctx->switch_counts[SWITCH_A] - switch_counts[SWITCH_A] >= 2
+  );
+  rtems_test_assert(
+    ctx->switch_counts[SWITCH_C] - switch_counts[SWITCH_C]
+      == ctx->switch_counts[SWITCH_A] - switch_counts[SWITCH_A]
+  );
+  rtems_test_assert(ctx->switch_counts[SWITCH_DYNAMIC] == 0);
+
+  /* The deleted worker is freed by the next task creation */
+  delete_worker(first);
+
+  start_recording(ctx);
+  create_and_start_worker(&second);
+  check_events(
+    ctx,
+    &delete_and_create_events[0],
+    RTEMS_ARRAY_SIZE(delete_and_create_events)
+  );
+
+  delete_worker(second);
+}
+
+static void test_with_dynamic(test_context *ctx)
+{
+  static const event delete_and_create_events[] = {
+    DELETE_DYNAMIC,
+    DELETE_C,
+    DELETE_B,
+    CREATE_A,
+    CREATE_B,
+    CREATE_DYNAMIC
+  };
+  rtems_status_code sc;
+  uint32_t dynamic_switch_count;
+  rtems_id id;
+
+  sc = rtems_extension_create(
+    rtems_build_name('D', 'Y', 'N', 'A'),
+    &dynamic_extension,
+    &ctx->extension
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(!_Chain_Is_empty(&_User_extensions_Switches_list));
+
+  /*
+   * The initial callouts are called before the dynamic callouts.  This task
+   * creation frees the worker deleted by the previous test.
+   */
+  start_recording(ctx);
+  create_and_start_worker(&id);
+  check_events(
+    ctx,
+    &delete_and_create_events[0],
+    RTEMS_ARRAY_SIZE(delete_and_create_events)
+  );
+
+  rtems_test_assert(!ctx->switch_order_error);
+  dynamic_switch_count = ctx->switch_counts[SWITCH_DYNAMIC];
+  rtems_test_assert(dynamic_switch_count >= 2);
+
+  delete_worker(id);
+
+  start_recording(ctx);
+  create_and_start_worker(&id);
+  check_events(
+    ctx,
+    &delete_and_create_events[0],
+    RTEMS_ARRAY_SIZE(delete_and_create_events)
+  );
+
+  delete_worker(id);
+
+  sc = rtems_extension_delete(ctx->extension);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(_Chain_Is_empty(&_User_extensions_Switches_list));
+
+  /* The dynamic switch callout is no longer called */
+  dynamic_switch_count = ctx->switch_counts[SWITCH_DYNAMIC];
+  create_and_start_worker(&id);
+  delete_worker(id);
+  rtems_test_assert(
+    ctx->switch_counts[SWITCH_DYNAMIC] == dynamic_switch_count
+  );
+  rtems_test_assert(!ctx->switch_order_error);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_resolved_callouts();
+  test_without_dynamic_switch(ctx);
+  test_with_dynamic(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  { .thread_create = create_a, .thread_switch = switch_a }, \
+  { .thread_create = create_b, .thread_delete = delete_b }, \
+  { .thread_delete = delete_c, .thread_switch = switch_c }, \
+  RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,149 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/mpscring.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMPSCRING 1";
+
+#define SLOT_COUNT 4
+
+#define ISR_BURST 3
+
+#define ISR_ITEM_COUNT 30
+
+typedef struct {
+  MPSC_ring_Control ring;
+  MPSC_ring_Slot slots[SLOT_COUNT];
+  rtems_id timer;
+  uintptr_t isr_next;
+} test_context;
+
+static test_context test_instance;
+
+static void *item(uintptr_t i)
+{
+  return (void *) (i + 1);
+}
+
+static void test_basic(test_context *ctx)
+{
+  MPSC_ring_Control *ring = &ctx->ring;
+  uintptr_t round;
+
+  _MPSC_ring_Initialize(ring, ctx->slots, SLOT_COUNT);
+  rtems_test_assert(_MPSC_ring_Get_slot_count(ring) == SLOT_COUNT);
+  rtems_test_assert(_MPSC_ring_Get_overruns(ring) == 0);
+  rtems_test_assert(_MPSC_ring_Try_dequeue(ring) == NULL);
+
+  for (round = 0; round < 3; ++round) {
+    uintptr_t i;
+    bool ok;
+
+    for (i = 0; i < SLOT_COUNT; ++i) {
+      ok = _MPSC_ring_Enqueue(ring, item(i));
+      rtems_test_assert(ok);
+    }
+
+    ok = _MPSC_ring_Enqueue(ring, item(SLOT_COUNT));
+    rtems_test_assert(!ok);
+    rtems_test_assert(_MPSC_ring_Get_overruns(ring) == round + 1);
+
+    for (i = 0; i < SLOT_COUNT; ++i) {
+      rtems_test_assert(_MPSC_ring_Try_dequeue(ring) == item(i));
+    }
+
+    rtems_test_assert(_MPSC_ring_Try_dequeue(ring) == NULL);
+
+    /* Partially fill the ring to move the positions for the next round */
+    ok = _MPSC_ring_Enqueue(ring, item(0));
+    rtems_test_assert(ok);
+    rtems_test_assert(_MPSC_ring_Dequeue(ring) == item(0));
+  }
+
+  _MPSC_ring_Destroy(ring);
+}
+
+static void isr_producer(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+  int i;
+
+  for (i = 0; i < ISR_BURST && ctx->isr_next < ISR_ITEM_COUNT; ++i) {
+    bool ok;
+
+    ok = _MPSC_ring_Enqueue(&ctx->ring, item(ctx->isr_next));
+    rtems_test_assert(ok);
+    ++ctx->isr_next;
+  }
+
+  if (ctx->isr_next < ISR_ITEM_COUNT) {
+    rtems_status_code sc;
+
+    sc = rtems_timer_reset(timer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_isr_producer(test_context *ctx)
+{
+  MPSC_ring_Control *ring = &ctx->ring;
+  rtems_status_code sc;
+  uintptr_t i;
+
+  _MPSC_ring_Initialize(ring, ctx->slots, SLOT_COUNT);
+  ctx->isr_next = 0;
+
+  sc = rtems_timer_create(rtems_build_name('M', 'P', 'S', 'C'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_fire_after(ctx->timer, 1, isr_producer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < ISR_ITEM_COUNT; ++i) {
+    rtems_test_assert(_MPSC_ring_Dequeue(ring) == item(i));
+  }
+
+  rtems_test_assert(_MPSC_ring_Try_dequeue(ring) == NULL);
+  rtems_test_assert(_MPSC_ring_Get_overruns(ring) == 0);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  _MPSC_ring_Destroy(ring);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_basic(ctx);
+  test_isr_producer(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,369 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQ 1";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 64
+
+#define EVENT_RECEIVE RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+typedef struct {
+  rtems_id master;
+  rtems_id worker;
+  rtems_id zero_copy_queue;
+  rtems_id copy_queue;
+  void *received_buffer;
+  size_t received_size;
+} test_context;
+
+static test_context test_instance;
+
+static void send_events(rtems_id id, rtems_event_set events)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send(id, events);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_events(rtems_event_set events)
+{
+  rtems_status_code sc;
+  rtems_event_set received;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == events);
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    wait_for_events(EVENT_RECEIVE);
+
+    sc = rtems_message_queue_receive_buffer(
+      ctx->zero_copy_queue,
+      &ctx->received_buffer,
+      &ctx->received_size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    send_events(ctx->master, EVENT_DONE);
+  }
+}
+
+static void test_not_defined(test_context *ctx)
+{
+  rtems_status_code sc;
+  char buf[MESSAGE_SIZE];
+  void *buffer;
+  size_t size;
+
+  sc = rtems_message_queue_get_buffer(ctx->copy_queue, &buffer);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_message_queue_send_buffer(ctx->copy_queue, &buf[0], 1);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->copy_queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_message_queue_release_buffer(ctx->copy_queue, &buf[0]);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_message_queue_receive(
+    ctx->zero_copy_queue,
+    &buf[0],
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+}
+
+static void test_invalid(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  size_t size;
+
+  sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_buffer(0, &buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->zero_copy_queue,
+    NULL,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->zero_copy_queue,
+    &buffer,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->zero_copy_queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->zero_copy_queue,
+    (char *) buffer + 1,
+    1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->zero_copy_queue,
+    buffer,
+    MESSAGE_SIZE + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  sc = rtems_message_queue_release_buffer(ctx->zero_copy_queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release_buffer(ctx->zero_copy_queue, buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+}
+
+static void test_exhaustion(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+  char buf[MESSAGE_SIZE];
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, &buffer);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  memset(&buf[0], 0, sizeof(buf));
+  sc = rtems_message_queue_send(ctx->zero_copy_queue, &buf[0], sizeof(buf));
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_release_buffer(ctx->zero_copy_queue, buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_pending(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  void *received;
+  size_t size;
+  uint32_t count;
+
+  sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(buffer, 0xa5, MESSAGE_SIZE);
+  sc = rtems_message_queue_send_buffer(ctx->zero_copy_queue, buffer, 13);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_get_number_pending(ctx->zero_copy_queue, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == 1);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->zero_copy_queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == buffer);
+  rtems_test_assert(size == 13);
+  rtems_test_assert(((unsigned char *) received)[12] == 0xa5);
+
+  sc = rtems_message_queue_release_buffer(ctx->zero_copy_queue, received);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_waiting_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  char buf[MESSAGE_SIZE];
+
+  /* Pass the ownership of a message buffer to a waiting receiver */
+  send_events(ctx->worker, EVENT_RECEIVE);
+
+  sc = rtems_message_queue_get_buffer(ctx->zero_copy_queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(buffer, 0x5a, MESSAGE_SIZE);
+  sc = rtems_message_queue_send_buffer(ctx->zero_copy_queue, buffer, 7);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_events(EVENT_DONE);
+  rtems_test_assert(ctx->received_buffer == buffer);
+  rtems_test_assert(ctx->received_size == 7);
+
+  sc = rtems_message_queue_release_buffer(
+    ctx->zero_copy_queue,
+    ctx->received_buffer
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* A copy send fills in a message buffer for the waiting receiver */
+  send_events(ctx->worker, EVENT_RECEIVE);
+
+  memset(&buf[0], 0x3c, sizeof(buf));
+  sc = rtems_message_queue_send(ctx->zero_copy_queue, &buf[0], 5);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_events(EVENT_DONE);
+  rtems_test_assert(ctx->received_size == 5);
+  rtems_test_assert(memcmp(ctx->received_buffer, &buf[0], 5) == 0);
+
+  sc = rtems_message_queue_release_buffer(
+    ctx->zero_copy_queue,
+    ctx->received_buffer
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  ctx->master = rtems_task_self();
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('Z', 'E', 'R', 'O'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_ZERO_COPY_MESSAGES,
+    &ctx->zero_copy_queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('C', 'O', 'P', 'Y'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->copy_queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker, worker, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_not_defined(ctx);
+  test_invalid(ctx);
+  test_exhaustion(ctx);
+  test_pending(ctx);
+  test_waiting_receiver(ctx);
+
+  sc = rtems_task_delete(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_delete(ctx->copy_queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_delete(ctx->zero_copy_queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 2
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  (2 * CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE))
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
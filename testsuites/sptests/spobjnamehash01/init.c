@@ -0,0 +1,286 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#if defined(RTEMS_POSIX_API)
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <semaphore.h>
+  #include <stdio.h>
+#endif
+
+const char rtems_test_name[] = "SPOBJNAMEHASH 1";
+
+#define SEMAPHORES_PER_ALLOCATION 4
+
+#define SEMAPHORE_COUNT 64
+
+#define TIMER_COUNT 3
+
+#define POSIX_SEMAPHORE_COUNT 12
+
+static rtems_id semaphores[SEMAPHORE_COUNT];
+
+static rtems_name semaphore_name(int i)
+{
+  return rtems_build_name('S', 'M', 'A' + i / 26, 'A' + i % 26);
+}
+
+static void create_semaphore(rtems_name name, rtems_id *id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    name,
+    1,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_semaphore(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void assert_semaphore_ident(rtems_name name, rtems_id expected_id)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == expected_id);
+}
+
+static void assert_no_semaphore(rtems_name name)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+}
+
+static void test_unlimited(void)
+{
+  rtems_name name;
+  rtems_id duplicate;
+  int i;
+
+  /* Each allocation block extends the object information */
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    create_semaphore(semaphore_name(i), &semaphores[i]);
+  }
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    assert_semaphore_ident(semaphore_name(i), semaphores[i]);
+  }
+
+  assert_no_semaphore(rtems_build_name('N', 'O', 'N', 'E'));
+
+  /* Duplicate names resolve to the object with the lowest index */
+  name = semaphore_name(SEMAPHORE_COUNT / 2);
+  create_semaphore(name, &duplicate);
+  rtems_test_assert(
+    rtems_object_id_get_index(duplicate)
+      > rtems_object_id_get_index(semaphores[SEMAPHORE_COUNT / 2])
+  );
+  assert_semaphore_ident(name, semaphores[SEMAPHORE_COUNT / 2]);
+
+  delete_semaphore(semaphores[SEMAPHORE_COUNT / 2]);
+  assert_semaphore_ident(name, duplicate);
+
+  delete_semaphore(duplicate);
+  assert_no_semaphore(name);
+
+  /* Renamed objects are found by their new name only */
+  name = semaphore_name(1);
+  rtems_test_assert(
+    rtems_object_set_name(semaphores[1], "NEW1") == RTEMS_SUCCESSFUL
+  );
+  assert_no_semaphore(name);
+  assert_semaphore_ident(rtems_build_name('N', 'E', 'W', '1'), semaphores[1]);
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    if (i != SEMAPHORE_COUNT / 2) {
+      delete_semaphore(semaphores[i]);
+    }
+  }
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    assert_no_semaphore(semaphore_name(i));
+  }
+
+  assert_no_semaphore(rtems_build_name('N', 'E', 'W', '1'));
+}
+
+static void test_limited(void)
+{
+  rtems_status_code sc;
+  rtems_id timers[TIMER_COUNT];
+  rtems_id id;
+  int i;
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_create(
+      rtems_build_name('T', 'I', 'M', '0' + i),
+      &timers[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'X'), &id);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_ident(rtems_build_name('T', 'I', 'M', '0' + i), &id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(id == timers[i]);
+  }
+
+  for (i = 0; i < TIMER_COUNT; ++i) {
+    sc = rtems_timer_delete(timers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_timer_ident(rtems_build_name('T', 'I', 'M', '0' + i), &id);
+    rtems_test_assert(sc == RTEMS_INVALID_NAME);
+  }
+}
+
+#if defined(RTEMS_POSIX_API)
+static void posix_semaphore_name(char *name, size_t size, int i)
+{
+  int n;
+
+  /* The names "/s1" and "/s10" share a prefix */
+  n = snprintf(name, size, "/s%i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void assert_posix_semaphore_open(const char *name, sem_t *expected)
+{
+  sem_t *sem;
+  int rv;
+
+  sem = sem_open(name, 0);
+  rtems_test_assert(sem == expected);
+
+  rv = sem_close(sem);
+  rtems_test_assert(rv == 0);
+}
+
+static void assert_no_posix_semaphore(const char *name)
+{
+  sem_t *sem;
+
+  errno = 0;
+  sem = sem_open(name, 0);
+  rtems_test_assert(sem == SEM_FAILED);
+  rtems_test_assert(errno == ENOENT);
+}
+
+static void test_string_names(void)
+{
+  sem_t *sems[POSIX_SEMAPHORE_COUNT];
+  sem_t *sem;
+  char name[16];
+  int rv;
+  int i;
+
+  for (i = 0; i < POSIX_SEMAPHORE_COUNT; ++i) {
+    posix_semaphore_name(name, sizeof(name), i);
+    sems[i] = sem_open(name, O_CREAT | O_EXCL, 0777, 1);
+    rtems_test_assert(sems[i] != SEM_FAILED);
+  }
+
+  for (i = 0; i < POSIX_SEMAPHORE_COUNT; ++i) {
+    posix_semaphore_name(name, sizeof(name), i);
+    assert_posix_semaphore_open(name, sems[i]);
+  }
+
+  assert_no_posix_semaphore("/s");
+  assert_no_posix_semaphore("/none");
+
+  errno = 0;
+  sem = sem_open("/s1", O_CREAT | O_EXCL, 0777, 1);
+  rtems_test_assert(sem == SEM_FAILED);
+  rtems_test_assert(errno == EEXIST);
+
+  /* Unlinked names are removed from the name hash index */
+  rv = sem_unlink("/s1");
+  rtems_test_assert(rv == 0);
+  assert_no_posix_semaphore("/s1");
+  assert_posix_semaphore_open("/s10", sems[10]);
+  assert_posix_semaphore_open("/s11", sems[11]);
+
+  rv = sem_close(sems[1]);
+  rtems_test_assert(rv == 0);
+
+  sems[1] = sem_open("/s1", O_CREAT | O_EXCL, 0777, 1);
+  rtems_test_assert(sems[1] != SEM_FAILED);
+  assert_posix_semaphore_open("/s1", sems[1]);
+
+  for (i = 0; i < POSIX_SEMAPHORE_COUNT; ++i) {
+    posix_semaphore_name(name, sizeof(name), i);
+
+    rv = sem_close(sems[i]);
+    rtems_test_assert(rv == 0);
+
+    rv = sem_unlink(name);
+    rtems_test_assert(rv == 0);
+
+    assert_no_posix_semaphore(name);
+  }
+}
+#endif
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_unlimited();
+  test_limited();
+#if defined(RTEMS_POSIX_API)
+  test_string_names();
+#endif
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES \
+  rtems_resource_name_hash(rtems_resource_unlimited(SEMAPHORES_PER_ALLOCATION))
+#define CONFIGURE_MAXIMUM_TIMERS rtems_resource_name_hash(TIMER_COUNT)
+
+#if defined(RTEMS_POSIX_API)
+  #define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES \
+    rtems_resource_name_hash(POSIX_SEMAPHORE_COUNT)
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -113,6 +113,124 @@ static void test_iterate(void)
   rtems_interrupt_lock_destroy(&ctx->d);
 }
 
+typedef struct {
+  bool lock_found;
+  uint64_t lock_usage_count;
+  uint64_t lock_contention_count;
+  uint64_t lock_total_section_time;
+  bool per_cpu_found;
+  uint64_t thread_dispatch_disabled_count;
+} snapshot;
+
+static void snapshot_visitor(void *arg, const rtems_profiling_data *data)
+{
+  snapshot *snap = arg;
+  const rtems_profiling_smp_lock *psl;
+  const rtems_profiling_per_cpu *per_cpu;
+  size_t i;
+
+  switch (data->header.type) {
+    case RTEMS_PROFILING_SMP_LOCK:
+      psl = &data->smp_lock;
+
+      if (is_equal(psl, "r")) {
+        snap->lock_found = true;
+        snap->lock_usage_count = psl->usage_count;
+        snap->lock_total_section_time = psl->total_section_time;
+
+        for (i = 0; i < RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS; ++i) {
+          snap->lock_contention_count += psl->contention_counts[i];
+        }
+      }
+      break;
+    case RTEMS_PROFILING_PER_CPU:
+      per_cpu = &data->per_cpu;
+      snap->per_cpu_found = true;
+      snap->thread_dispatch_disabled_count +=
+        per_cpu->thread_dispatch_disabled_count;
+      break;
+    default:
+      break;
+  }
+}
+
+static void take_snapshot(snapshot *snap)
+{
+  memset(snap, 0, sizeof(*snap));
+  rtems_profiling_iterate(snapshot_visitor, snap);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(snap->per_cpu_found);
+#ifdef RTEMS_SMP
+  rtems_test_assert(snap->lock_found);
+#endif
+#endif
+}
+
+static void use_lock(rtems_interrupt_lock *lock, int n)
+{
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    rtems_interrupt_lock_context lock_context;
+
+    rtems_interrupt_lock_acquire(lock, &lock_context);
+    rtems_interrupt_lock_release(lock, &lock_context);
+  }
+}
+
+static void test_reset(void)
+{
+  rtems_interrupt_lock lock;
+  rtems_status_code sc;
+  snapshot before;
+  snapshot reset;
+  snapshot after;
+
+  lock_init(&lock, "r");
+  use_lock(&lock, 10);
+
+  sc = rtems_task_wake_after(3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  take_snapshot(&before);
+  rtems_test_assert(!before.lock_found || before.lock_usage_count == 11);
+
+  rtems_profiling_reset();
+  take_snapshot(&reset);
+
+  /* Nobody else uses the lock */
+  rtems_test_assert(reset.lock_usage_count == 0);
+  rtems_test_assert(reset.lock_contention_count == 0);
+  rtems_test_assert(reset.lock_total_section_time == 0);
+
+  /*
+   * Thread dispatches may happen after the reset.  The interrupt counts are
+   * not checked since not all ports maintain them.
+   */
+  rtems_test_assert(
+    !reset.per_cpu_found
+      || reset.thread_dispatch_disabled_count
+        < before.thread_dispatch_disabled_count
+  );
+
+  /* The statistics grow again after the reset */
+  use_lock(&lock, 5);
+
+  sc = rtems_task_wake_after(3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  take_snapshot(&after);
+  rtems_test_assert(!after.lock_found || after.lock_usage_count == 5);
+  rtems_test_assert(
+    !after.per_cpu_found
+      || after.thread_dispatch_disabled_count
+        > reset.thread_dispatch_disabled_count
+  );
+
+  rtems_interrupt_lock_destroy(&lock);
+}
+
 static void test_report_xml(void)
 {
   rtems_status_code sc;
@@ -130,6 +248,7 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test_iterate();
+  test_reset();
   test_report_xml();
 
   TEST_END();
@@ -0,0 +1,243 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems/stackpool.h>
+
+const char rtems_test_name[] = "SPSTKALLOC 3";
+
+#define SMALL_STACK_SIZE RTEMS_MINIMUM_STACK_SIZE
+
+#define LARGE_STACK_SIZE (4 * RTEMS_MINIMUM_STACK_SIZE)
+
+#define CLASS_COUNT 2
+
+static void get_stats(size_t class_index, rtems_stack_pool_statistics *stats)
+{
+  rtems_status_code sc;
+
+  sc = rtems_stack_pool_get_statistics(class_index, stats);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    /* Do nothing */
+  }
+}
+
+static rtems_id create_task(size_t stack_size)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    2,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void delete_task(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_statistics(void)
+{
+  rtems_stack_pool_statistics stats;
+  rtems_status_code sc;
+
+  sc = rtems_stack_pool_get_statistics(0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_stack_pool_get_statistics(CLASS_COUNT, &stats);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  get_stats(0, &stats);
+  rtems_test_assert(stats.stack_size == SMALL_STACK_SIZE);
+
+  get_stats(1, &stats);
+  rtems_test_assert(stats.stack_size == 2 * SMALL_STACK_SIZE);
+}
+
+static void test_task_recycling(void)
+{
+  rtems_stack_pool_statistics before;
+  rtems_stack_pool_statistics after;
+  rtems_id id;
+
+  get_stats(0, &before);
+  id = create_task(SMALL_STACK_SIZE);
+  get_stats(0, &after);
+  rtems_test_assert(after.misses == before.misses + 1);
+  rtems_test_assert(after.hits == before.hits);
+
+  delete_task(id);
+
+  /* The task create frees the stack of the zombie before the allocation */
+  get_stats(0, &before);
+  id = create_task(SMALL_STACK_SIZE);
+  get_stats(0, &after);
+  rtems_test_assert(after.misses == before.misses);
+  rtems_test_assert(after.hits == before.hits + 1);
+  rtems_test_assert(after.free_stacks == 0);
+  rtems_test_assert(after.guard_violations == 0);
+
+  delete_task(id);
+
+  /* Stack sizes are rounded up to the next size class */
+  get_stats(1, &before);
+  id = create_task(SMALL_STACK_SIZE + 1);
+  get_stats(1, &after);
+  rtems_test_assert(after.misses == before.misses + 1);
+
+  delete_task(id);
+  id = create_task(2 * SMALL_STACK_SIZE);
+  get_stats(1, &after);
+  rtems_test_assert(after.misses == before.misses + 1);
+  rtems_test_assert(after.hits == before.hits + 1);
+
+  delete_task(id);
+
+  /* Stacks larger than the largest size class bypass the pool */
+  get_stats(1, &before);
+  id = create_task(LARGE_STACK_SIZE);
+  delete_task(id);
+  id = create_task(LARGE_STACK_SIZE);
+  delete_task(id);
+  get_stats(1, &after);
+  rtems_test_assert(after.misses == before.misses);
+  rtems_test_assert(after.hits == before.hits);
+}
+
+static void test_guard_pattern(void)
+{
+  rtems_stack_pool_statistics before;
+  rtems_stack_pool_statistics after;
+  uint8_t *stack;
+  uint8_t *stack_2;
+
+  stack = rtems_stack_pool_allocate(SMALL_STACK_SIZE);
+  rtems_test_assert(stack != NULL);
+  rtems_stack_pool_free(stack);
+  rtems_test_assert(stack[0] == RTEMS_STACK_POOL_GUARD_BYTE);
+  rtems_test_assert(
+    stack[SMALL_STACK_SIZE - 1] == RTEMS_STACK_POOL_GUARD_BYTE
+  );
+
+  get_stats(0, &before);
+  stack_2 = rtems_stack_pool_allocate(SMALL_STACK_SIZE);
+  get_stats(0, &after);
+  rtems_test_assert(stack_2 == stack);
+  rtems_test_assert(after.hits == before.hits + 1);
+  rtems_test_assert(after.guard_violations == before.guard_violations);
+
+  /* Simulate a write to a free stack */
+  rtems_stack_pool_free(stack);
+  stack[RTEMS_STACK_POOL_GUARD_SIZE - 1] = 0;
+
+  stack_2 = rtems_stack_pool_allocate(SMALL_STACK_SIZE);
+  get_stats(0, &after);
+  rtems_test_assert(stack_2 == stack);
+  rtems_test_assert(after.guard_violations == before.guard_violations + 1);
+
+  rtems_stack_pool_free(stack);
+  rtems_stack_pool_free(NULL);
+}
+
+static void test_trim(void)
+{
+  rtems_stack_pool_statistics before;
+  rtems_stack_pool_statistics after;
+  void *stacks[2];
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(stacks); ++i) {
+    stacks[i] = rtems_stack_pool_allocate(SMALL_STACK_SIZE);
+    rtems_test_assert(stacks[i] != NULL);
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(stacks); ++i) {
+    rtems_stack_pool_free(stacks[i]);
+  }
+
+  get_stats(0, &before);
+  rtems_test_assert(before.free_stacks >= RTEMS_ARRAY_SIZE(stacks));
+
+  rtems_stack_pool_trim();
+
+  for (i = 0; i < CLASS_COUNT; ++i) {
+    get_stats(i, &after);
+    rtems_test_assert(after.free_stacks == 0);
+  }
+
+  /* The next allocation is satisfied by the RTEMS Workspace */
+  get_stats(0, &before);
+  stacks[0] = rtems_stack_pool_allocate(SMALL_STACK_SIZE);
+  rtems_test_assert(stacks[0] != NULL);
+  get_stats(0, &after);
+  rtems_test_assert(after.misses == before.misses + 1);
+  rtems_test_assert(after.hits == before.hits);
+
+  rtems_stack_pool_free(stacks[0]);
+  rtems_stack_pool_trim();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_statistics();
+  test_task_recycling();
+  test_guard_pattern();
+  test_trim();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS LARGE_STACK_SIZE
+
+#define CONFIGURE_TASK_STACK_POOL
+
+#define CONFIGURE_TASK_STACK_POOL_SIZE_CLASSES \
+  SMALL_STACK_SIZE, 2 * SMALL_STACK_SIZE
+
+#define CONFIGURE_TASK_STACK_POOL_GUARD_PATTERN
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
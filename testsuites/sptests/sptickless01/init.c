@@ -0,0 +1,250 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPTICKLESS 1";
+
+#define MAX_TICKS 100
+
+typedef struct {
+  uint32_t elapsed;
+  uint64_t next_tick;
+  uint32_t set_next_tick_count;
+  uint32_t timer_count;
+  rtems_id timer;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t test_elapsed_ticks(Per_CPU_Control *cpu)
+{
+  test_context *ctx = &test_instance;
+  uint32_t elapsed;
+
+  elapsed = ctx->elapsed;
+  ctx->elapsed = 0;
+
+  return elapsed;
+}
+
+static void test_set_next_tick(Per_CPU_Control *cpu, uint64_t next_tick)
+{
+  test_context *ctx = &test_instance;
+
+  rtems_test_assert(next_tick > cpu->Watchdog.ticks);
+
+  ctx->next_tick = next_tick;
+  ++ctx->set_next_tick_count;
+}
+
+static const Watchdog_Tickless_operations test_operations = {
+  .elapsed_ticks = test_elapsed_ticks,
+  .set_next_tick = test_set_next_tick,
+  .max_ticks = MAX_TICKS
+};
+
+static Per_CPU_Control *get_cpu(void)
+{
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Thread_Dispatch_disable();
+  _Thread_Dispatch_enable(cpu_self);
+
+  return cpu_self;
+}
+
+static uint64_t get_ticks(void)
+{
+  return get_cpu()->Watchdog.ticks;
+}
+
+/*
+ * Simulate a clock interrupt which happens after the specified count of clock
+ * tick intervals.
+ */
+static void clock_interrupt(test_context *ctx, uint32_t elapsed)
+{
+  Per_CPU_Control *cpu_self;
+
+  ctx->elapsed = elapsed;
+
+  cpu_self = _Thread_Dispatch_disable();
+  _Watchdog_Tickless_tick(cpu_self);
+  _Thread_Dispatch_enable(cpu_self);
+}
+
+static void timer_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+
+  ++ctx->timer_count;
+}
+
+static void test_enable(test_context *ctx)
+{
+  Per_CPU_Control *cpu_self;
+  uint64_t ticks;
+
+  cpu_self = _Thread_Dispatch_disable();
+  ticks = cpu_self->Watchdog.ticks;
+  _Watchdog_Tickless_enable(cpu_self, &test_operations);
+  _Thread_Dispatch_enable(cpu_self);
+
+  /* No watchdog is scheduled */
+  rtems_test_assert(ctx->set_next_tick_count == 1);
+  rtems_test_assert(ctx->next_tick == ticks + MAX_TICKS);
+  rtems_test_assert(get_cpu()->Watchdog.next_tick == ctx->next_tick);
+}
+
+static void test_ticks_since_boot(test_context *ctx)
+{
+  rtems_interval before;
+  uint64_t ticks;
+
+  before = rtems_clock_get_ticks_since_boot();
+  ticks = get_ticks();
+
+  /* The elapsed clock tick intervals are accounted on each read */
+  ctx->elapsed = 7;
+  rtems_test_assert(rtems_clock_get_ticks_since_boot() == before + 7);
+  rtems_test_assert(get_ticks() == ticks + 7);
+  rtems_test_assert(rtems_clock_tick_before(before + 8));
+  rtems_test_assert(!rtems_clock_tick_before(before + 7));
+}
+
+static void test_timer(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint64_t ticks;
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The new watchdog expires before the next clock interrupt.  The timer
+   * starts after the ticks elapsed since the last clock interrupt.
+   */
+  ticks = get_ticks();
+  ctx->elapsed = 3;
+  sc = rtems_timer_fire_after(ctx->timer, 5, timer_routine, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->next_tick == ticks + 3 + 5);
+
+  clock_interrupt(ctx, 5);
+  rtems_test_assert(ctx->timer_count == 1);
+  rtems_test_assert(get_ticks() == ticks + 3 + 5);
+  rtems_test_assert(ctx->next_tick == ticks + 3 + 5 + MAX_TICKS);
+
+  /* The clock interrupts are at most the maximum count of ticks apart */
+  ticks = get_ticks();
+  sc = rtems_timer_fire_after(
+    ctx->timer,
+    2 * MAX_TICKS + 50,
+    timer_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->next_tick == ticks + MAX_TICKS);
+
+  clock_interrupt(ctx, MAX_TICKS);
+  rtems_test_assert(ctx->timer_count == 1);
+  rtems_test_assert(ctx->next_tick == ticks + 2 * MAX_TICKS);
+
+  clock_interrupt(ctx, MAX_TICKS);
+  rtems_test_assert(ctx->timer_count == 1);
+  rtems_test_assert(ctx->next_tick == ticks + 2 * MAX_TICKS + 50);
+
+  clock_interrupt(ctx, 50);
+  rtems_test_assert(ctx->timer_count == 2);
+  rtems_test_assert(ctx->next_tick == ticks + 3 * MAX_TICKS + 50);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void timeslice_task(rtems_task_argument arg)
+{
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_timeslice(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  uint64_t ticks;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'S', 'L', 'C'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_TIMESLICE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ticks = get_ticks();
+  rtems_test_assert(ctx->next_tick == ticks + MAX_TICKS);
+
+  /*
+   * The timeslice task becomes the heir without a clock interrupt, so the
+   * thread dispatch must program the next clock interrupt.
+   */
+  sc = rtems_task_start(id, timeslice_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->next_tick == ticks + 1);
+
+  /* Without a thread using a CPU budget, the clock interrupts stop again */
+  clock_interrupt(ctx, 1);
+  rtems_test_assert(ctx->next_tick == ticks + 1 + MAX_TICKS);
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_enable(ctx);
+  test_ticks_since_boot(ctx);
+  test_timer(ctx);
+  test_timeslice(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* The clock interrupts are simulated by the test */
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
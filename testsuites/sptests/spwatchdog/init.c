@@ -224,6 +224,100 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static void test_watchdog_wheel_operations( void )
+{
+  static Watchdog_Wheel wheel;
+  Watchdog_Header header;
+  uint64_t now;
+  test_watchdog a;
+  test_watchdog b;
+  test_watchdog c;
+  test_watchdog d;
+
+  now = 0;
+  _Watchdog_Header_initialize_wheel( &header, &wheel, now );
+  rtems_test_assert( header.wheel == &wheel );
+  rtems_test_assert( wheel.count == 0 );
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+  test_watchdog_init( &c, 30 );
+  test_watchdog_init( &d, 40 );
+
+  /* Level zero, level one, level three and beyond the wheel range */
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  _Watchdog_Insert( &header, &b.Base, now + 100 );
+  _Watchdog_Insert( &header, &c.Base, now + 0x100000 );
+  _Watchdog_Insert( &header, &d.Base, now + 0x1000000 );
+  rtems_test_assert(
+    _Watchdog_Get_state( &a.Base ) == WATCHDOG_SCHEDULED_WHEEL
+  );
+  rtems_test_assert(
+    _Watchdog_Get_state( &b.Base ) == WATCHDOG_SCHEDULED_WHEEL
+  );
+  rtems_test_assert(
+    _Watchdog_Get_state( &c.Base ) == WATCHDOG_SCHEDULED_WHEEL
+  );
+  rtems_test_assert( !test_watchdog_is_inactive( &d ) );
+  rtems_test_assert(
+    _Watchdog_Get_state( &d.Base ) != WATCHDOG_SCHEDULED_WHEEL
+  );
+  rtems_test_assert( header.first == &d.Base.Node.RBTree );
+  rtems_test_assert( wheel.count == 3 );
+  rtems_test_assert( _Watchdog_Wheel_next_expire( &wheel ) == 1 );
+
+  now = test_watchdog_tick( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 11 );
+  rtems_test_assert( wheel.count == 2 );
+
+  /* The level one slot of the second watchdog cascades at tick 64 */
+  rtems_test_assert( _Watchdog_Wheel_next_expire( &wheel ) == 64 );
+
+  /* Already expired watchdogs fire with the next tick */
+  _Watchdog_Insert( &header, &a.Base, now );
+  rtems_test_assert( a.Base.expire == now );
+  now = test_watchdog_tick( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 12 );
+
+  while ( now < 99 ) {
+    now = test_watchdog_tick( &header, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 20 );
+  now = test_watchdog_tick( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 21 );
+
+  _Watchdog_Remove( &header, &c.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( wheel.count == 0 );
+  rtems_test_assert( _Watchdog_Wheel_next_expire( &wheel ) == UINT64_MAX );
+
+  /* Cascade through all levels */
+  _Watchdog_Insert( &header, &c.Base, 0x100000 );
+
+  while ( now < 0x100000 - 1 ) {
+    now = test_watchdog_tick( &header, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( c.counter == 30 );
+  now = test_watchdog_tick( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( c.counter == 31 );
+  rtems_test_assert( wheel.count == 0 );
+
+  _Watchdog_Remove( &header, &d.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &d ) );
+  rtems_test_assert( d.counter == 40 );
+  rtems_test_assert( header.first == NULL );
+
+  _Watchdog_Header_destroy( &header );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -234,6 +328,7 @@ rtems_task Init(
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel_operations();
   test_watchdog_static_init();
   test_watchdog_config();
 
@@ -0,0 +1,385 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPWORKQUEUE 1";
+
+#define ITEM_COUNT 4
+
+#define RESUBMIT_COUNT 3
+
+typedef struct {
+  rtems_work_queue queue;
+  rtems_work_item items[ITEM_COUNT];
+  rtems_work_item resubmit_item;
+  rtems_work_item delayed_item;
+  rtems_work_item sync_item;
+  rtems_id master;
+  int order[ITEM_COUNT];
+  int order_index;
+  int resubmits;
+  rtems_interval delayed_ticks;
+  int sync_state;
+} test_context;
+
+static test_context test_instance;
+
+static void wait_for_worker(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void record_handler(rtems_work_item *item)
+{
+  test_context *ctx = rtems_work_item_get_argument(item);
+  int i = (int) (item - &ctx->items[0]);
+
+  ctx->order[ctx->order_index] = i;
+  ++ctx->order_index;
+
+  if (ctx->order_index == ITEM_COUNT) {
+    rtems_event_transient_send(ctx->master);
+  }
+}
+
+static void resubmit_handler(rtems_work_item *item)
+{
+  test_context *ctx = rtems_work_item_get_argument(item);
+  rtems_status_code sc;
+
+  ++ctx->resubmits;
+
+  if (ctx->resubmits < RESUBMIT_COUNT) {
+    sc = rtems_work_queue_submit(&ctx->queue, item);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    rtems_event_transient_send(ctx->master);
+  }
+}
+
+static void delayed_handler(rtems_work_item *item)
+{
+  test_context *ctx = rtems_work_item_get_argument(item);
+
+  ctx->delayed_ticks = rtems_clock_get_ticks_since_boot();
+  rtems_event_transient_send(ctx->master);
+}
+
+static void sync_handler(rtems_work_item *item)
+{
+  test_context *ctx = rtems_work_item_get_argument(item);
+  rtems_status_code sc;
+
+  ctx->sync_state = 1;
+  rtems_event_transient_send(ctx->master);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->sync_state = 2;
+}
+
+static void test_create(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_work_queue_create(
+    NULL,
+    rtems_build_name('W', 'O', 'R', 'K'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_work_queue_create(
+    &ctx->queue,
+    rtems_build_name('W', 'O', 'R', 'K'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_priorities(test_context *ctx)
+{
+  static const rtems_work_priority priorities[ITEM_COUNT] = {
+    RTEMS_WORK_PRIORITY_LOW,
+    RTEMS_WORK_PRIORITY_NORMAL,
+    RTEMS_WORK_PRIORITY_HIGH,
+    RTEMS_WORK_PRIORITY_NORMAL
+  };
+  static const int expected_order[ITEM_COUNT] = { 2, 1, 3, 0 };
+  rtems_status_code sc;
+  int i;
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    rtems_work_item_initialize(
+      &ctx->items[i],
+      record_handler,
+      ctx,
+      priorities[i]
+    );
+  }
+
+  sc = rtems_work_queue_cancel(&ctx->items[0]);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  /* The worker has a lower priority, so the work items stay pending */
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    sc = rtems_work_queue_submit_to_processor(&ctx->queue, &ctx->items[i], 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_work_queue_submit(&ctx->queue, &ctx->items[0]);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_work_queue_submit_to_processor(
+    &ctx->queue,
+    &ctx->items[0],
+    rtems_get_processor_count()
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  wait_for_worker();
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    rtems_test_assert(ctx->order[i] == expected_order[i]);
+  }
+}
+
+static void test_cancel(test_context *ctx)
+{
+  rtems_status_code sc;
+  int i;
+
+  ctx->order_index = 0;
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    sc = rtems_work_queue_submit_to_processor(&ctx->queue, &ctx->items[i], 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_work_queue_cancel(&ctx->items[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_cancel(&ctx->items[1]);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  /* Submit the cancelled work item again to get the completion event */
+  sc = rtems_work_queue_submit_to_processor(&ctx->queue, &ctx->items[1], 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_worker();
+
+  rtems_test_assert(ctx->order[0] == 2);
+  rtems_test_assert(ctx->order[1] == 3);
+  rtems_test_assert(ctx->order[2] == 1);
+  rtems_test_assert(ctx->order[3] == 0);
+}
+
+static void test_resubmit(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  rtems_work_item_initialize(
+    &ctx->resubmit_item,
+    resubmit_handler,
+    ctx,
+    RTEMS_WORK_PRIORITY_NORMAL
+  );
+
+  sc = rtems_work_queue_submit(&ctx->queue, &ctx->resubmit_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_worker();
+  rtems_test_assert(ctx->resubmits == RESUBMIT_COUNT);
+}
+
+static void test_delayed(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_interval start;
+
+  rtems_work_item_initialize(
+    &ctx->delayed_item,
+    delayed_handler,
+    ctx,
+    RTEMS_WORK_PRIORITY_HIGH
+  );
+
+  /* A cancelled delayed work item is not executed */
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->delayed_item, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->delayed_item, 1);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_work_queue_cancel(&ctx->delayed_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->delayed_ticks == 0);
+
+  start = rtems_clock_get_ticks_since_boot();
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->delayed_item, 2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_worker();
+  rtems_test_assert(ctx->delayed_ticks - start >= 2);
+
+  ctx->delayed_ticks = 0;
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->delayed_item, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_worker();
+  rtems_test_assert(ctx->delayed_ticks != 0);
+}
+
+static void test_worker_info(test_context *ctx)
+{
+  rtems_work_queue_worker_info info;
+  rtems_status_code sc;
+
+  sc = rtems_work_queue_get_worker_info(&ctx->queue, 0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_work_queue_get_worker_info(
+    &ctx->queue,
+    rtems_get_processor_count(),
+    &info
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_work_queue_get_worker_info(&ctx->queue, 0, &info);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(info.task_id != RTEMS_ID_NONE);
+  rtems_test_assert(info.pending == 0);
+
+  if (rtems_get_processor_count() == 1) {
+    rtems_test_assert(
+      info.executed == 2 * ITEM_COUNT + RESUBMIT_COUNT + 2
+    );
+    rtems_test_assert(info.stolen == 0);
+  }
+}
+
+static void test_cancel_sync(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  rtems_work_item_initialize(
+    &ctx->sync_item,
+    sync_handler,
+    ctx,
+    RTEMS_WORK_PRIORITY_NORMAL
+  );
+
+  /* A work item which was never submitted is idle */
+  sc = rtems_work_queue_cancel_sync(&ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_submit(&ctx->queue, &ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_cancel_sync(&ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->sync_item, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_cancel_sync(&ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sync_state == 0);
+
+  /* Wait for the handler in progress */
+  sc = rtems_work_queue_submit(&ctx->queue, &ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_worker();
+  rtems_test_assert(ctx->sync_state == 1);
+
+  sc = rtems_work_queue_cancel_sync(&ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->sync_state == 2);
+}
+
+static void test_delete(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_work_queue_delete(NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_work_queue_submit_after(&ctx->queue, &ctx->sync_item, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_delete(&ctx->queue);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_work_queue_cancel_sync(&ctx->sync_item);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_delete(&ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The worker tasks are available again */
+  test_create(ctx);
+
+  sc = rtems_work_queue_delete(&ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  ctx->master = rtems_task_self();
+
+  test_create(ctx);
+  test_priorities(ctx);
+  test_cancel(ctx);
+  test_resubmit(ctx);
+  test_delayed(ctx);
+  test_worker_info(ctx);
+  test_cancel_sync(ctx);
+  test_delete(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
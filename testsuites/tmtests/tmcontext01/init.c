@@ -46,6 +46,8 @@ static volatile int *main_data;
 
 static Context_Control ctx;
 
+static volatile double fp_data;
+
 static int dirty_data_cache(volatile int *data, size_t n, size_t clsz, int j)
 {
   size_t m = n / sizeof(*data);
@@ -136,29 +138,14 @@ static void sort_t(void)
   qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
 }
 
-static void test_by_function_level(int fl, bool dirty)
+static void print_sorted_t(void)
 {
-  RTEMS_INTERRUPT_LOCK_DECLARE(, lock)
-  rtems_interrupt_lock_context lock_context;
-  int s;
   uint64_t min;
   uint64_t q1;
   uint64_t q2;
   uint64_t q3;
   uint64_t max;
 
-  fl += prevent_optimization;
-
-  rtems_interrupt_lock_initialize(&lock, "test");
-  rtems_interrupt_lock_acquire(&lock, &lock_context);
-
-  for (s = 0; s < SAMPLES; ++s) {
-    call_at_level(fl, fl, s, dirty);
-  }
-
-  rtems_interrupt_lock_release(&lock, &lock_context);
-  rtems_interrupt_lock_destroy(&lock);
-
   sort_t();
 
   min = t[0];
@@ -168,14 +155,11 @@ static void test_by_function_level(int fl, bool dirty)
   max = t[SAMPLES - 1];
 
   printf(
-    "    <Sample functionNestLevel=\"%i\">\n"
     "      <Min unit=\"ns\">%" PRIu64 "</Min>"
       "<Q1 unit=\"ns\">%" PRIu64 "</Q1>"
       "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
       "<Q3 unit=\"ns\">%" PRIu64 "</Q3>"
-      "<Max unit=\"ns\">%" PRIu64 "</Max>\n"
-    "    </Sample>\n",
-    fl,
+      "<Max unit=\"ns\">%" PRIu64 "</Max>\n",
     rtems_counter_ticks_to_nanoseconds(min),
     rtems_counter_ticks_to_nanoseconds(q1),
     rtems_counter_ticks_to_nanoseconds(q2),
@@ -184,6 +168,29 @@ static void test_by_function_level(int fl, bool dirty)
   );
 }
 
+static void test_by_function_level(int fl, bool dirty)
+{
+  RTEMS_INTERRUPT_LOCK_DECLARE(, lock)
+  rtems_interrupt_lock_context lock_context;
+  int s;
+
+  fl += prevent_optimization;
+
+  rtems_interrupt_lock_initialize(&lock, "test");
+  rtems_interrupt_lock_acquire(&lock, &lock_context);
+
+  for (s = 0; s < SAMPLES; ++s) {
+    call_at_level(fl, fl, s, dirty);
+  }
+
+  rtems_interrupt_lock_release(&lock, &lock_context);
+  rtems_interrupt_lock_destroy(&lock);
+
+  printf("    <Sample functionNestLevel=\"%i\">\n", fl);
+  print_sorted_t();
+  printf("    </Sample>\n");
+}
+
 static void test(bool dirty, uint32_t load)
 {
   int fl;
@@ -206,6 +213,123 @@ static void test(bool dirty, uint32_t load)
   printf("  </ContextSwitchTest>\n");
 }
 
+static bool fp_partner_is_fp;
+
+static volatile double fp_partner_data;
+
+static void fp_partner_task(rtems_task_argument arg)
+{
+  rtems_id master = (rtems_id) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    /* Disturb the floating point registers */
+    if (fp_partner_is_fp) {
+      double a = fp_partner_data + 2.0;
+      double b = fp_partner_data + 3.0;
+      double c = fp_partner_data + 5.0;
+      double d = fp_partner_data + 7.0;
+
+      fp_partner_data = (a * b + c * d) / (a + b + c + d);
+    }
+
+    sc = rtems_event_transient_send(master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Measure the round trip time of two thread dispatches between the floating
+ * point Init task and a partner task.  The Init task and the partner must use
+ * the same processor, so this test is only performed on uniprocessor
+ * configurations.  In case the partner is integer-only, then the floating
+ * point unit still contains the context of the Init task when it is
+ * dispatched again.  With deferred floating point switches the restore of
+ * this context is skipped.
+ */
+static void test_fp_switch(rtems_attribute partner_attributes)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+  rtems_id self;
+  rtems_id partner;
+  int s;
+
+  self = rtems_task_self();
+
+  fp_partner_is_fp = (partner_attributes & RTEMS_FLOATING_POINT) != 0;
+
+  sc = rtems_task_set_priority(self, 3, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('F', 'P', 'S', 'W'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    partner_attributes,
+    &partner
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(partner, fp_partner_task, (rtems_task_argument) self);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    double v0;
+    double v1;
+    double v2;
+    double v3;
+
+    /*
+     * Use the floating point unit before each switch.  The values are live
+     * across the switch, so they are kept in callee-saved floating point
+     * registers if the architecture has them.  All operations are exact.
+     */
+    fp_data = s * 0.25;
+    v0 = fp_data + 1.0;
+    v1 = fp_data * 3.0;
+    v2 = fp_data - 5.0;
+    v3 = fp_data * 7.0;
+
+    a = rtems_counter_read();
+
+    sc = rtems_event_transient_send(partner);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    b = rtems_counter_read();
+    t[s] = rtems_counter_difference(b, a);
+
+    /* Check that the floating point context survived the switch */
+    rtems_test_assert(v0 == fp_data + 1.0);
+    rtems_test_assert(v1 == fp_data * 3.0);
+    rtems_test_assert(v2 == fp_data - 5.0);
+    rtems_test_assert(v3 == fp_data * 7.0);
+  }
+
+  sc = rtems_task_delete(partner);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_priority(self, prio, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "  <FloatingPointSwitchTest partner=\"%s\">\n",
+    fp_partner_is_fp ? "floatingPoint" : "integer"
+  );
+  print_sorted_t();
+  printf("  </FloatingPointSwitchTest>\n");
+}
+
 static void Init(rtems_task_argument arg)
 {
   uint32_t load = 0;
@@ -230,6 +354,11 @@ static void Init(rtems_task_argument arg)
   test(false, load);
   test(true, load);
 
+  if (rtems_get_processor_count() == 1) {
+    test_fp_switch(RTEMS_FLOATING_POINT);
+    test_fp_switch(RTEMS_DEFAULT_ATTRIBUTES);
+  }
+
   for (load = 1; load < rtems_get_processor_count(); ++load) {
     rtems_status_code sc;
     rtems_id id;
@@ -272,6 +401,8 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
 
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
 #define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
 
 #define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
@@ -0,0 +1,161 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMOBJECT 1";
+
+#define OBJECTS_PER_ALLOCATION 32
+
+typedef struct {
+  rtems_counter_ticks extend_max;
+  rtems_counter_ticks create_max;
+} test_sample;
+
+static void print_sample(size_t object_count, const test_sample *sample)
+{
+  printf(
+    "  <Sample>\n"
+    "    <ObjectCount>%zu</ObjectCount>"
+    "<ExtendMax unit=\"ns\">%" PRIu64 "</ExtendMax>"
+    "<CreateMax unit=\"ns\">%" PRIu64 "</CreateMax>\n"
+    "  </Sample>\n",
+    object_count,
+    rtems_counter_ticks_to_nanoseconds(sample->extend_max),
+    rtems_counter_ticks_to_nanoseconds(sample->create_max)
+  );
+}
+
+/*
+ * Create timers until the workspace is exhausted.  Every create of an object
+ * with an index one past a multiple of the objects per allocation extends the
+ * object information.  Report the maximum create time with and without an
+ * extension for object count intervals of geometrically increasing size.
+ */
+static void test(void)
+{
+  test_sample sample;
+  rtems_counter_ticks extend_worst;
+  rtems_counter_ticks create_worst;
+  size_t object_count;
+  size_t next_report;
+
+  memset(&sample, 0, sizeof(sample));
+  extend_worst = 0;
+  create_worst = 0;
+  object_count = 0;
+  next_report = OBJECTS_PER_ALLOCATION;
+
+  printf(
+    "<TMObject01 objectsPerAllocation=\"%d\">\n",
+    OBJECTS_PER_ALLOCATION
+  );
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+    rtems_id id;
+
+    a = rtems_counter_read();
+    sc = rtems_timer_create(rtems_build_name('T', 'M', 'O', 'B'), &id);
+    b = rtems_counter_read();
+
+    if (sc != RTEMS_SUCCESSFUL) {
+      rtems_test_assert(sc == RTEMS_TOO_MANY);
+      break;
+    }
+
+    d = rtems_counter_difference(b, a);
+
+    if (object_count % OBJECTS_PER_ALLOCATION == 0) {
+      if (d > sample.extend_max) {
+        sample.extend_max = d;
+      }
+    } else {
+      if (d > sample.create_max) {
+        sample.create_max = d;
+      }
+    }
+
+    ++object_count;
+
+    if (object_count == next_report) {
+      print_sample(object_count, &sample);
+
+      if (sample.extend_max > extend_worst) {
+        extend_worst = sample.extend_max;
+      }
+
+      if (sample.create_max > create_worst) {
+        create_worst = sample.create_max;
+      }
+
+      memset(&sample, 0, sizeof(sample));
+      next_report = 2 * next_report;
+    }
+  }
+
+  print_sample(object_count, &sample);
+
+  if (sample.extend_max > extend_worst) {
+    extend_worst = sample.extend_max;
+  }
+
+  if (sample.create_max > create_worst) {
+    create_worst = sample.create_max;
+  }
+
+  printf(
+    "  <WorstCase objectCount=\"%zu\">"
+    "<ExtendMax unit=\"ns\">%" PRIu64 "</ExtendMax>"
+    "<CreateMax unit=\"ns\">%" PRIu64 "</CreateMax>"
+    "</WorstCase>\n"
+    "</TMObject01>\n",
+    object_count,
+    rtems_counter_ticks_to_nanoseconds(extend_worst),
+    rtems_counter_ticks_to_nanoseconds(create_worst)
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS \
+  rtems_resource_unlimited(OBJECTS_PER_ALLOCATION)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,266 @@
+/*
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMTIMER 2";
+
+#define WATCHDOG_COUNT 16384
+
+typedef struct {
+  size_t cache_line_size;
+  size_t data_cache_size;
+  int dummy_value;
+  volatile int *dummy_data;
+  Watchdog_Control *watchdogs;
+  Watchdog_Header rbtree;
+  Watchdog_Header wheel_header;
+  Watchdog_Wheel wheel;
+  uint64_t now;
+  ISR_LOCK_MEMBER( lock )
+} test_context;
+
+static test_context test_instance;
+
+static void prepare_cache(test_context *ctx)
+{
+  volatile int *data = ctx->dummy_data;
+  size_t m = ctx->data_cache_size / sizeof(*data);
+  size_t k = ctx->cache_line_size / sizeof(*data);
+  size_t j = ctx->dummy_value;
+  size_t i;
+
+  for (i = 0; i < m; i += k) {
+    data[i] = i + j;
+  }
+
+  ctx->dummy_value = i + j;
+  rtems_cache_invalidate_entire_instruction();
+}
+
+static void routine(Watchdog_Control *w)
+{
+  (void) w;
+}
+
+static uint64_t timeout(size_t i)
+{
+  /* Short timeouts typical for thread queue waits and task delays */
+  return 1 + (i * 7919) % 10000;
+}
+
+static void test_insert_and_remove(
+  test_context *ctx,
+  Watchdog_Header *header,
+  size_t i,
+  const char *name
+)
+{
+  Watchdog_Control *w;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  rtems_interrupt_level level;
+
+  w = &ctx->watchdogs[i];
+  prepare_cache(ctx);
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  _Watchdog_Insert(header, w, ctx->now + timeout(i));
+  _Watchdog_Remove(header, w);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  d = rtems_counter_difference(b, a);
+
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(d),
+    name
+  );
+}
+
+static void test_tick(
+  test_context *ctx,
+  Watchdog_Header *header,
+  size_t n,
+  const char *name
+)
+{
+  ISR_lock_Context lock_context;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  uint64_t now;
+  size_t i;
+
+  now = ctx->now;
+
+  for (i = 0; i < n; ++i) {
+    _Watchdog_Insert(header, &ctx->watchdogs[i], now + 1);
+  }
+
+  prepare_cache(ctx);
+
+  _ISR_lock_ISR_disable_and_acquire(&ctx->lock, &lock_context);
+  a = rtems_counter_read();
+  _Watchdog_Tickle(header, now + 1, &ctx->lock, &lock_context);
+  b = rtems_counter_read();
+
+  d = rtems_counter_difference(b, a);
+
+  for (i = 0; i < n; ++i) {
+    rtems_test_assert(!_Watchdog_Is_scheduled(&ctx->watchdogs[i]));
+  }
+
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(d),
+    name
+  );
+}
+
+static void test_case(test_context *ctx, size_t j, size_t k)
+{
+  size_t t;
+
+  for (t = k; t < j; ++t) {
+    _Watchdog_Insert(&ctx->rbtree, &ctx->watchdogs[t], ctx->now + timeout(t));
+    _Watchdog_Insert(
+      &ctx->wheel_header,
+      &ctx->watchdogs[WATCHDOG_COUNT + t],
+      ctx->now + timeout(t)
+    );
+  }
+
+  printf("  <Sample>\n    <ActiveWatchdogs>%zu</ActiveWatchdogs>", j);
+
+  test_insert_and_remove(ctx, &ctx->rbtree, j, "RBTree");
+  test_insert_and_remove(
+    ctx,
+    &ctx->wheel_header,
+    WATCHDOG_COUNT + j,
+    "Wheel"
+  );
+
+  printf("\n  </Sample>\n");
+}
+
+static void remove_all(test_context *ctx, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    _Watchdog_Remove(&ctx->rbtree, &ctx->watchdogs[i]);
+    _Watchdog_Remove(&ctx->wheel_header, &ctx->watchdogs[WATCHDOG_COUNT + i]);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  size_t i;
+  size_t j;
+  size_t k;
+
+  ctx->cache_line_size = rtems_cache_get_data_line_size();
+  if (ctx->cache_line_size == 0) {
+    ctx->cache_line_size = 32;
+  }
+
+  ctx->data_cache_size = rtems_cache_get_data_cache_size(0);
+  if (ctx->data_cache_size == 0) {
+    ctx->data_cache_size = ctx->cache_line_size;
+  }
+
+  ctx->dummy_data = malloc(ctx->data_cache_size);
+  rtems_test_assert(ctx->dummy_data != NULL);
+
+  ctx->watchdogs = calloc(2 * WATCHDOG_COUNT, sizeof(*ctx->watchdogs));
+  rtems_test_assert(ctx->watchdogs != NULL);
+
+  for (i = 0; i < 2 * WATCHDOG_COUNT; ++i) {
+    _Watchdog_Preinitialize(&ctx->watchdogs[i], _Per_CPU_Get_snapshot());
+    _Watchdog_Initialize(&ctx->watchdogs[i], routine);
+  }
+
+  _ISR_lock_Initialize(&ctx->lock, "Test");
+  ctx->now = 1;
+  _Watchdog_Header_initialize(&ctx->rbtree);
+  _Watchdog_Header_initialize_wheel(&ctx->wheel_header, &ctx->wheel, ctx->now);
+
+  printf("<TMTimer02 watchdogCount=\"%i\">\n", WATCHDOG_COUNT);
+
+  k = 0;
+  j = 0;
+
+  while (j < WATCHDOG_COUNT - 1) {
+    test_case(ctx, j, k);
+    k = j;
+    j = (123 * (j + 1) + 99) / 100;
+
+    if (j > WATCHDOG_COUNT - 1) {
+      j = WATCHDOG_COUNT - 1;
+    }
+  }
+
+  test_case(ctx, j, k);
+  remove_all(ctx, j);
+
+  k = 1;
+
+  while (k <= WATCHDOG_COUNT) {
+    printf("  <Tick>\n    <ExpiredWatchdogs>%zu</ExpiredWatchdogs>", k);
+    test_tick(ctx, &ctx->rbtree, k, "RBTree");
+    ++ctx->now;
+    test_tick(ctx, &ctx->wheel_header, k, "Wheel");
+    ++ctx->now;
+    printf("\n  </Tick>\n");
+    k *= 4;
+  }
+
+  printf("</TMTimer02>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>